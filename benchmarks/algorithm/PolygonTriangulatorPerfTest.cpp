@@ -0,0 +1,133 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/triangulate/polygon/ConstrainedDelaunayTriangulator.h>
+#include <geos/triangulate/polygon/PolygonTriangulator.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/Polygon.h>
+#include <geos/profiler.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace geos::geom;
+using geos::triangulate::polygon::ConstrainedDelaunayTriangulator;
+using geos::triangulate::polygon::PolygonTriangulator;
+
+class PolygonTriangulatorPerfTest {
+
+public:
+    void test(std::size_t num_points) {
+        std::cout << "Polygon size: " << num_points << std::endl;
+
+        auto star = createStar(num_points);
+        triangulate("Star", *star);
+
+        auto holes = createHoles(num_points);
+        triangulate("Square holes", *holes);
+
+        std::cout << std::endl;
+    }
+
+private:
+    decltype(GeometryFactory::create()) gfact = GeometryFactory::create();
+    geos::util::Profiler* profiler = geos::util::Profiler::instance();
+
+    /**
+     * A ring with noisy radius around a circle.
+     */
+    std::unique_ptr<Polygon> createStar(std::size_t num_points) {
+        std::default_random_engine e(12345);
+        std::uniform_real_distribution<> dis(-1.0, 1.0);
+
+        double step = 2 * M_PI * 1000 / static_cast<double>(num_points);
+        double radius = 750;
+        CoordinateArraySequence seq;
+        for (std::size_t i = 0; i < num_points; i++) {
+            double angle = 2 * M_PI * static_cast<double>(i) / static_cast<double>(num_points);
+            radius = std::min(1000.0, std::max(500.0, radius + 4 * step * dis(e)));
+            seq.add(Coordinate(radius * std::cos(angle), radius * std::sin(angle)));
+        }
+        seq.closeRing();
+        return gfact->createPolygon(gfact->createLinearRing(seq.clone()));
+    }
+
+    /**
+     * A square with a grid of small square holes, with jittered positions.
+     */
+    std::unique_ptr<Polygon> createHoles(std::size_t num_points) {
+        std::default_random_engine e(12345);
+        std::uniform_real_distribution<> dis(0.1, 0.4);
+
+        std::size_t numSide = static_cast<std::size_t>(std::sqrt(static_cast<double>(num_points) / 4));
+        double size = static_cast<double>(numSide);
+
+        CoordinateArraySequence shellSeq;
+        shellSeq.add(Coordinate(0, 0));
+        shellSeq.add(Coordinate(0, size));
+        shellSeq.add(Coordinate(size, size));
+        shellSeq.add(Coordinate(size, 0));
+        shellSeq.closeRing();
+        auto shell = gfact->createLinearRing(shellSeq.clone());
+
+        std::vector<std::unique_ptr<LinearRing>> holes;
+        for (std::size_t i = 0; i < numSide; i++) {
+            for (std::size_t j = 0; j < numSide; j++) {
+                double x = static_cast<double>(i) + dis(e);
+                double y = static_cast<double>(j) + dis(e);
+                double d = dis(e);
+                CoordinateArraySequence seq;
+                seq.add(Coordinate(x, y));
+                seq.add(Coordinate(x + d, y));
+                seq.add(Coordinate(x + d, y + d));
+                seq.add(Coordinate(x, y + d));
+                seq.closeRing();
+                holes.push_back(gfact->createLinearRing(seq.clone()));
+            }
+        }
+        return gfact->createPolygon(std::move(shell), std::move(holes));
+    }
+
+    void triangulate(const std::string& name, const Polygon& poly) {
+        auto sw = profiler->get(name + " ear clipping");
+        sw->start();
+        auto result = PolygonTriangulator::triangulate(&poly);
+        sw->stop();
+        std::cout << sw->name << ": " << result->getNumGeometries() << ": " << *sw << std::endl;
+
+        sw = profiler->get(name + " constrained Delaunay");
+        sw->start();
+        result = ConstrainedDelaunayTriangulator::triangulate(&poly);
+        sw->stop();
+        std::cout << sw->name << ": " << result->getNumGeometries() << ": " << *sw << std::endl;
+    }
+};
+
+int main(int argc, char** argv) {
+    PolygonTriangulatorPerfTest tester;
+
+    std::size_t maxSize = 1000000;
+    if (argc > 1) {
+        maxSize = static_cast<std::size_t>(std::stoul(argv[1]));
+    }
+    for (std::size_t size = 10000; size <= maxSize; size *= 10) {
+        tester.test(size);
+    }
+}
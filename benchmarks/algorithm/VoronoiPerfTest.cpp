@@ -13,6 +13,7 @@
  **********************************************************************/
 
 #include <geos/triangulate/DelaunayTriangulationBuilder.h>
+#include <geos/triangulate/PartitionedVoronoiDiagramBuilder.h>
 #include <geos/triangulate/VoronoiDiagramBuilder.h>
 #include <geos/geom/CoordinateArraySequence.h>
 #include <geos/geom/GeometryFactory.h>
@@ -41,9 +42,13 @@ public:
 
         voronoi(seq);
         voronoi(*geom);
+        voronoi(seq, true);
+        partitionedVoronoi(seq, 1);
+        partitionedVoronoi(seq, 0);
 
         delaunay(seq);
         delaunay(*geom);
+        delaunay(seq, true);
 
         std::cout << std::endl;
     }
@@ -52,11 +57,12 @@ private:
     geos::util::Profiler* profiler = geos::util::Profiler::instance();
 
     template<typename T>
-    void voronoi(const T & sites) {
-        auto sw = profiler->get(std::string("Voronoi from ") + typeid(T).name());
+    void voronoi(const T & sites, bool isSpatialSort = false) {
+        auto sw = profiler->get(std::string("Voronoi from ") + typeid(T).name() + (isSpatialSort ? " (spatial sort)" : ""));
         sw->start();
 
         geos::triangulate::VoronoiDiagramBuilder vdb;
+        vdb.setSpatialSort(isSpatialSort);
         vdb.setSites(sites);
 
         auto result = vdb.getDiagram(*gfact);
@@ -65,12 +71,27 @@ private:
         std::cout << sw->name << ": " << result->getNumGeometries() << ": " << *sw << std::endl;
     }
 
+    void partitionedVoronoi(const geos::geom::CoordinateSequence& sites, std::size_t numThreads) {
+        auto sw = profiler->get(std::string("Partitioned Voronoi, threads: ") + std::to_string(numThreads));
+        sw->start();
+
+        geos::triangulate::PartitionedVoronoiDiagramBuilder vdb;
+        vdb.setSites(sites);
+        vdb.setNumThreads(numThreads);
+
+        auto result = vdb.getDiagram(*gfact);
+
+        sw->stop();
+        std::cout << sw->name << ": " << result->getNumGeometries() << ": " << *sw << std::endl;
+    }
+
     template<typename T>
-    void delaunay(const T & seq) {
-        auto sw = profiler->get(std::string("Delaunay from ") + typeid(T).name());
+    void delaunay(const T & seq, bool isSpatialSort = false) {
+        auto sw = profiler->get(std::string("Delaunay from ") + typeid(T).name() + (isSpatialSort ? " (spatial sort)" : ""));
         sw->start();
 
         geos::triangulate::DelaunayTriangulationBuilder dtb;
+        dtb.setSpatialSort(isSpatialSort);
         dtb.setSites(seq);
 
         auto result = dtb.getTriangles(*gfact);
@@ -0,0 +1,96 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+/*
+ * Compares exporting polygons to GeoArrow buffers with GEOSGeom_toGeoArrow
+ * and by walking the coordinate sequences of each ring.
+ */
+
+#include <geos_c.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+static std::vector<GEOSGeometry*> create_polygons(std::size_t numGeoms, std::size_t numPoints)
+{
+    std::vector<GEOSGeometry*> geoms;
+    for (std::size_t i = 0; i < numGeoms; i++) {
+        GEOSCoordSequence* seq = GEOSCoordSeq_create(static_cast<unsigned int>(numPoints + 1), 2);
+        for (std::size_t j = 0; j < numPoints; j++) {
+            double a = 2 * M_PI * static_cast<double>(j) / static_cast<double>(numPoints);
+            GEOSCoordSeq_setXY(seq, static_cast<unsigned int>(j), static_cast<double>(i) + std::cos(a), std::sin(a));
+        }
+        GEOSCoordSeq_setXY(seq, static_cast<unsigned int>(numPoints), static_cast<double>(i) + 1, 0);
+        geoms.push_back(GEOSGeom_createPolygon(GEOSGeom_createLinearRing(seq), nullptr, 0));
+    }
+    return geoms;
+}
+
+static void BM_ExportByCoordSeq(benchmark::State& state) {
+    initGEOS(nullptr, nullptr);
+    auto geoms = create_polygons(static_cast<std::size_t>(state.range(0)), static_cast<std::size_t>(state.range(1)));
+
+    for (auto _ : state) {
+        std::vector<double> coords;
+        std::vector<int32_t> geomOffsets{0};
+        std::vector<int32_t> ringOffsets{0};
+        for (const GEOSGeometry* g : geoms) {
+            const GEOSCoordSequence* seq = GEOSGeom_getCoordSeq(GEOSGetExteriorRing(g));
+            unsigned int size;
+            GEOSCoordSeq_getSize(seq, &size);
+            std::size_t start = coords.size();
+            coords.resize(start + 2 * size);
+            GEOSCoordSeq_copyToBuffer(seq, coords.data() + start, 0, 0);
+            ringOffsets.push_back(static_cast<int32_t>(coords.size() / 2));
+            geomOffsets.push_back(static_cast<int32_t>(ringOffsets.size() - 1));
+        }
+        benchmark::DoNotOptimize(coords.data());
+    }
+
+    for (auto g : geoms) {
+        GEOSGeom_destroy(g);
+    }
+    finishGEOS();
+}
+
+static void BM_ExportGeoArrow(benchmark::State& state) {
+    initGEOS(nullptr, nullptr);
+    auto geoms = create_polygons(static_cast<std::size_t>(state.range(0)), static_cast<std::size_t>(state.range(1)));
+
+    for (auto _ : state) {
+        std::size_t numCoords;
+        std::size_t numOffsets[3];
+        GEOSGeom_toGeoArrow(GEOS_POLYGON, geoms.data(), geoms.size(), 0, nullptr, &numCoords, nullptr, numOffsets);
+
+        std::vector<double> coords(2 * numCoords);
+        std::vector<int32_t> geomOffsets(numOffsets[0]);
+        std::vector<int32_t> ringOffsets(numOffsets[1]);
+        int32_t* offsets[] = { geomOffsets.data(), ringOffsets.data() };
+        GEOSGeom_toGeoArrow(GEOS_POLYGON, geoms.data(), geoms.size(), 0, coords.data(), &numCoords, offsets, numOffsets);
+        benchmark::DoNotOptimize(coords.data());
+    }
+
+    for (auto g : geoms) {
+        GEOSGeom_destroy(g);
+    }
+    finishGEOS();
+}
+
+BENCHMARK(BM_ExportByCoordSeq)->Args({100000, 10})->Args({1000, 1000});
+BENCHMARK(BM_ExportGeoArrow)->Args({100000, 10})->Args({1000, 1000});
+
+BENCHMARK_MAIN();
@@ -0,0 +1,157 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+/*
+ * Measures the time and the number of heap allocations of operations
+ * that compute geometry envelopes: STRtree construction, PreparedGeometry
+ * creation and GEOSIntersects_r.
+ */
+
+#include <geos/profiler.h>
+#include <geos_c.h>
+
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/prep/PreparedGeometryFactory.h>
+#include <geos/geom/util/SineStarFactory.h>
+#include <geos/index/strtree/TemplateSTRtree.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+static std::size_t numAllocations = 0;
+
+void* operator new(std::size_t size)
+{
+    numAllocations++;
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+using namespace geos::geom;
+
+class GeometryEnvelopePerfTest {
+
+public:
+    GeometryEnvelopePerfTest(std::size_t num_geoms, std::size_t num_points)
+        : numGeoms(num_geoms)
+        , numPoints(num_points)
+    {}
+
+    void testSTRtree()
+    {
+        auto geoms = createPolygons();
+        geos::util::Profile sw("STRtree build");
+        std::size_t allocations = numAllocations;
+        sw.start();
+        geos::index::strtree::TemplateSTRtree<const Geometry*> tree;
+        for (const auto& g : geoms) {
+            tree.insert(g.get());
+        }
+        tree.build();
+        sw.stop();
+        report(sw, numAllocations - allocations);
+    }
+
+    void testPrepare()
+    {
+        auto geoms = createPolygons();
+        geos::util::Profile sw("PreparedGeometry creation");
+        std::size_t allocations = numAllocations;
+        sw.start();
+        for (const auto& g : geoms) {
+            auto prep = geos::geom::prep::PreparedGeometryFactory::prepare(g.get());
+        }
+        sw.stop();
+        report(sw, numAllocations - allocations);
+    }
+
+    void testIntersects()
+    {
+        auto geoms = createPolygons();
+        GEOSContextHandle_t handle = GEOS_init_r();
+        geos::util::Profile sw("GEOSIntersects_r");
+        std::size_t hits = 0;
+        std::size_t allocations = numAllocations;
+        sw.start();
+        for (std::size_t i = 1; i < geoms.size(); i++) {
+            auto a = reinterpret_cast<const GEOSGeometry*>(geoms[i - 1].get());
+            auto b = reinterpret_cast<const GEOSGeometry*>(geoms[i].get());
+            hits += static_cast<std::size_t>(GEOSIntersects_r(handle, a, b) == 1);
+        }
+        sw.stop();
+        report(sw, numAllocations - allocations);
+        std::cout << "  " << hits << " intersecting pairs" << std::endl;
+        GEOS_finish_r(handle);
+    }
+
+private:
+    std::size_t numGeoms;
+    std::size_t numPoints;
+    GeometryFactory::Ptr factory = GeometryFactory::create();
+
+    std::vector<std::unique_ptr<Geometry>> createPolygons()
+    {
+        std::default_random_engine e(12345);
+        std::uniform_real_distribution<> dis(0, 100);
+
+        std::vector<std::unique_ptr<Geometry>> geoms;
+        geoms.reserve(numGeoms);
+        for (std::size_t i = 0; i < numGeoms; i++) {
+            util::SineStarFactory ssf(factory.get());
+            ssf.setCentre(Coordinate(dis(e), dis(e)));
+            ssf.setSize(2);
+            ssf.setNumPoints(static_cast<uint32_t>(numPoints));
+            ssf.setArmLengthRatio(0.3);
+            ssf.setNumArms(5);
+            geoms.push_back(ssf.createSineStar());
+        }
+        return geoms;
+    }
+
+    static void report(const geos::util::Profile& sw, std::size_t allocations)
+    {
+        std::cout << sw.name << ": " << sw.getTot() << " us, "
+                  << allocations << " allocations" << std::endl;
+    }
+};
+
+int main(int argc, char** argv) {
+    std::size_t numGeoms = 100000;
+    if (argc > 1) {
+        numGeoms = static_cast<std::size_t>(std::stoul(argv[1]));
+    }
+    GeometryEnvelopePerfTest tester(numGeoms, 20);
+    tester.testSTRtree();
+    tester.testPrepare();
+    tester.testIntersects();
+}
@@ -0,0 +1,196 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+/*
+ * Compares CoordinateArraySequence and FlatCoordinateSequence on the
+ * operations of GEOSCoordSeqPerfTest (filling from a buffer, reading every
+ * coordinate) and on the Length, Area and envelope loops.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <geos/algorithm/Area.h>
+#include <geos/algorithm/Length.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/FlatCoordinateSequence.h>
+
+#include <cmath>
+#include <vector>
+
+using geos::geom::Coordinate;
+using geos::geom::CoordinateArraySequence;
+using geos::geom::CoordinateLayout;
+using geos::geom::FlatCoordinateSequence;
+
+static std::vector<double> create_buffer(std::size_t N, std::size_t dim) {
+    // a closed ring, so that the area is meaningful
+    std::vector<double> buf(dim * N);
+    for (std::size_t i = 0; i < N; i++) {
+        double angle = 2 * M_PI * static_cast<double>(i) / static_cast<double>(N - 1);
+        buf[i * dim] = std::cos(angle);
+        buf[i * dim + 1] = std::sin(angle);
+        if (dim == 3) {
+            buf[i * dim + 2] = static_cast<double>(i);
+        }
+    }
+    return buf;
+}
+
+static CoordinateLayout layout(std::size_t dim) {
+    return dim == 3 ? CoordinateLayout::XYZ : CoordinateLayout::XY;
+}
+
+static CoordinateArraySequence create_array_seq(const std::vector<double>& buf, std::size_t N, std::size_t dim) {
+    CoordinateArraySequence seq(N, dim);
+    for (std::size_t i = 0; i < N; i++) {
+        Coordinate c(buf[i * dim], buf[i * dim + 1]);
+        if (dim == 3) {
+            c.z = buf[i * dim + 2];
+        }
+        seq.setAt(c, i);
+    }
+    return seq;
+}
+
+template<std::size_t N, std::size_t dim>
+static void BM_ArraySeq_CopyFromBuffer(benchmark::State& state) {
+    auto buf = create_buffer(N, dim);
+    for (auto _ : state) {
+        auto seq = create_array_seq(buf, N, dim);
+        benchmark::DoNotOptimize(seq);
+    }
+}
+
+template<std::size_t N, std::size_t dim>
+static void BM_FlatSeq_CopyFromBuffer(benchmark::State& state) {
+    auto buf = create_buffer(N, dim);
+    for (auto _ : state) {
+        FlatCoordinateSequence seq(buf.data(), N, layout(dim));
+        benchmark::DoNotOptimize(seq);
+    }
+}
+
+template<std::size_t N, std::size_t dim>
+static void BM_ArraySeq_CopyByCoordinate(benchmark::State& state) {
+    auto buf = create_buffer(N, dim);
+    auto seq = create_array_seq(buf, N, dim);
+    const geos::geom::CoordinateSequence& cs = seq;
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < N; i++) {
+            double x = cs.getX(i);
+            double y = cs.getY(i);
+            benchmark::DoNotOptimize(x);
+            benchmark::DoNotOptimize(y);
+        }
+    }
+}
+
+template<std::size_t N, std::size_t dim>
+static void BM_FlatSeq_CopyByCoordinate(benchmark::State& state) {
+    auto buf = create_buffer(N, dim);
+    FlatCoordinateSequence seq(buf.data(), N, layout(dim));
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < N; i++) {
+            double x = seq.getX(i);
+            double y = seq.getY(i);
+            benchmark::DoNotOptimize(x);
+            benchmark::DoNotOptimize(y);
+        }
+    }
+}
+
+template<std::size_t N, std::size_t dim>
+static void BM_ArraySeq_Length(benchmark::State& state) {
+    auto seq = create_array_seq(create_buffer(N, dim), N, dim);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(geos::algorithm::Length::ofLine(&seq));
+    }
+}
+
+template<std::size_t N, std::size_t dim>
+static void BM_FlatSeq_Length(benchmark::State& state) {
+    auto buf = create_buffer(N, dim);
+    FlatCoordinateSequence seq(buf.data(), N, layout(dim));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(geos::algorithm::Length::ofLine(seq));
+    }
+}
+
+template<std::size_t N, std::size_t dim>
+static void BM_ArraySeq_Area(benchmark::State& state) {
+    auto seq = create_array_seq(create_buffer(N, dim), N, dim);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(geos::algorithm::Area::ofRingSigned(&seq));
+    }
+}
+
+template<std::size_t N, std::size_t dim>
+static void BM_FlatSeq_Area(benchmark::State& state) {
+    auto buf = create_buffer(N, dim);
+    FlatCoordinateSequence seq(buf.data(), N, layout(dim));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(geos::algorithm::Area::ofRingSigned(seq));
+    }
+}
+
+template<std::size_t N, std::size_t dim>
+static void BM_ArraySeq_Envelope(benchmark::State& state) {
+    auto seq = create_array_seq(create_buffer(N, dim), N, dim);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(seq.getEnvelope());
+    }
+}
+
+template<std::size_t N, std::size_t dim>
+static void BM_FlatSeq_Envelope(benchmark::State& state) {
+    auto buf = create_buffer(N, dim);
+    FlatCoordinateSequence seq(buf.data(), N, layout(dim));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(seq.getEnvelope());
+    }
+}
+
+// N = 1,000
+BENCHMARK_TEMPLATE(BM_ArraySeq_CopyFromBuffer, 1000, 2);
+BENCHMARK_TEMPLATE(BM_FlatSeq_CopyFromBuffer, 1000, 2);
+BENCHMARK_TEMPLATE(BM_ArraySeq_CopyFromBuffer, 1000, 3);
+BENCHMARK_TEMPLATE(BM_FlatSeq_CopyFromBuffer, 1000, 3);
+
+BENCHMARK_TEMPLATE(BM_ArraySeq_CopyByCoordinate, 1000, 2);
+BENCHMARK_TEMPLATE(BM_FlatSeq_CopyByCoordinate, 1000, 2);
+
+BENCHMARK_TEMPLATE(BM_ArraySeq_Length, 1000, 2);
+BENCHMARK_TEMPLATE(BM_FlatSeq_Length, 1000, 2);
+BENCHMARK_TEMPLATE(BM_ArraySeq_Area, 1000, 2);
+BENCHMARK_TEMPLATE(BM_FlatSeq_Area, 1000, 2);
+BENCHMARK_TEMPLATE(BM_ArraySeq_Envelope, 1000, 2);
+BENCHMARK_TEMPLATE(BM_FlatSeq_Envelope, 1000, 2);
+
+// N = 100,000
+BENCHMARK_TEMPLATE(BM_ArraySeq_CopyFromBuffer, 100000, 2);
+BENCHMARK_TEMPLATE(BM_FlatSeq_CopyFromBuffer, 100000, 2);
+BENCHMARK_TEMPLATE(BM_ArraySeq_CopyFromBuffer, 100000, 3);
+BENCHMARK_TEMPLATE(BM_FlatSeq_CopyFromBuffer, 100000, 3);
+
+BENCHMARK_TEMPLATE(BM_ArraySeq_CopyByCoordinate, 100000, 2);
+BENCHMARK_TEMPLATE(BM_FlatSeq_CopyByCoordinate, 100000, 2);
+
+BENCHMARK_TEMPLATE(BM_ArraySeq_Length, 100000, 2);
+BENCHMARK_TEMPLATE(BM_FlatSeq_Length, 100000, 2);
+BENCHMARK_TEMPLATE(BM_ArraySeq_Area, 100000, 2);
+BENCHMARK_TEMPLATE(BM_FlatSeq_Area, 100000, 2);
+BENCHMARK_TEMPLATE(BM_ArraySeq_Envelope, 100000, 2);
+BENCHMARK_TEMPLATE(BM_FlatSeq_Envelope, 100000, 2);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,75 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/Polygon.h>
+
+#include <cmath>
+#include <memory>
+
+using namespace geos::geom;
+
+static std::unique_ptr<Polygon> create_polygon(std::size_t N) {
+    auto gfact = GeometryFactory::getDefaultInstance();
+    auto seq = geos::detail::make_unique<CoordinateArraySequence>(N, 2u);
+    for (std::size_t i = 0; i < N - 1; i++) {
+        double angle = 2 * M_PI * static_cast<double>(i) / static_cast<double>(N - 1);
+        seq->setAt(Coordinate(std::cos(angle), std::sin(angle)), i);
+    }
+    seq->setAt(seq->getAt(0), N - 1);
+    return gfact->createPolygon(gfact->createLinearRing(std::move(seq)));
+}
+
+template<std::size_t N>
+static void BM_Polygon_Clone(benchmark::State& state) {
+    auto poly = create_polygon(N);
+    for (auto _ : state) {
+        auto copy = poly->clone();
+        benchmark::DoNotOptimize(copy);
+    }
+}
+
+template<std::size_t N>
+static void BM_Polygon_CloneAndRead(benchmark::State& state) {
+    auto poly = create_polygon(N);
+    for (auto _ : state) {
+        auto copy = poly->clone();
+        benchmark::DoNotOptimize(copy->getArea());
+    }
+}
+
+template<std::size_t N>
+static void BM_Polygon_CloneAndModify(benchmark::State& state) {
+    auto poly = create_polygon(N);
+    for (auto _ : state) {
+        auto copy = poly->clone();
+        auto ring = static_cast<const Polygon*>(copy.get())->getExteriorRing();
+        const_cast<CoordinateSequence*>(ring->getCoordinatesRO())->setOrdinate(1, CoordinateSequence::X, 0.5);
+        benchmark::DoNotOptimize(copy);
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_Polygon_Clone, 1000);
+BENCHMARK_TEMPLATE(BM_Polygon_CloneAndRead, 1000);
+BENCHMARK_TEMPLATE(BM_Polygon_CloneAndModify, 1000);
+
+BENCHMARK_TEMPLATE(BM_Polygon_Clone, 1000000);
+BENCHMARK_TEMPLATE(BM_Polygon_CloneAndRead, 1000000);
+BENCHMARK_TEMPLATE(BM_Polygon_CloneAndModify, 1000000);
+
+BENCHMARK_MAIN();
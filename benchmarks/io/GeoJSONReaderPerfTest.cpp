@@ -0,0 +1,98 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/io/GeoJSONReader.h>
+#include <geos/io/GeoJSONStreamReader.h>
+#include <geos/profiler.h>
+
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+
+using geos::io::GeoJSONReader;
+using geos::io::GeoJSONStreamReader;
+
+class GeoJSONReaderPerfTest {
+
+public:
+    void test(const std::string& name, const std::string& text) {
+        std::cout << name << ": " << text.size() / 1000000.0 << " MB" << std::endl;
+
+        std::size_t numCoords = 0;
+        auto sw = profiler->get(name + " GeoJSONReader::readFeatures");
+        sw->start();
+        GeoJSONReader reader;
+        auto features = reader.readFeatures(text);
+        for (const auto& feature : features.getFeatures()) {
+            numCoords += feature.getGeometry()->getNumPoints();
+        }
+        sw->stop();
+        report(*sw, text.size(), numCoords);
+
+        numCoords = 0;
+        sw = profiler->get(name + " GeoJSONStreamReader");
+        sw->start();
+        std::istringstream is(text);
+        GeoJSONStreamReader streamReader(is);
+        while (auto feature = streamReader.next()) {
+            numCoords += feature->getGeometry()->getNumPoints();
+        }
+        sw->stop();
+        report(*sw, text.size(), numCoords);
+
+        std::cout << std::endl;
+    }
+
+    std::string createPolygons(std::size_t num_geoms, std::size_t num_points) {
+        std::ostringstream ss;
+        ss.precision(15);
+        ss << "{\"type\":\"FeatureCollection\",\"features\":[";
+        for (std::size_t i = 0; i < num_geoms; i++) {
+            double x = dis(e);
+            double y = dis(e);
+            ss << (i ? "," : "") << "{\"type\":\"Feature\",\"properties\":{\"id\":" << i
+               << ",\"name\":\"polygon " << i << "\"},\"geometry\":{\"type\":\"Polygon\",\"coordinates\":[[";
+            for (std::size_t j = 0; j <= num_points; j++) {
+                double angle = 2 * M_PI * static_cast<double>(j % num_points) / static_cast<double>(num_points);
+                ss << (j ? "," : "") << "[" << x + std::cos(angle) << "," << y + std::sin(angle) << "]";
+            }
+            ss << "]]}}";
+        }
+        ss << "]}";
+        return ss.str();
+    }
+
+private:
+    geos::util::Profiler* profiler = geos::util::Profiler::instance();
+    std::default_random_engine e{12345};
+    std::uniform_real_distribution<> dis{-180, 180};
+
+    static void report(const geos::util::Profile& sw, std::size_t numBytes, std::size_t numCoords) {
+        // bytes per microsecond
+        double mbPerSec = static_cast<double>(numBytes) / sw.getTot();
+        std::cout << sw.name << ": " << numCoords << ": " << sw << " (" << mbPerSec << " MB/s)" << std::endl;
+    }
+};
+
+int main(int argc, char** argv) {
+    GeoJSONReaderPerfTest tester;
+
+    std::size_t numGeoms = 10000;
+    if (argc > 1) {
+        numGeoms = static_cast<std::size_t>(std::stoul(argv[1]));
+    }
+    tester.test("Polygons", tester.createPolygons(numGeoms, 100));
+}
@@ -0,0 +1,121 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/io/GeoJSONStreamWriter.h>
+#include <geos/io/GeoJSONWriter.h>
+#include <geos/io/Writer.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/Polygon.h>
+#include <geos/profiler.h>
+
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace geos::geom;
+using geos::io::GeoJSONStreamWriter;
+using geos::io::GeoJSONType;
+using geos::io::GeoJSONWriter;
+using geos::io::Writer;
+
+class GeoJSONWriterPerfTest {
+
+public:
+    void test(const std::string& name, int precision) {
+        std::cout << name << std::endl;
+
+        GeoJSONWriter writer;
+        writer.setRoundingPrecision(precision);
+
+        std::size_t numBytes = 0;
+        auto sw = profiler->get(name + " write()");
+        sw->start();
+        for (const auto& poly : polys) {
+            numBytes += writer.write(poly.get()).size();
+        }
+        sw->stop();
+        report(*sw, numBytes);
+
+        numBytes = 0;
+        sw = profiler->get(name + " write(Writer*)");
+        sw->start();
+        Writer buffer;
+        for (const auto& poly : polys) {
+            buffer.clear();
+            writer.write(poly.get(), &buffer);
+            numBytes += buffer.getLength();
+        }
+        sw->stop();
+        report(*sw, numBytes);
+
+        sw = profiler->get(name + " GeoJSONStreamWriter");
+        sw->start();
+        std::ostringstream os;
+        GeoJSONStreamWriter streamWriter(os, writer);
+        for (const auto& poly : polys) {
+            streamWriter.write(poly.get());
+        }
+        streamWriter.finish();
+        sw->stop();
+        report(*sw, os.str().size());
+
+        std::cout << std::endl;
+    }
+
+    void createPolygons(std::size_t num_geoms, std::size_t num_points) {
+        std::default_random_engine e(12345);
+        std::uniform_real_distribution<> dis(-180, 180);
+
+        for (std::size_t i = 0; i < num_geoms; i++) {
+            double x = dis(e);
+            double y = dis(e);
+            CoordinateArraySequence seq;
+            for (std::size_t j = 0; j < num_points; j++) {
+                double angle = 2 * M_PI * static_cast<double>(j) / static_cast<double>(num_points);
+                seq.add(Coordinate(x + std::cos(angle) + dis(e) / 1000, y + std::sin(angle) + dis(e) / 1000));
+            }
+            seq.closeRing();
+            polys.push_back(gfact->createPolygon(gfact->createLinearRing(seq.clone())));
+        }
+    }
+
+private:
+    decltype(GeometryFactory::create()) gfact = GeometryFactory::create();
+    geos::util::Profiler* profiler = geos::util::Profiler::instance();
+    std::vector<std::unique_ptr<Polygon>> polys;
+
+    static void report(const geos::util::Profile& sw, std::size_t numBytes) {
+        // bytes per microsecond
+        double mbPerSec = static_cast<double>(numBytes) / sw.getTot();
+        std::cout << sw.name << ": " << sw << " (" << mbPerSec << " MB/s)" << std::endl;
+    }
+};
+
+int main(int argc, char** argv) {
+    GeoJSONWriterPerfTest tester;
+
+    std::size_t numGeoms = 10000;
+    if (argc > 1) {
+        numGeoms = static_cast<std::size_t>(std::stoul(argv[1]));
+    }
+    tester.createPolygons(numGeoms, 100);
+    tester.test("Full precision", -1);
+    tester.test("6 decimals", 6);
+}
@@ -0,0 +1,128 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+/*
+ * Compares the size and the encoding and decoding times of WKB and TWKB.
+ */
+
+#include <geos/io/TWKBReader.h>
+#include <geos/io/TWKBWriter.h>
+#include <geos/io/WKBReader.h>
+#include <geos/io/WKBWriter.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/Polygon.h>
+#include <geos/profiler.h>
+
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace geos::geom;
+
+class TWKBPerfTest {
+
+public:
+    void testWKB() {
+        geos::io::WKBWriter writer;
+        std::vector<std::string> encoded;
+        std::size_t numBytes = 0;
+
+        auto sw = profiler->get("WKB write");
+        sw->start();
+        for (const auto& poly : polys) {
+            std::ostringstream os(std::ios_base::binary);
+            writer.write(*poly, os);
+            encoded.push_back(os.str());
+            numBytes += encoded.back().size();
+        }
+        sw->stop();
+        std::cout << sw->name << ": " << *sw << " (" << numBytes << " bytes)" << std::endl;
+
+        geos::io::WKBReader reader(*gfact);
+        std::size_t numPoints = 0;
+        sw = profiler->get("WKB read");
+        sw->start();
+        for (const auto& wkb : encoded) {
+            numPoints += reader.read(reinterpret_cast<const unsigned char*>(wkb.data()), wkb.size())->getNumPoints();
+        }
+        sw->stop();
+        std::cout << sw->name << ": " << *sw << " (" << numPoints << " points)" << std::endl;
+    }
+
+    void testTWKB(int precision) {
+        geos::io::TWKBWriter writer(precision);
+        std::vector<std::vector<unsigned char>> encoded(polys.size());
+        std::size_t numBytes = 0;
+
+        auto sw = profiler->get("TWKB write, precision " + std::to_string(precision));
+        sw->start();
+        for (std::size_t i = 0; i < polys.size(); i++) {
+            writer.write(*polys[i], encoded[i]);
+            numBytes += encoded[i].size();
+        }
+        sw->stop();
+        std::cout << sw->name << ": " << *sw << " (" << numBytes << " bytes)" << std::endl;
+
+        geos::io::TWKBReader reader(*gfact);
+        std::size_t numPoints = 0;
+        sw = profiler->get("TWKB read, precision " + std::to_string(precision));
+        sw->start();
+        for (const auto& twkb : encoded) {
+            numPoints += reader.read(twkb.data(), twkb.size())->getNumPoints();
+        }
+        sw->stop();
+        std::cout << sw->name << ": " << *sw << " (" << numPoints << " points)" << std::endl;
+    }
+
+    void createPolygons(std::size_t num_geoms, std::size_t num_points) {
+        std::default_random_engine e(12345);
+        std::uniform_real_distribution<> dis(-180, 180);
+
+        for (std::size_t i = 0; i < num_geoms; i++) {
+            double x = dis(e);
+            double y = dis(e);
+            CoordinateArraySequence seq;
+            for (std::size_t j = 0; j < num_points; j++) {
+                double angle = 2 * M_PI * static_cast<double>(j) / static_cast<double>(num_points);
+                seq.add(Coordinate(x + std::cos(angle) + dis(e) / 1000, y + std::sin(angle) + dis(e) / 1000));
+            }
+            seq.closeRing();
+            polys.push_back(gfact->createPolygon(gfact->createLinearRing(seq.clone())));
+        }
+    }
+
+private:
+    decltype(GeometryFactory::create()) gfact = GeometryFactory::create();
+    geos::util::Profiler* profiler = geos::util::Profiler::instance();
+    std::vector<std::unique_ptr<Polygon>> polys;
+};
+
+int main(int argc, char** argv) {
+    TWKBPerfTest tester;
+
+    std::size_t numGeoms = 10000;
+    if (argc > 1) {
+        numGeoms = static_cast<std::size_t>(std::stoul(argv[1]));
+    }
+    tester.createPolygons(numGeoms, 100);
+    tester.testWKB();
+    tester.testTWKB(6);
+    tester.testTWKB(3);
+}
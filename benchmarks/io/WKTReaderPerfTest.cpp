@@ -0,0 +1,131 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/io/WKTBufferReader.h>
+#include <geos/io/WKTReader.h>
+#include <geos/io/WKTWriter.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/Point.h>
+#include <geos/geom/Polygon.h>
+#include <geos/profiler.h>
+
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace geos::geom;
+using geos::io::WKTBufferReader;
+using geos::io::WKTReader;
+using geos::io::WKTWriter;
+
+class WKTReaderPerfTest {
+
+public:
+    void test(const std::string& name, const std::vector<std::string>& wkts) {
+        std::string text;
+        for (const auto& wkt : wkts) {
+            text += wkt;
+            text += '\n';
+        }
+        std::cout << name << ": " << wkts.size() << " geometries, "
+                  << text.size() / 1000000.0 << " MB" << std::endl;
+
+        std::size_t numCoords = 0;
+        auto sw = profiler->get(name + " WKTReader");
+        sw->start();
+        WKTReader reader;
+        for (const auto& wkt : wkts) {
+            numCoords += reader.read(wkt)->getNumPoints();
+        }
+        sw->stop();
+        report(*sw, text.size(), numCoords);
+
+        numCoords = 0;
+        sw = profiler->get(name + " WKTBufferReader");
+        sw->start();
+        WKTBufferReader bufferReader;
+        for (const auto& wkt : wkts) {
+            numCoords += bufferReader.read(wkt)->getNumPoints();
+        }
+        sw->stop();
+        report(*sw, text.size(), numCoords);
+
+        numCoords = 0;
+        sw = profiler->get(name + " WKTBufferReader::readNext");
+        sw->start();
+        std::size_t pos = 0;
+        while (auto g = bufferReader.readNext(text, pos)) {
+            numCoords += g->getNumPoints();
+        }
+        sw->stop();
+        report(*sw, text.size(), numCoords);
+
+        std::cout << std::endl;
+    }
+
+    std::vector<std::string> createPoints(std::size_t num_geoms) {
+        std::vector<std::string> wkts;
+        for (std::size_t i = 0; i < num_geoms; i++) {
+            std::unique_ptr<Point> pt(gfact->createPoint(Coordinate(dis(e), dis(e))));
+            wkts.push_back(writer.write(pt.get()));
+        }
+        return wkts;
+    }
+
+    std::vector<std::string> createPolygons(std::size_t num_geoms, std::size_t num_points) {
+        std::vector<std::string> wkts;
+        for (std::size_t i = 0; i < num_geoms; i++) {
+            double x = dis(e);
+            double y = dis(e);
+            CoordinateArraySequence seq;
+            for (std::size_t j = 0; j < num_points; j++) {
+                double angle = 2 * M_PI * static_cast<double>(j) / static_cast<double>(num_points);
+                seq.add(Coordinate(x + std::cos(angle) + dis(e) / 1000, y + std::sin(angle) + dis(e) / 1000));
+            }
+            seq.closeRing();
+            auto poly = gfact->createPolygon(gfact->createLinearRing(seq.clone()));
+            wkts.push_back(writer.write(poly.get()));
+        }
+        return wkts;
+    }
+
+private:
+    decltype(GeometryFactory::create()) gfact = GeometryFactory::create();
+    geos::util::Profiler* profiler = geos::util::Profiler::instance();
+    std::default_random_engine e{12345};
+    std::uniform_real_distribution<> dis{-180, 180};
+    WKTWriter writer;
+
+    static void report(const geos::util::Profile& sw, std::size_t numBytes, std::size_t numCoords) {
+        // bytes per microsecond
+        double mbPerSec = static_cast<double>(numBytes) / sw.getTot();
+        std::cout << sw.name << ": " << numCoords << ": " << sw << " (" << mbPerSec << " MB/s)" << std::endl;
+    }
+};
+
+int main(int argc, char** argv) {
+    WKTReaderPerfTest tester;
+
+    std::size_t numGeoms = 100000;
+    if (argc > 1) {
+        numGeoms = static_cast<std::size_t>(std::stoul(argv[1]));
+    }
+    tester.test("Points", tester.createPoints(numGeoms));
+    tester.test("Polygons", tester.createPolygons(numGeoms / 10, 100));
+}
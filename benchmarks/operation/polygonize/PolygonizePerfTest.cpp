@@ -0,0 +1,133 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/operation/polygonize/ParallelPolygonizer.h>
+#include <geos/operation/polygonize/Polygonizer.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/Polygon.h>
+#include <geos/profiler.h>
+
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace geos::geom;
+using geos::operation::polygonize::ParallelPolygonizer;
+using geos::operation::polygonize::Polygonizer;
+
+class PolygonizePerfTest {
+
+public:
+    void test(std::size_t num_lines) {
+        std::cout << "Lines: " << num_lines << std::endl;
+
+        auto lines = createNetwork(num_lines);
+        std::vector<const Geometry*> geoms;
+        for (const auto& line : lines) {
+            geoms.push_back(line.get());
+        }
+
+        auto sw = profiler->get("Polygonizer");
+        sw->start();
+        Polygonizer polygonizer;
+        polygonizer.add(&geoms);
+        auto polys = polygonizer.getPolygons();
+        sw->stop();
+        std::cout << sw->name << ": " << polys.size() << ": " << *sw << std::endl;
+
+        for (std::size_t numThreads : { 1, 0 }) {
+            sw = profiler->get("ParallelPolygonizer " + std::to_string(numThreads));
+            sw->start();
+            ParallelPolygonizer parPolygonizer;
+            parPolygonizer.setNumThreads(numThreads);
+            parPolygonizer.add(geoms);
+            polys = parPolygonizer.getPolygons();
+            sw->stop();
+            std::cout << sw->name << ": " << polys.size() << ": " << *sw << std::endl;
+        }
+
+        std::cout << std::endl;
+    }
+
+private:
+    decltype(GeometryFactory::create()) gfact = GeometryFactory::create();
+    geos::util::Profiler* profiler = geos::util::Profiler::instance();
+
+    /**
+     * A noded network of curved streets on a jittered grid,
+     * with some cells split by a diagonal and some dead ends.
+     */
+    std::vector<std::unique_ptr<LineString>> createNetwork(std::size_t num_lines) {
+        std::default_random_engine e(12345);
+        std::uniform_real_distribution<> dis(-0.2, 0.2);
+
+        std::size_t numSide = static_cast<std::size_t>(std::sqrt(static_cast<double>(num_lines) / 2));
+        std::vector<Coordinate> nodes;
+        for (std::size_t i = 0; i <= numSide; i++) {
+            for (std::size_t j = 0; j <= numSide; j++) {
+                nodes.emplace_back(static_cast<double>(i) + dis(e), static_cast<double>(j) + dis(e));
+            }
+        }
+        auto node = [&](std::size_t i, std::size_t j) -> const Coordinate& {
+            return nodes[i * (numSide + 1) + j];
+        };
+
+        std::vector<std::unique_ptr<LineString>> lines;
+        auto addLine = [&](const Coordinate& p0, const Coordinate& p1) {
+            CoordinateArraySequence seq;
+            seq.add(p0);
+            for (int k = 1; k < 4; k++) {
+                double f = k / 4.0;
+                seq.add(Coordinate(p0.x + f * (p1.x - p0.x) + dis(e) / 10, p0.y + f * (p1.y - p0.y) + dis(e) / 10));
+            }
+            seq.add(p1);
+            lines.push_back(gfact->createLineString(seq.clone()));
+        };
+
+        for (std::size_t i = 0; i <= numSide; i++) {
+            for (std::size_t j = 0; j <= numSide; j++) {
+                if (i < numSide) {
+                    addLine(node(i, j), node(i + 1, j));
+                }
+                if (j < numSide) {
+                    addLine(node(i, j), node(i, j + 1));
+                }
+                if (i < numSide && j < numSide && (i + j) % 7 == 0) {
+                    addLine(node(i, j), node(i + 1, j + 1));
+                }
+                if (i < numSide && j < numSide && (i * j) % 11 == 0) {
+                    Coordinate p = node(i, j);
+                    addLine(p, Coordinate(p.x + 0.3, p.y + 0.5));
+                }
+            }
+        }
+        return lines;
+    }
+};
+
+int main(int argc, char** argv) {
+    PolygonizePerfTest tester;
+
+    std::size_t maxSize = 1000000;
+    if (argc > 1) {
+        maxSize = static_cast<std::size_t>(std::stoul(argv[1]));
+    }
+    for (std::size_t size = 10000; size <= maxSize; size *= 10) {
+        tester.test(size);
+    }
+}
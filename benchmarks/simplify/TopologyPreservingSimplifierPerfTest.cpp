@@ -0,0 +1,108 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/simplify/TopologyPreservingSimplifier.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/MultiLineString.h>
+#include <geos/profiler.h>
+
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * Simplifies a synthetic road network: a grid of noisy lines,
+ * each running between two adjacent grid nodes, so that lines
+ * touch at their endpoints.
+ */
+class TopologyPreservingSimplifierPerfTest {
+
+public:
+    void test(std::size_t gridSize, std::size_t pointsPerLine) {
+        using namespace geos::geom;
+
+        std::default_random_engine e(12345);
+        std::uniform_real_distribution<> noise(-1, 1);
+
+        const double cellSize = 100;
+        std::vector<std::unique_ptr<LineString>> lines;
+        for (std::size_t i = 0; i <= gridSize; i++) {
+            for (std::size_t j = 0; j < gridSize; j++) {
+                lines.push_back(createLine(i, j, true, cellSize, pointsPerLine, noise, e));
+                lines.push_back(createLine(i, j, false, cellSize, pointsPerLine, noise, e));
+            }
+        }
+        auto network = gfact->createMultiLineString(std::move(lines));
+
+        std::cout << "Network of " << network->getNumGeometries() << " lines with "
+                  << network->getNumPoints() << " points" << std::endl;
+
+        std::unique_ptr<Geometry> serial;
+        for (std::size_t numThreads : { 1, 2, 4, 8, 0 }) {
+            auto sw = profiler->get("TopologyPreservingSimplifier threads=" + std::to_string(numThreads));
+            sw->start();
+
+            geos::simplify::TopologyPreservingSimplifier tps(network.get());
+            tps.setDistanceTolerance(2.0);
+            tps.setNumThreads(numThreads);
+            auto result = tps.getResultGeometry();
+
+            sw->stop();
+            std::cout << sw->name << ": " << result->getNumPoints() << " points: " << *sw << std::endl;
+
+            if (!serial) {
+                serial = std::move(result);
+            }
+            else if (!serial->equalsExact(result.get())) {
+                std::cout << "  result differs from serial result!" << std::endl;
+            }
+        }
+    }
+
+private:
+    decltype(geos::geom::GeometryFactory::create()) gfact = geos::geom::GeometryFactory::create();
+    geos::util::Profiler* profiler = geos::util::Profiler::instance();
+
+    template<typename Dist, typename Engine>
+    std::unique_ptr<geos::geom::LineString>
+    createLine(std::size_t i, std::size_t j, bool isHorizontal, double cellSize,
+               std::size_t numPoints, Dist& noise, Engine& e)
+    {
+        using geos::geom::Coordinate;
+
+        std::vector<Coordinate> pts(numPoints);
+        for (std::size_t k = 0; k < numPoints; k++) {
+            double along = cellSize * (static_cast<double>(j) + static_cast<double>(k) / static_cast<double>(numPoints - 1));
+            double across = cellSize * static_cast<double>(i);
+            if (k > 0 && k + 1 < numPoints) {
+                across += noise(e);
+            }
+            pts[k] = isHorizontal ? Coordinate(along, across) : Coordinate(across, along);
+        }
+        return gfact->createLineString(std::move(pts));
+    }
+};
+
+int main(int argc, char** argv) {
+    TopologyPreservingSimplifierPerfTest tester;
+
+    auto gridSize = argc > 1 ? std::atol(argv[1]) : 100;
+    auto pointsPerLine = argc > 2 ? std::atol(argv[2]) : 200;
+
+    tester.test(static_cast<std::size_t>(gridSize), static_cast<std::size_t>(pointsPerLine));
+}
@@ -23,6 +23,8 @@
 #include <geos/io/WKBWriter.h>
 #include <geos/io/GeoJSONReader.h>
 #include <geos/io/GeoJSONWriter.h>
+#include <geos/io/TWKBReader.h>
+#include <geos/io/TWKBWriter.h>
 #include <geos/util/Interrupt.h>
 
 #include <stdexcept>
@@ -43,6 +45,8 @@
 #define GEOSWKBWriter geos::io::WKBWriter
 #define GEOSGeoJSONReader geos::io::GeoJSONReader
 #define GEOSGeoJSONWriter geos::io::GeoJSONWriter
+#define GEOSTWKBReader geos::io::TWKBReader
+#define GEOSTWKBWriter geos::io::TWKBWriter
 typedef struct GEOSBufParams_t GEOSBufferParams;
 typedef struct GEOSMakeValidParams_t GEOSMakeValidParams;
 
@@ -1257,6 +1261,12 @@ extern "C" {
         return GEOSWKTWriter_write_r(handle, writer, geom);
     }
 
+    int
+    GEOSWKTWriter_writeToBuffer(WKTWriter* writer, const Geometry* geom, char* buffer, size_t size, size_t* length)
+    {
+        return GEOSWKTWriter_writeToBuffer_r(handle, writer, geom, buffer, size, length);
+    }
+
     void
     GEOSWKTWriter_setTrim(WKTWriter* writer, char trim)
     {
@@ -1432,6 +1442,68 @@ extern "C" {
         return GEOSGeoJSONWriter_writeGeometry_r(handle, writer, g, indent);
     }
 
+    /* TWKB Reader */
+    GEOSTWKBReader*
+    GEOSTWKBReader_create()
+    {
+        return GEOSTWKBReader_create_r(handle);
+    }
+
+    void
+    GEOSTWKBReader_destroy(GEOSTWKBReader* reader)
+    {
+        GEOSTWKBReader_destroy_r(handle, reader);
+    }
+
+    Geometry*
+    GEOSTWKBReader_read(GEOSTWKBReader* reader, const unsigned char* twkb, size_t size, size_t* bytesRead)
+    {
+        return GEOSTWKBReader_read_r(handle, reader, twkb, size, bytesRead);
+    }
+
+    /* TWKB Writer */
+    GEOSTWKBWriter*
+    GEOSTWKBWriter_create()
+    {
+        return GEOSTWKBWriter_create_r(handle);
+    }
+
+    void
+    GEOSTWKBWriter_destroy(GEOSTWKBWriter* writer)
+    {
+        GEOSTWKBWriter_destroy_r(handle, writer);
+    }
+
+    int
+    GEOSTWKBWriter_setPrecision(GEOSTWKBWriter* writer, int xyPrecision, int zPrecision)
+    {
+        return GEOSTWKBWriter_setPrecision_r(handle, writer, xyPrecision, zPrecision);
+    }
+
+    int
+    GEOSTWKBWriter_setOutputDimension(GEOSTWKBWriter* writer, int newDimension)
+    {
+        return GEOSTWKBWriter_setOutputDimension_r(handle, writer, newDimension);
+    }
+
+    void
+    GEOSTWKBWriter_setIncludeSize(GEOSTWKBWriter* writer, char includeSize)
+    {
+        GEOSTWKBWriter_setIncludeSize_r(handle, writer, includeSize);
+    }
+
+    void
+    GEOSTWKBWriter_setIncludeBBox(GEOSTWKBWriter* writer, char includeBBox)
+    {
+        GEOSTWKBWriter_setIncludeBBox_r(handle, writer, includeBBox);
+    }
+
+    unsigned char*
+    GEOSTWKBWriter_write(GEOSTWKBWriter* writer, const Geometry* g, size_t* size)
+    {
+        return GEOSTWKBWriter_write_r(handle, writer, g, size);
+    }
+
 
 //-----------------------------------------------------------------
 // Prepared Geometry
@@ -1578,6 +1650,29 @@ extern "C" {
         return GEOSSTRtree_nearest_generic_r(handle, tree, item, itemEnvelope, distancefn, userdata);
     }
 
+    int
+    GEOSSTRtree_queryWithinDistance(GEOSSTRtree* tree1,
+                                    GEOSSTRtree* tree2,
+                                    double maxDistance,
+                                    GEOSDistanceCallback distancefn,
+                                    GEOSQueryPairCallback callback,
+                                    void* userdata,
+                                    unsigned int numThreads)
+    {
+        return GEOSSTRtree_queryWithinDistance_r(handle, tree1, tree2, maxDistance, distancefn, callback, userdata, numThreads);
+    }
+
+    int
+    GEOSSTRtree_nearestEach(GEOSSTRtree* tree1,
+                            GEOSSTRtree* tree2,
+                            GEOSDistanceCallback distancefn,
+                            GEOSQueryPairCallback callback,
+                            void* userdata,
+                            unsigned int numThreads)
+    {
+        return GEOSSTRtree_nearestEach_r(handle, tree1, tree2, distancefn, callback, userdata, numThreads);
+    }
+
     void
     GEOSSTRtree_iterate(GEOSSTRtree* tree,
                         GEOSQueryCallback callback,
@@ -1665,6 +1760,22 @@ extern "C" {
         return GEOSGeom_createRectangle_r(handle, xmin, ymin, xmax, ymax);
     }
 
+    int
+    GEOSGeom_createFromGeoArrow(int type, const double* coords, size_t numCoords, int hasZ,
+                                const int32_t* const* offsets, size_t numGeoms,
+                                GEOSGeoArrowReleaseCallback release, void* userdata, Geometry** geoms)
+    {
+        return GEOSGeom_createFromGeoArrow_r(handle, type, coords, numCoords, hasZ, offsets, numGeoms,
+                                             release, userdata, geoms);
+    }
+
+    int
+    GEOSGeom_toGeoArrow(int type, const Geometry* const* geoms, size_t numGeoms, int hasZ,
+                        double* coords, size_t* numCoords, int32_t* const* offsets, size_t* numOffsets)
+    {
+        return GEOSGeom_toGeoArrow_r(handle, type, geoms, numGeoms, hasZ, coords, numCoords, offsets, numOffsets);
+    }
+
     int
     GEOSOrientationIndex(double Ax, double Ay, double Bx, double By,
                          double Px, double Py)
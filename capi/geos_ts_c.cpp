@@ -55,8 +55,12 @@
 #include <geos/io/WKBWriter.h>
 #include <geos/io/WKTReader.h>
 #include <geos/io/WKTWriter.h>
+#include <geos/io/GeoArrowReader.h>
+#include <geos/io/GeoArrowWriter.h>
 #include <geos/io/GeoJSONReader.h>
 #include <geos/io/GeoJSONWriter.h>
+#include <geos/io/TWKBReader.h>
+#include <geos/io/TWKBWriter.h>
 #include <geos/linearref/LengthIndexedLine.h>
 #include <geos/noding/GeometryNoder.h>
 #include <geos/noding/Noder.h>
@@ -75,6 +79,7 @@
 #include <geos/operation/overlayng/OverlayNG.h>
 #include <geos/operation/overlayng/OverlayNGRobust.h>
 #include <geos/operation/overlayng/UnaryUnionNG.h>
+#include <geos/operation/polygonize/ParallelPolygonizer.h>
 #include <geos/operation/polygonize/Polygonizer.h>
 #include <geos/operation/polygonize/BuildArea.h>
 #include <geos/operation/relate/RelateOp.h>
@@ -129,6 +134,8 @@
 #define GEOSWKBWriter geos::io::WKBWriter
 #define GEOSGeoJSONReader geos::io::GeoJSONReader
 #define GEOSGeoJSONWriter geos::io::GeoJSONWriter
+#define GEOSTWKBReader geos::io::TWKBReader
+#define GEOSTWKBWriter geos::io::TWKBWriter
 
 // Implementation struct for the GEOSMakeValidParams object
 typedef struct {
@@ -340,6 +347,35 @@ public:
     }
 };
 
+// CAPI_ItemDistance adapts a user-supplied GEOSDistanceCallback
+// to the ItemDistance interface of the CAPI STRtree.
+struct CAPI_ItemDistance {
+    CAPI_ItemDistance(GEOSDistanceCallback p_distancefn, void* p_userdata)
+        : m_distancefn(p_distancefn), m_userdata(p_userdata) {}
+
+    GEOSDistanceCallback m_distancefn;
+    void* m_userdata;
+
+    double operator()(const void* a, const void* b) const
+    {
+        double d;
+
+        if(!m_distancefn(a, b, &d, m_userdata)) {
+            throw std::runtime_error(std::string("Failed to compute distance."));
+        }
+
+        return d;
+    }
+};
+
+// CAPI_GeometryDistance is used when the items of a CAPI
+// STRtree are known to be geometries.
+struct CAPI_GeometryDistance {
+    double operator()(void* a, void* b) const {
+        return static_cast<const Geometry*>(a)->distance(static_cast<const Geometry*>(b));
+    }
+};
+
 
 //## PROTOTYPES #############################################
 
@@ -2008,13 +2044,13 @@ extern "C" {
     Geometry*
     GEOSPolygonize_r(GEOSContextHandle_t extHandle, const Geometry* const* g, unsigned int ngeoms)
     {
-        using geos::operation::polygonize::Polygonizer;
+        using geos::operation::polygonize::ParallelPolygonizer;
 
         return execute(extHandle, [&]() {
             GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
 
             // Polygonize
-            Polygonizer plgnzr;
+            ParallelPolygonizer plgnzr;
             for(std::size_t i = 0; i < ngeoms; ++i) {
                 plgnzr.add(g[i]);
             }
@@ -2028,14 +2064,14 @@ extern "C" {
     Geometry*
     GEOSPolygonize_valid_r(GEOSContextHandle_t extHandle, const Geometry* const* g, unsigned int ngeoms)
     {
-        using geos::operation::polygonize::Polygonizer;
+        using geos::operation::polygonize::ParallelPolygonizer;
 
         return execute(extHandle, [&]() -> Geometry* {
             GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
             Geometry* out;
 
             // Polygonize
-            Polygonizer plgnzr(true);
+            ParallelPolygonizer plgnzr(true);
             int srid = 0;
             for(std::size_t i = 0; i < ngeoms; ++i) {
                 plgnzr.add(g[i]);
@@ -2166,7 +2202,7 @@ extern "C" {
     Geometry*
     GEOSPolygonizer_getCutEdges_r(GEOSContextHandle_t extHandle, const Geometry* const* g, unsigned int ngeoms)
     {
-        using geos::operation::polygonize::Polygonizer;
+        using geos::operation::polygonize::ParallelPolygonizer;
 
         return execute(extHandle, [&]() {
             GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
@@ -2174,7 +2210,7 @@ extern "C" {
             Geometry* out;
 
             // Polygonize
-            Polygonizer plgnzr;
+            ParallelPolygonizer plgnzr;
             int srid = 0;
             for(std::size_t i = 0; i < ngeoms; ++i) {
                 plgnzr.add(g[i]);
@@ -2878,6 +2914,74 @@ extern "C" {
         });
     }
 
+    int
+    GEOSGeom_createFromGeoArrow_r(GEOSContextHandle_t extHandle, int type, const double* coords,
+                                  size_t numCoords, int hasZ, const int32_t* const* offsets, size_t numGeoms,
+                                  GEOSGeoArrowReleaseCallback release, void* userdata, Geometry** geoms)
+    {
+        bool started = false;
+        int ret = execute(extHandle, 0, [&]() {
+            started = true;
+            // Shared by the geometries referencing coords, and released with the last of them
+            std::shared_ptr<const void> owner(coords, [release, userdata](const void*) {
+                if (release) {
+                    release(userdata);
+                }
+            });
+
+            if (geoms == nullptr && numGeoms > 0) {
+                throw IllegalArgumentException("GEOSGeom_createFromGeoArrow: null geometry array");
+            }
+
+            GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+            geos::io::GeoArrowReader reader(*handle->geomFactory);
+            auto result = reader.read(static_cast<geos::geom::GeometryTypeId>(type), coords, numCoords, hasZ != 0,
+                                      offsets, numGeoms, std::move(owner));
+            for (std::size_t i = 0; i < result.size(); i++) {
+                geoms[i] = result[i].release();
+            }
+            return 1;
+        });
+        if (!started && release) {
+            release(userdata);
+        }
+        return ret;
+    }
+
+    int
+    GEOSGeom_toGeoArrow_r(GEOSContextHandle_t extHandle, int type, const Geometry* const* geoms,
+                          size_t numGeoms, int hasZ, double* coords, size_t* numCoords,
+                          int32_t* const* offsets, size_t* numOffsets)
+    {
+        return execute(extHandle, 0, [&]() {
+            geos::io::GeoArrowWriter writer(static_cast<geos::geom::GeometryTypeId>(type), hasZ != 0);
+
+            geos::io::GeoArrowWriter::Sizes sizes;
+            if (coords == nullptr && offsets == nullptr) {
+                sizes = writer.measure(geoms, numGeoms);
+            }
+            else {
+                // coords may be NULL when no coordinate is written, e.g. if all
+                // the geometries are empty; NULL buffers hold no entries
+                if (offsets == nullptr && writer.getNumOffsetBuffers() > 0) {
+                    throw IllegalArgumentException("GEOSGeom_toGeoArrow: offsets must not be NULL");
+                }
+                geos::io::GeoArrowWriter::Sizes capacity;
+                capacity.numCoords = coords ? *numCoords : 0;
+                for (std::size_t k = 0; k < writer.getNumOffsetBuffers(); k++) {
+                    capacity.numOffsets[k] = offsets[k] ? numOffsets[k] : 0;
+                }
+                sizes = writer.write(geoms, numGeoms, coords, offsets, capacity);
+            }
+
+            *numCoords = sizes.numCoords;
+            for (std::size_t k = 0; k < 3; k++) {
+                numOffsets[k] = sizes.numOffsets[k];
+            }
+            return 1;
+        });
+    }
+
     Geometry*
     GEOSGeom_clone_r(GEOSContextHandle_t extHandle, const Geometry* g)
     {
@@ -3109,6 +3213,16 @@ extern "C" {
         });
     }
 
+    int
+    GEOSWKTWriter_writeToBuffer_r(GEOSContextHandle_t extHandle, WKTWriter* writer, const Geometry* geom,
+                                  char* buffer, size_t size, size_t* length)
+    {
+        return execute(extHandle, 0, [&]() {
+            *length = writer->write(geom, buffer, size);
+            return 1;
+        });
+    }
+
     void
     GEOSWKTWriter_setTrim_r(GEOSContextHandle_t extHandle, WKTWriter* writer, char trim)
     {
@@ -3387,6 +3501,100 @@ extern "C" {
         });
     }
 
+    /* TWKB Reader */
+    GEOSTWKBReader*
+    GEOSTWKBReader_create_r(GEOSContextHandle_t extHandle)
+    {
+        return execute(extHandle, [&]() {
+            GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
+            return new geos::io::TWKBReader(*(GeometryFactory*)handle->geomFactory);
+        });
+    }
+
+    void
+    GEOSTWKBReader_destroy_r(GEOSContextHandle_t extHandle, GEOSTWKBReader* reader)
+    {
+        execute(extHandle, [&]() {
+            delete reader;
+        });
+    }
+
+    Geometry*
+    GEOSTWKBReader_read_r(GEOSContextHandle_t extHandle, GEOSTWKBReader* reader, const unsigned char* twkb,
+                          std::size_t size, std::size_t* bytesRead)
+    {
+        return execute(extHandle, [&]() {
+            return reader->read(twkb, size, bytesRead).release();
+        });
+    }
+
+    /* TWKB Writer */
+    GEOSTWKBWriter*
+    GEOSTWKBWriter_create_r(GEOSContextHandle_t extHandle)
+    {
+        return execute(extHandle, [&]() {
+            return new geos::io::TWKBWriter();
+        });
+    }
+
+    void
+    GEOSTWKBWriter_destroy_r(GEOSContextHandle_t extHandle, GEOSTWKBWriter* writer)
+    {
+        execute(extHandle, [&]() {
+            delete writer;
+        });
+    }
+
+    int
+    GEOSTWKBWriter_setPrecision_r(GEOSContextHandle_t extHandle, GEOSTWKBWriter* writer, int xyPrecision, int zPrecision)
+    {
+        return execute(extHandle, 0, [&]() {
+            writer->setXYPrecision(xyPrecision);
+            writer->setZPrecision(zPrecision);
+            return 1;
+        });
+    }
+
+    int
+    GEOSTWKBWriter_setOutputDimension_r(GEOSContextHandle_t extHandle, GEOSTWKBWriter* writer, int newDimension)
+    {
+        return execute(extHandle, 0, [&]() {
+            writer->setOutputDimension(static_cast<uint8_t>(newDimension));
+            return 1;
+        });
+    }
+
+    void
+    GEOSTWKBWriter_setIncludeSize_r(GEOSContextHandle_t extHandle, GEOSTWKBWriter* writer, char includeSize)
+    {
+        execute(extHandle, [&]() {
+            writer->setIncludeSize(includeSize != 0);
+        });
+    }
+
+    void
+    GEOSTWKBWriter_setIncludeBBox_r(GEOSContextHandle_t extHandle, GEOSTWKBWriter* writer, char includeBBox)
+    {
+        execute(extHandle, [&]() {
+            writer->setIncludeBBox(includeBBox != 0);
+        });
+    }
+
+    /* The caller owns the result */
+    unsigned char*
+    GEOSTWKBWriter_write_r(GEOSContextHandle_t extHandle, GEOSTWKBWriter* writer, const Geometry* geom, std::size_t* size)
+    {
+        return execute(extHandle, [&]() {
+            std::vector<unsigned char> twkb;
+            writer->write(*geom, twkb);
+
+            unsigned char* result = (unsigned char*) malloc(twkb.size());
+            std::memcpy(result, twkb.data(), twkb.size());
+            *size = twkb.size();
+            return result;
+        });
+    }
+
 
 //-----------------------------------------------------------------
 // Prepared Geometry
@@ -3601,41 +3809,65 @@ extern "C" {
                                   GEOSDistanceCallback distancefn,
                                   void* userdata)
     {
-        using namespace geos::index::strtree;
-
-        struct CustomItemDistance {
-            CustomItemDistance(GEOSDistanceCallback p_distancefn, void* p_userdata)
-                : m_distancefn(p_distancefn), m_userdata(p_userdata) {}
-
-            GEOSDistanceCallback m_distancefn;
-            void* m_userdata;
-
-            double operator()(const void* a, const void* b) const
-            {
-                double d;
+        return execute(extHandle, [&]() {
+            if(distancefn) {
+                CAPI_ItemDistance itemDistance(distancefn, userdata);
+                return tree->nearestNeighbour(*itemEnvelope->getEnvelopeInternal(), (void*) item, itemDistance);
+            }
+            else {
+                return tree->nearestNeighbour<CAPI_GeometryDistance>(*itemEnvelope->getEnvelopeInternal(), (void*) item);
+            }
+        });
+    }
 
-                if(!m_distancefn(a, b, &d, m_userdata)) {
-                    throw std::runtime_error(std::string("Failed to compute distance."));
-                }
+    int
+    GEOSSTRtree_queryWithinDistance_r(GEOSContextHandle_t extHandle,
+                                      GEOSSTRtree* tree1,
+                                      GEOSSTRtree* tree2,
+                                      double maxDistance,
+                                      GEOSDistanceCallback distancefn,
+                                      GEOSQueryPairCallback callback,
+                                      void* userdata,
+                                      unsigned int numThreads)
+    {
+        return execute(extHandle, 0, [&]() {
+            auto visitor = [callback, userdata](void* a, void* b, double d) {
+                callback(a, b, d, userdata);
+            };
 
-                return d;
+            if(distancefn) {
+                CAPI_ItemDistance itemDistance(distancefn, userdata);
+                tree1->queryWithinDistance(*tree2, maxDistance, itemDistance, visitor, numThreads);
             }
-        };
-
-        struct GeometryDistance {
-            double operator()(void* a, void* b) const {
-                return static_cast<const Geometry*>(a)->distance(static_cast<const Geometry*>(b));
+            else {
+                tree1->queryWithinDistance<CAPI_GeometryDistance>(*tree2, maxDistance, visitor, numThreads);
             }
-        };
+            return 1;
+        });
+    }
+
+    int
+    GEOSSTRtree_nearestEach_r(GEOSContextHandle_t extHandle,
+                              GEOSSTRtree* tree1,
+                              GEOSSTRtree* tree2,
+                              GEOSDistanceCallback distancefn,
+                              GEOSQueryPairCallback callback,
+                              void* userdata,
+                              unsigned int numThreads)
+    {
+        return execute(extHandle, 0, [&]() {
+            auto visitor = [callback, userdata](void* a, void* b, double d) {
+                callback(a, b, d, userdata);
+            };
 
-        return execute(extHandle, [&]() {
             if(distancefn) {
-                CustomItemDistance itemDistance(distancefn, userdata);
-                return tree->nearestNeighbour(*itemEnvelope->getEnvelopeInternal(), (void*) item, itemDistance);
+                CAPI_ItemDistance itemDistance(distancefn, userdata);
+                tree1->nearestNeighbours(*tree2, itemDistance, visitor, numThreads);
             }
             else {
-                return tree->nearestNeighbour<GeometryDistance>(*itemEnvelope->getEnvelopeInternal(), (void*) item);
+                tree1->nearestNeighbours<CAPI_GeometryDistance>(*tree2, visitor, numThreads);
             }
+            return 1;
         });
     }
 
@@ -21,6 +21,7 @@
 #include <geos/export.h>
 #include <geos/geom/Coordinate.h>
 #include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/FlatCoordinateSequence.h>
 
 namespace geos {
 namespace algorithm { // geos::algorithm
@@ -45,6 +46,14 @@ public:
     */
     static double ofRing(const geom::CoordinateSequence* ring);
 
+    /**
+    * Computes the area for a ring.
+    *
+    * @param ring the coordinates forming the ring
+    * @return the area of the ring
+    */
+    static double ofRing(const geom::FlatCoordinateSequence& ring);
+
     /**
     * Computes the signed area for a ring. The signed area is positive if the
     * ring is oriented CW, negative if the ring is oriented CCW, and zero if the
@@ -67,6 +76,17 @@ public:
     */
     static double ofRingSigned(const geom::CoordinateSequence* ring);
 
+    /**
+    * Computes the signed area for a ring. The signed area is positive if the
+    * ring is oriented CW, negative if the ring is oriented CCW, and zero if the
+    * ring is degenerate or flat.
+    *
+    * @param ring
+    *          the coordinates forming the ring
+    * @return the signed area of the ring
+    */
+    static double ofRingSigned(const geom::FlatCoordinateSequence& ring);
+
 };
 
 
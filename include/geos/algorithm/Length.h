@@ -21,6 +21,7 @@
 #include <geos/export.h>
 #include <geos/geom/Coordinate.h>
 #include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/FlatCoordinateSequence.h>
 
 namespace geos {
 namespace algorithm { // geos::algorithm
@@ -41,6 +42,14 @@ public:
      */
     static double ofLine(const geom::CoordinateSequence* ring);
 
+    /**
+     * Computes the length of a linestring specified by a sequence of points.
+     *
+     * @param pts the points specifying the linestring
+     * @return the length of the linestring
+     */
+    static double ofLine(const geom::FlatCoordinateSequence& pts);
+
 };
 
 
@@ -27,6 +27,7 @@
 
 #include <memory>
 #include <queue>
+#include <vector>
 
 
 
@@ -105,6 +106,38 @@ public:
     */
     static std::unique_ptr<geom::LineString> getRadiusLine(const geom::Geometry* p_obstacles, double p_tolerance);
 
+    /**
+    * Computes the center points of the Largest Empty Circles
+    * within a list of obstacle geometries, up to a given tolerance distance.
+    *
+    * The geometries are processed concurrently, and must not be
+    * modified until the computation is complete.
+    *
+    * @param p_obstacles a list of geometries representing the obstacles (points and lines)
+    * @param p_tolerance the distance tolerance for computing the center points
+    * @param numThreads the number of threads (0 to use all hardware threads)
+    * @return the center points, in the order of the input geometries
+    */
+    static std::vector<std::unique_ptr<geom::Point>> getCenters(
+        const std::vector<const geom::Geometry*>& p_obstacles, double p_tolerance,
+        std::size_t numThreads = 1);
+
+    /**
+    * Computes radius lines of the Largest Empty Circles
+    * within a list of obstacle geometries, up to a given tolerance distance.
+    *
+    * The geometries are processed concurrently, and must not be
+    * modified until the computation is complete.
+    *
+    * @param p_obstacles a list of geometries representing the obstacles (points and lines)
+    * @param p_tolerance the distance tolerance for computing the center points
+    * @param numThreads the number of threads (0 to use all hardware threads)
+    * @return lines from the centers to a point on the circles, in the order of the input geometries
+    */
+    static std::vector<std::unique_ptr<geom::LineString>> getRadiusLines(
+        const std::vector<const geom::Geometry*>& p_obstacles, double p_tolerance,
+        std::size_t numThreads = 1);
+
     std::unique_ptr<geom::Point> getCenter();
     std::unique_ptr<geom::Point> getRadiusPoint();
     std::unique_ptr<geom::LineString> getRadiusLine();
@@ -210,7 +243,7 @@ private:
 
     bool mayContainCircleCenter(const Cell& cell, const Cell& farthestCell);
     void createInitialGrid(const geom::Envelope* env, std::priority_queue<Cell>& cellQueue);
-    Cell createCentroidCell(const geom::Geometry* geom);
+    Cell createInitialCandidateCell(const geom::Geometry* geom);
 
 };
 
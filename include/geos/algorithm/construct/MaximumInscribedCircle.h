@@ -27,6 +27,7 @@
 
 #include <memory>
 #include <queue>
+#include <vector>
 
 
 
@@ -107,6 +108,38 @@ public:
     */
     static std::unique_ptr<geom::LineString> getRadiusLine(const geom::Geometry* polygonal, double tolerance);
 
+    /**
+    * Computes the center points of the Maximum Inscribed Circles
+    * of a list of polygonal geometries, up to a given tolerance distance.
+    *
+    * The geometries are processed concurrently, and must not be
+    * modified until the computation is complete.
+    *
+    * @param polygonals a list of polygonal geometries
+    * @param tolerance the distance tolerance for computing the center points
+    * @param numThreads the number of threads (0 to use all hardware threads)
+    * @return the center points, in the order of the input geometries
+    */
+    static std::vector<std::unique_ptr<geom::Point>> getCenters(
+        const std::vector<const geom::Geometry*>& polygonals, double tolerance,
+        std::size_t numThreads = 1);
+
+    /**
+    * Computes radius lines of the Maximum Inscribed Circles
+    * of a list of polygonal geometries, up to a given tolerance distance.
+    *
+    * The geometries are processed concurrently, and must not be
+    * modified until the computation is complete.
+    *
+    * @param polygonals a list of polygonal geometries
+    * @param tolerance the distance tolerance for computing the center points
+    * @param numThreads the number of threads (0 to use all hardware threads)
+    * @return lines from the centers to a point on the circles, in the order of the input geometries
+    */
+    static std::vector<std::unique_ptr<geom::LineString>> getRadiusLines(
+        const std::vector<const geom::Geometry*>& polygonals, double tolerance,
+        std::size_t numThreads = 1);
+
 private:
 
     /* private members */
@@ -185,7 +218,7 @@ private:
     };
 
     void createInitialGrid(const geom::Envelope* env, std::priority_queue<Cell>& cellQueue);
-    Cell createCentroidCell(const geom::Geometry* geom);
+    Cell createInitialCandidateCell(const geom::Geometry* geom);
 
 };
 
@@ -0,0 +1,132 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/LineSegment.h>
+
+#include <vector>
+
+using geos::geom::Coordinate;
+using geos::geom::LineSegment;
+
+namespace geos {      // geos.
+namespace coverage { // geos.coverage
+
+/**
+ * An edge of a polygonal coverage, formed from all or a section of
+ * a polygon ring.
+ *
+ * An edge is shared by the rings of the two polygons on either side of it,
+ * or belongs to a single ring if it lies on the boundary of the coverage.
+ * Its endpoints are nodes of the coverage, except for an edge which is
+ * a free ring: a ring which touches no other ring, or is
+ * shared in full by exactly two rings (such as a hole filled by another
+ * polygon).
+ */
+class GEOS_DLL CoverageEdge {
+
+private:
+
+    std::vector<Coordinate> m_pts;
+    std::size_t m_ringCount;
+    bool m_isFreeRing;
+
+public:
+
+    /**
+    * Creates an edge from a section of a ring.
+    *
+    * @param pts the edge coordinates, in canonical order (see key())
+    * @param isFreeRing whether the edge is a complete ring without nodes
+    */
+    CoverageEdge(std::vector<Coordinate>&& pts, bool isFreeRing)
+        : m_pts(std::move(pts))
+        , m_ringCount(0)
+        , m_isFreeRing(isFreeRing)
+        {};
+
+    /**
+    * Computes a key which identifies an edge, whichever direction
+    * its coordinates are traversed in.
+    * The key is the least of the first segment and the reversed last segment.
+    * The canonical order of the edge coordinates is the one which
+    * starts with the key segment.
+    *
+    * @param pts the coordinates of a ring section
+    * @return the key segment for the section
+    */
+    static LineSegment key(const std::vector<Coordinate>& pts);
+
+    /**
+    * Tests whether a ring section traverses an edge in its
+    * canonical direction.
+    *
+    * @param pts the coordinates of a ring section
+    * @param key the key of the section
+    * @return true if the section starts with the key segment
+    */
+    static bool isForward(const std::vector<Coordinate>& pts, const LineSegment& key);
+
+    const std::vector<Coordinate>& getCoordinates() const {
+        return m_pts;
+    };
+
+    void setCoordinates(std::vector<Coordinate>&& pts) {
+        m_pts = std::move(pts);
+    };
+
+    std::size_t size() const {
+        return m_pts.size();
+    };
+
+    bool isFreeRing() const {
+        return m_isFreeRing;
+    };
+
+    bool isClosed() const {
+        return m_pts.size() > 1 && m_pts.front().equals2D(m_pts.back());
+    };
+
+    /**
+    * Records that the edge is used by another ring.
+    */
+    void incRingCount() {
+        m_ringCount++;
+    };
+
+    /**
+    * Gets the number of rings the edge is used by:
+    * 1 for an edge on the coverage boundary, 2 for an interior edge.
+    */
+    std::size_t getRingCount() const {
+        return m_ringCount;
+    };
+
+    /**
+    * Appends the edge coordinates to a ring under construction,
+    * omitting the first coordinate if it duplicates the last one
+    * already in the ring.
+    *
+    * @param isForward whether to add the coordinates in canonical order
+    * @param ringPts the ring coordinates
+    */
+    void addCoordinates(bool isForward, std::vector<Coordinate>& ringPts) const;
+
+};
+
+} // namespace geos.coverage
+} // namespace geos
@@ -0,0 +1,142 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/coverage/CoverageEdge.h>
+#include <geos/coverage/CoverageRing.h>
+
+#include <deque>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+class LinearRing;
+class Polygon;
+}
+}
+
+using geos::geom::Geometry;
+using geos::geom::LinearRing;
+using geos::geom::Polygon;
+
+namespace geos {      // geos.
+namespace coverage { // geos.coverage
+
+/**
+ * Models a polygonal coverage as a set of unique {@link CoverageEdge}s,
+ * linked to the rings which use them.
+ *
+ * The rings of the coverage polygons are split into edges at nodes,
+ * which are the vertices where three or more distinct segments meet.
+ * An edge shared by two adjacent polygons is represented once, so
+ * the edges can be modified (e.g. simplified) and the coverage
+ * rebuilt from them with adjacency preserved.
+ *
+ * The coverage is assumed to be valid.
+ */
+class GEOS_DLL CoverageRingEdges {
+
+public:
+
+    /**
+    * A use of an edge by a ring.
+    */
+    struct EdgeUse {
+        std::size_t edgeIndex;
+        bool isForward;
+    };
+
+private:
+
+    std::vector<const Geometry*>& m_coverage;
+    std::deque<CoverageRing> m_ringStore;
+    std::vector<CoverageRing*> m_rings;
+    std::vector<std::vector<EdgeUse>> m_ringEdges;
+    std::vector<CoverageEdge> m_edges;
+
+    void build();
+
+    std::unordered_set<Coordinate, Coordinate::HashCode> findNodes() const;
+
+    void addRingEdges(
+        std::size_t ringIndex,
+        const std::unordered_set<Coordinate, Coordinate::HashCode>& nodes,
+        std::unordered_map<LineSegment, std::size_t, LineSegment::HashCode>& edgeMap);
+
+    void addEdge(
+        std::vector<Coordinate>&& sectionPts,
+        bool isFreeRing,
+        std::vector<EdgeUse>& ringEdges,
+        std::unordered_map<LineSegment, std::size_t, LineSegment::HashCode>& edgeMap);
+
+    std::unique_ptr<LinearRing> buildRing(std::size_t ringIndex, const geom::GeometryFactory* factory) const;
+
+    std::unique_ptr<Polygon> buildPolygon(const Polygon* poly, std::size_t& ringIndex) const;
+
+    std::unique_ptr<Geometry> buildGeometry(const Geometry* geom, std::size_t& ringIndex) const;
+
+public:
+
+    /**
+    * Creates the edges of a polygonal coverage.
+    *
+    * @param coverage the polygons of a valid coverage
+    */
+    CoverageRingEdges(std::vector<const Geometry*>& coverage);
+
+    std::vector<CoverageEdge>& getEdges() {
+        return m_edges;
+    };
+
+    std::size_t getNumRings() const {
+        return m_rings.size();
+    };
+
+    /**
+    * Gets the edges forming a ring, in ring order.
+    *
+    * @param ringIndex the index of the ring
+    * @return the uses of edges by the ring
+    */
+    const std::vector<EdgeUse>& getRingEdges(std::size_t ringIndex) const {
+        return m_ringEdges[ringIndex];
+    };
+
+    /**
+    * Computes the number of distinct vertices of a ring formed
+    * from the current edge coordinates.
+    *
+    * @param ringIndex the index of the ring
+    * @return the number of ring vertices, not counting the closing vertex
+    */
+    std::size_t getRingSize(std::size_t ringIndex) const;
+
+    /**
+    * Builds polygonal geometries from the current edge coordinates,
+    * with the same structure as the input coverage.
+    *
+    * @return the rebuilt coverage geometries
+    */
+    std::vector<std::unique_ptr<Geometry>> buildCoverage() const;
+
+};
+
+} // namespace geos.coverage
+} // namespace geos
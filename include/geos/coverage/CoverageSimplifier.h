@@ -0,0 +1,147 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/index/strtree/TemplateSTRtree.h>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+}
+namespace coverage {
+class CoverageEdge;
+}
+}
+
+using geos::geom::Coordinate;
+using geos::geom::Geometry;
+using geos::index::strtree::TemplateSTRtree;
+
+namespace geos {      // geos
+namespace coverage { // geos::coverage
+
+
+/**
+ * Simplifies the boundaries of the polygons in a polygonal coverage
+ * while preserving the original coverage topology.
+ *
+ * The coverage is split into its unique edges (see CoverageRingEdges),
+ * so that an edge shared by two polygons is simplified only once,
+ * and both polygons keep a common boundary.
+ * Edges are simplified with the Douglas-Peucker algorithm, keeping
+ * their endpoints (the coverage nodes) fixed.
+ *
+ * Topology is preserved as follows:
+ *
+ *   * A section of an edge is only replaced by a segment if the segment
+ *     does not cross any input segment, and no input vertex lies inside
+ *     the area between the section and the segment.
+ *   * Any simplified edges which cross each other,
+ *     or which would leave a ring with fewer than three vertices,
+ *     are restored to their input linework.
+ *
+ * Since each edge is simplified independently against the input,
+ * edges can be simplified concurrently (see setNumThreads()),
+ * and the result does not depend on the number of threads.
+ *
+ * The input coverage must be valid (see CoverageValidator).
+ */
+class GEOS_DLL CoverageSimplifier {
+
+private:
+
+    struct SegmentRef {
+        std::size_t edgeIndex;
+        std::size_t segIndex;
+    };
+
+    std::vector<const Geometry*>& m_coverage;
+    std::size_t m_numThreads = 1;
+
+    static void indexSegments(
+        const std::vector<std::vector<Coordinate>>& edgePts,
+        TemplateSTRtree<SegmentRef>& index);
+
+    static std::vector<Coordinate> simplifyEdge(
+        std::size_t edgeIndex,
+        const std::vector<Coordinate>& pts,
+        double tolerance,
+        const std::vector<std::vector<Coordinate>>& inputPts,
+        TemplateSTRtree<SegmentRef>& inputIndex);
+
+    static bool isFlatteningValid(
+        std::size_t edgeIndex,
+        const std::vector<Coordinate>& pts,
+        std::size_t start, std::size_t end,
+        const std::vector<std::vector<Coordinate>>& inputPts,
+        TemplateSTRtree<SegmentRef>& inputIndex);
+
+    static bool hasConflict(
+        const SegmentRef& seg,
+        const std::vector<std::vector<Coordinate>>& edgePts,
+        TemplateSTRtree<SegmentRef>& index);
+
+public:
+
+    /**
+    * Creates a simplifier for a polygonal coverage.
+    *
+    * @param coverage the polygons of a valid coverage
+    */
+    CoverageSimplifier(std::vector<const Geometry*>& coverage)
+        : m_coverage(coverage)
+        {};
+
+    /**
+    * Sets the number of threads used to simplify the coverage edges.
+    *
+    * @param numThreads the number of threads (0 to use all hardware threads)
+    */
+    void setNumThreads(std::size_t numThreads) {
+        m_numThreads = numThreads;
+    };
+
+    /**
+    * Simplifies the coverage.
+    * The result is a list of the same size as the input coverage,
+    * with each polygonal element simplified.
+    *
+    * @param tolerance the distance tolerance
+    * @return the simplified coverage polygons
+    */
+    std::vector<std::unique_ptr<Geometry>> simplify(double tolerance);
+
+    /**
+    * Simplifies the polygons of a coverage.
+    *
+    * @param coverage the polygons of a valid coverage
+    * @param tolerance the distance tolerance
+    * @return the simplified coverage polygons
+    */
+    static std::vector<std::unique_ptr<Geometry>> simplify(
+        std::vector<const Geometry*>& coverage,
+        double tolerance);
+
+};
+
+} // namespace geos::coverage
+} // namespace geos
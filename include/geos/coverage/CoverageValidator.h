@@ -16,6 +16,11 @@
 
 #include <geos/index/strtree/TemplateSTRtree.h>
 
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
 
 // Forward declarations
 namespace geos {
@@ -68,11 +73,14 @@ private:
 
     std::vector<const Geometry*>& m_coverage;
     double m_gapWidth = 0.0;
+    std::size_t m_numThreads = 1;
 
     std::unique_ptr<Geometry> validate(
         const Geometry* targetGeom,
         TemplateSTRtree<const Geometry*>& index);
 
+    void buildIndex(TemplateSTRtree<const Geometry*>& index);
+
 
 public:
 
@@ -94,6 +102,17 @@ public:
         m_gapWidth = gapWidth;
     };
 
+    /**
+    * Sets the number of threads used to validate the polygons.
+    * Each polygon is validated independently against the others,
+    * so the result does not depend on the number of threads.
+    *
+    * @param numThreads the number of threads (0 to use all hardware threads)
+    */
+    void setNumThreads(std::size_t numThreads) {
+        m_numThreads = numThreads;
+    };
+
     /**
     * Validates the polygonal coverage.
     * The result is an array of the same size as the input coverage.
@@ -106,6 +125,22 @@ public:
     */
     std::vector<std::unique_ptr<Geometry>> validate();
 
+    /**
+    * Validates the polygonal coverage, passing the result for each
+    * invalid polygon to a visitor as soon as it is computed,
+    * rather than collecting the results for all polygons.
+    *
+    * The visitor is called with the index of the invalid polygon in the
+    * coverage and the linear geometry of its invalid boundary segments.
+    * Valid polygons are not visited.
+    * If more than one thread is used the polygons are visited in the
+    * order their validation completes, and the visitor may be called from
+    * any of the threads, but never by two threads at once.
+    *
+    * @param visitor the function to call for each invalid polygon
+    */
+    void validate(const std::function<void(std::size_t, std::unique_ptr<Geometry>)>& visitor);
+
     /**
     * Tests whether a polygonal coverage is valid.
     *
@@ -15,6 +15,8 @@
 #pragma once
 
 #include <geos/export.h>
+#include <atomic>
+#include <memory>
 #include <vector>
 
 #include <geos/geom/CoordinateFilter.h>
@@ -31,7 +33,22 @@ class Coordinate;
 namespace geos {
 namespace geom { // geos.geom
 
-/// The default implementation of CoordinateSequence
+/**
+ * \brief The default implementation of CoordinateSequence
+ *
+ * Copies of a CoordinateArraySequence (including those made by clone(),
+ * and so by Geometry::clone()) share their coordinates until one of them
+ * is modified: setAt(), setOrdinate(), setPoints(), add(), clear(),
+ * closeRing() and apply_rw() first give the sequence its own copy of the
+ * coordinates if they are shared.
+ *
+ * Reading never copies, including through the non-const getAt() and
+ * operator[], so a sequence that is only read is never modified and can
+ * be read from several threads. A reference returned by getAt() refers
+ * to the coordinates shared at the time of the call: writing through it
+ * changes every sequence sharing them, so coordinates must be modified
+ * through the methods above.
+ */
 class GEOS_DLL CoordinateArraySequence : public CoordinateSequence {
 public:
 
@@ -84,15 +101,11 @@ public:
     bool
     empty() const
     {
-        return vect.empty();
+        return vect->empty();
     }
 
     /// Reset this CoordinateArraySequence to the empty state
-    void
-    clear()
-    {
-        vect.clear();
-    }
+    void clear();
 
     /// Add a Coordinate to the list
     void add(const Coordinate& c);
@@ -136,14 +149,46 @@ public:
     void apply_rw(const CoordinateFilter* filter) override;
 
     void apply_ro(CoordinateFilter* filter) const override {
-        for(const auto& coord : vect) {
+        for(const auto& coord : *vect) {
             filter->filter_ro(&coord);
         }
     }
 
 private:
-    std::vector<Coordinate> vect;
+    /// Coordinates, shared with the copies of this sequence until modified
+    std::shared_ptr<std::vector<Coordinate>> vect;
     mutable std::size_t dimension;
+
+    /**
+     * Whether the coordinates are shared with another sequence.
+     *
+     * Only a copy of this sequence can raise the use count above one, so
+     * a count of one cannot be outdated. The count can however have been
+     * lowered by a copy released in another thread: the acquire fence
+     * orders that release before the coordinates are modified in place.
+     */
+    bool
+    isShared() const
+    {
+        if(vect.use_count() > 1) {
+            return true;
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return false;
+    }
+
+    /// Returns the coordinates for modification, copying them first if shared
+    std::vector<Coordinate>&
+    mutableCoords()
+    {
+        if(isShared()) {
+            detach();
+        }
+        return *vect;
+    }
+
+    /// Replace the shared coordinates with a copy owned by this sequence
+    void detach();
 };
 
 /// This is for backward API compatibility
@@ -0,0 +1,157 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateFilter.h>
+#include <geos/geom/CoordinateSequence.h>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+namespace geos {
+namespace geom { // geos::geom
+
+/**
+ * \class ExternalCoordinateSequence
+ *
+ * \brief A CoordinateSequence reading coordinates from memory it does
+ * not own.
+ *
+ * The memory holds x, y and z doubles for each coordinate, which is
+ * the layout of Coordinate, and is kept alive by an owner handle shared
+ * by the sequence and its copies: it is released when the last of them
+ * is destroyed or modified. Memory holding only x and y cannot be
+ * referenced, since Coordinate has a z member.
+ *
+ * The memory is never written by the sequence: setAt(), setOrdinate(),
+ * setPoints() and apply_rw() first give the sequence its own copy of the
+ * coordinates. Reading never copies, including through the non-const
+ * getAt() and operator[], so a sequence that is only read keeps
+ * referencing the memory and can be read from several threads. The
+ * reference returned by getAt() must not be written through.
+ */
+class GEOS_DLL ExternalCoordinateSequence : public CoordinateSequence {
+public:
+
+    /**
+     * \brief Construct a sequence referencing external coordinates.
+     *
+     * @param coords the first coordinate
+     * @param size the number of coordinates
+     * @param owner keeps the memory alive as long as it is referenced
+     * @param dimension 3 if the z values are meaningful, 2 otherwise
+     */
+    ExternalCoordinateSequence(const Coordinate* coords, std::size_t size,
+                               std::shared_ptr<const void> owner,
+                               std::size_t dimension = 3);
+
+    ExternalCoordinateSequence(const ExternalCoordinateSequence&) = default;
+
+    ~ExternalCoordinateSequence() override = default;
+
+    std::unique_ptr<CoordinateSequence> clone() const override;
+
+    const Coordinate& getAt(std::size_t pos) const override
+    {
+        return m_coords[pos];
+    }
+
+    Coordinate& getAt(std::size_t pos) override
+    {
+        return const_cast<Coordinate&>(m_coords[pos]);
+    }
+
+    void getAt(std::size_t pos, Coordinate& c) const override
+    {
+        c = m_coords[pos];
+    }
+
+    std::size_t getSize() const override
+    {
+        return m_size;
+    }
+
+    bool isEmpty() const override
+    {
+        return m_size == 0;
+    }
+
+    std::size_t getDimension() const override
+    {
+        return m_dimension;
+    }
+
+    /// Returns true if the coordinates are still those of the external memory
+    bool isExternal() const
+    {
+        return !m_owned;
+    }
+
+    void toVector(std::vector<Coordinate>& coords) const override;
+
+    void toVector(std::vector<CoordinateXY>& coords) const override;
+
+    void setAt(const Coordinate& c, std::size_t pos) override;
+
+    void setPoints(const std::vector<Coordinate>& v) override;
+
+    void setOrdinate(std::size_t index, std::size_t ordinateIndex, double value) override;
+
+    void expandEnvelope(Envelope& env) const override;
+
+    void apply_rw(const CoordinateFilter* filter) override;
+
+    void apply_ro(CoordinateFilter* filter) const override;
+
+private:
+    const Coordinate* m_coords;
+    std::size_t m_size;
+    std::shared_ptr<const void> m_owner;
+    std::size_t m_dimension;
+    bool m_owned;
+
+    /// Returns the coordinates for modification, copying them first if needed
+    Coordinate*
+    mutableCoords()
+    {
+        if(!m_owned || m_owner.use_count() > 1) {
+            own(std::vector<Coordinate>(m_coords, m_coords + m_size));
+        }
+        else {
+            // see CoordinateArraySequence::isShared()
+            std::atomic_thread_fence(std::memory_order_acquire);
+        }
+        return const_cast<Coordinate*>(m_coords);
+    }
+
+    /// Replace the referenced coordinates by the given ones
+    void own(std::vector<Coordinate>&& coords);
+};
+
+} // namespace geos::geom
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
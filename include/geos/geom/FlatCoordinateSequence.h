@@ -0,0 +1,424 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/constants.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/Envelope.h>
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class CoordinateSequence;
+}
+}
+
+namespace geos {
+namespace geom { // geos::geom
+
+/// The ordinates stored for each coordinate of a FlatCoordinateSequence
+enum class CoordinateLayout : unsigned char {
+    XY,
+    XYZ,
+    XYM,
+    XYZM
+};
+
+/// Compile-time properties of a CoordinateLayout
+template<CoordinateLayout L>
+struct CoordinateLayoutTraits;
+
+template<>
+struct CoordinateLayoutTraits<CoordinateLayout::XY> {
+    static constexpr std::size_t dimension = 2;
+    static constexpr bool hasZ = false;
+    static constexpr bool hasM = false;
+};
+
+template<>
+struct CoordinateLayoutTraits<CoordinateLayout::XYZ> {
+    static constexpr std::size_t dimension = 3;
+    static constexpr bool hasZ = true;
+    static constexpr bool hasM = false;
+};
+
+template<>
+struct CoordinateLayoutTraits<CoordinateLayout::XYM> {
+    static constexpr std::size_t dimension = 3;
+    static constexpr bool hasZ = false;
+    static constexpr bool hasM = true;
+};
+
+template<>
+struct CoordinateLayoutTraits<CoordinateLayout::XYZM> {
+    static constexpr std::size_t dimension = 4;
+    static constexpr bool hasZ = true;
+    static constexpr bool hasM = true;
+};
+
+/**
+ * \class FlatCoordinateView
+ *
+ * \brief Read-only access to a contiguous buffer of coordinates whose
+ * layout is known at compile time.
+ *
+ * The stride and the position of each ordinate are constants, so that
+ * loops over a view compile to plain strided memory accesses. Views are
+ * obtained from FlatCoordinateSequence::view() or
+ * FlatCoordinateSequence::visit(), and are invalidated by any change to
+ * the size of the sequence.
+ */
+template<CoordinateLayout L>
+class FlatCoordinateView {
+public:
+    using traits = CoordinateLayoutTraits<L>;
+
+    static constexpr std::size_t stride = traits::dimension;
+
+    FlatCoordinateView(const double* data, std::size_t size)
+        : m_data(data)
+        , m_size(size)
+    {}
+
+    std::size_t size() const
+    {
+        return m_size;
+    }
+
+    bool isEmpty() const
+    {
+        return m_size == 0;
+    }
+
+    double getX(std::size_t i) const
+    {
+        return m_data[i * stride];
+    }
+
+    double getY(std::size_t i) const
+    {
+        return m_data[i * stride + 1];
+    }
+
+    /// Returns the Z ordinate, or NaN if the layout has none
+    double getZ(std::size_t i) const
+    {
+        return traits::hasZ ? m_data[i * stride + 2] : DoubleNotANumber;
+    }
+
+    /// Returns the M ordinate, or NaN if the layout has none
+    double getM(std::size_t i) const
+    {
+        return traits::hasM ? m_data[i * stride + stride - 1] : DoubleNotANumber;
+    }
+
+    CoordinateXY getXY(std::size_t i) const
+    {
+        return CoordinateXY(getX(i), getY(i));
+    }
+
+    Coordinate getAt(std::size_t i) const
+    {
+        return Coordinate(getX(i), getY(i), getZ(i));
+    }
+
+    /// Calls f(x, y) for each coordinate
+    template<typename F>
+    void forEachXY(F&& f) const
+    {
+        const double* p = m_data;
+        for (std::size_t i = 0; i < m_size; i++, p += stride) {
+            f(p[0], p[1]);
+        }
+    }
+
+    /// Calls f(x0, y0, x1, y1) for each pair of consecutive coordinates
+    template<typename F>
+    void forEachSegmentXY(F&& f) const
+    {
+        if (m_size < 2) {
+            return;
+        }
+        const double* p = m_data;
+        for (std::size_t i = 1; i < m_size; i++, p += stride) {
+            f(p[0], p[1], p[stride], p[stride + 1]);
+        }
+    }
+
+private:
+    const double* m_data;
+    std::size_t m_size;
+};
+
+/**
+ * \class FlatCoordinateSequence
+ *
+ * \brief A list of coordinates stored in a single contiguous buffer of
+ * doubles.
+ *
+ * Unlike the CoordinateSequence implementations, which keep a full
+ * Coordinate (x, y, z) for every vertex, only the ordinates of the
+ * sequence's CoordinateLayout are stored: 16 bytes per coordinate for XY,
+ * 24 for XYZ or XYM, 32 for XYZM. The class has no virtual methods.
+ *
+ * Ordinates can be read through the accessors, which select the stride at
+ * run time, or through a FlatCoordinateView, whose layout is a template
+ * parameter. visit() dispatches the run-time layout to a functor with a
+ * templated call operator, so that an algorithm written once is compiled
+ * for each layout:
+ *
+ * \code
+ * struct SumX {
+ *     template<typename View>
+ *     double operator()(const View& view) const {
+ *         double s = 0;
+ *         view.forEachXY([&s](double x, double) { s += x; });
+ *         return s;
+ *     }
+ * };
+ *
+ * double sumX = seq.visit(SumX());
+ * \endcode
+ */
+class GEOS_DLL FlatCoordinateSequence {
+public:
+
+    /// Construct an empty sequence with the given layout
+    explicit FlatCoordinateSequence(CoordinateLayout layout = CoordinateLayout::XY);
+
+    /// Construct a sequence of size coordinates with all ordinates set to zero
+    FlatCoordinateSequence(std::size_t size, CoordinateLayout layout);
+
+    /**
+     * \brief Construct a sequence by copying an interleaved buffer of ordinates.
+     *
+     * @param buf the ordinates, in the order of the layout
+     *            (e.g. x0, y0, m0, x1, y1, m1, ... for XYM)
+     * @param size the number of coordinates in the buffer
+     * @param layout the layout of the buffer
+     */
+    FlatCoordinateSequence(const double* buf, std::size_t size, CoordinateLayout layout);
+
+    /**
+     * \brief Construct a sequence by copying a CoordinateSequence.
+     *
+     * The layout is XYZ if the sequence has Z values, XY otherwise.
+     */
+    explicit FlatCoordinateSequence(const CoordinateSequence& seq);
+
+    /// Returns the layout having Z and M ordinates as requested
+    static CoordinateLayout layoutFor(bool hasZ, bool hasM);
+
+    CoordinateLayout getLayout() const
+    {
+        return m_layout;
+    }
+
+    /// Returns the number of ordinates stored for each coordinate
+    std::size_t getDimension() const
+    {
+        return m_stride;
+    }
+
+    bool hasZ() const
+    {
+        return m_layout == CoordinateLayout::XYZ || m_layout == CoordinateLayout::XYZM;
+    }
+
+    bool hasM() const
+    {
+        return m_layout == CoordinateLayout::XYM || m_layout == CoordinateLayout::XYZM;
+    }
+
+    std::size_t size() const
+    {
+        return m_data.size() / m_stride;
+    }
+
+    bool isEmpty() const
+    {
+        return m_data.empty();
+    }
+
+    double getX(std::size_t i) const
+    {
+        return m_data[i * m_stride];
+    }
+
+    double getY(std::size_t i) const
+    {
+        return m_data[i * m_stride + 1];
+    }
+
+    /// Returns the Z ordinate, or NaN if the layout has none
+    double getZ(std::size_t i) const
+    {
+        return hasZ() ? m_data[i * m_stride + 2] : DoubleNotANumber;
+    }
+
+    /// Returns the M ordinate, or NaN if the layout has none
+    double getM(std::size_t i) const
+    {
+        return hasM() ? m_data[i * m_stride + m_stride - 1] : DoubleNotANumber;
+    }
+
+    CoordinateXY getXY(std::size_t i) const
+    {
+        return CoordinateXY(getX(i), getY(i));
+    }
+
+    /// Returns the X, Y and Z ordinates of a coordinate
+    Coordinate getAt(std::size_t i) const
+    {
+        return Coordinate(getX(i), getY(i), getZ(i));
+    }
+
+    /**
+     * \brief Returns an ordinate of a coordinate.
+     *
+     * @param index the coordinate index in the sequence
+     * @param ordinateIndex CoordinateSequence::X, Y, Z or M
+     * @return the ordinate, or NaN if the layout does not have it
+     */
+    double getOrdinate(std::size_t index, std::size_t ordinateIndex) const;
+
+    /**
+     * \brief Sets an ordinate of a coordinate.
+     *
+     * @throws util::IllegalArgumentException if the layout does not have
+     *         the ordinate
+     */
+    void setOrdinate(std::size_t index, std::size_t ordinateIndex, double value);
+
+    void setXY(std::size_t i, double x, double y)
+    {
+        m_data[i * m_stride] = x;
+        m_data[i * m_stride + 1] = y;
+    }
+
+    /// Sets the X, Y and (if the layout has it) Z ordinates of a coordinate
+    void setAt(const Coordinate& c, std::size_t i);
+
+    /// Appends a coordinate; the ordinates missing from the layout are ignored
+    void add(double x, double y, double z = DoubleNotANumber, double m = DoubleNotANumber);
+
+    /// Appends the X, Y and (if the layout has it) Z ordinates of a coordinate
+    void add(const Coordinate& c)
+    {
+        add(c.x, c.y, c.z);
+    }
+
+    void reserve(std::size_t size)
+    {
+        m_data.reserve(size * m_stride);
+    }
+
+    void clear()
+    {
+        m_data.clear();
+    }
+
+    /// Returns the interleaved ordinates, size() * getDimension() values
+    const double* data() const
+    {
+        return m_data.data();
+    }
+
+    double* data()
+    {
+        return m_data.data();
+    }
+
+    /**
+     * \brief Returns a view of the coordinates for a layout known at compile time.
+     *
+     * @throws util::IllegalArgumentException if L is not the layout of the sequence
+     */
+    template<CoordinateLayout L>
+    FlatCoordinateView<L> view() const
+    {
+        checkLayout(L);
+        return FlatCoordinateView<L>(m_data.data(), size());
+    }
+
+    /**
+     * \brief Calls f with a FlatCoordinateView of the layout of this sequence.
+     *
+     * f must accept a view of any layout, typically through a templated
+     * operator(), and return the same type for all of them.
+     *
+     * @return the value returned by f
+     */
+    template<typename F>
+    auto visit(F&& f) const -> decltype(f(std::declval<FlatCoordinateView<CoordinateLayout::XY>>()))
+    {
+        std::size_t n = size();
+        switch (m_layout) {
+            case CoordinateLayout::XYZ:
+                return f(FlatCoordinateView<CoordinateLayout::XYZ>(m_data.data(), n));
+            case CoordinateLayout::XYM:
+                return f(FlatCoordinateView<CoordinateLayout::XYM>(m_data.data(), n));
+            case CoordinateLayout::XYZM:
+                return f(FlatCoordinateView<CoordinateLayout::XYZM>(m_data.data(), n));
+            default:
+                return f(FlatCoordinateView<CoordinateLayout::XY>(m_data.data(), n));
+        }
+    }
+
+    /// Returns the bounding box of the coordinates
+    Envelope getEnvelope() const;
+
+    /**
+     * \brief Returns a copy of the coordinates as a CoordinateSequence.
+     *
+     * M values are not kept, since Coordinate has no M ordinate.
+     */
+    std::unique_ptr<CoordinateSequence> toCoordinateSequence() const;
+
+    bool operator==(const FlatCoordinateSequence& other) const
+    {
+        return m_layout == other.m_layout && m_data == other.m_data;
+    }
+
+    bool operator!=(const FlatCoordinateSequence& other) const
+    {
+        return !(*this == other);
+    }
+
+private:
+    std::vector<double> m_data;
+    CoordinateLayout m_layout;
+    std::size_t m_stride;
+
+    void checkLayout(CoordinateLayout layout) const;
+};
+
+} // namespace geos::geom
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
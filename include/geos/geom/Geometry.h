@@ -847,13 +847,13 @@ public:
      * by an external party.
      */
     void geometryChangedAction() {
-        envelope.reset();
+        envelopeComputed = false;
     }
 
 protected:
 
-    /// The bounding box of this Geometry
-    mutable std::unique_ptr<Envelope> envelope;
+    /// The bounding box of this Geometry, valid if envelopeComputed is set
+    mutable Envelope envelope;
 
     /// Make a deep-copy of this Geometry
     virtual Geometry* cloneImpl() const = 0;
@@ -894,7 +894,7 @@ protected:
 
     //virtual void checkEqualPrecisionModel(Geometry *other);
 
-    virtual Envelope::Ptr computeEnvelopeInternal() const = 0; //Abstract
+    virtual Envelope computeEnvelopeInternal() const = 0; //Abstract
 
     virtual int compareToSameClass(const Geometry* geom) const = 0; //Abstract
 
@@ -908,6 +908,9 @@ protected:
                double tolerance) const;
     int SRID;
 
+    /// Whether envelope holds the bounding box of the current coordinates
+    mutable bool envelopeComputed;
+
     Geometry(const Geometry& geom);
 
     /** \brief
@@ -231,7 +231,7 @@ protected:
 
     std::vector<std::unique_ptr<Geometry>> geometries;
 
-    Envelope::Ptr computeEnvelopeInternal() const override;
+    Envelope computeEnvelopeInternal() const override;
 
     int compareToSameClass(const Geometry* gc) const override;
 
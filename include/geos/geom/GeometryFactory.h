@@ -29,6 +29,7 @@
 #include <geos/util/IllegalArgumentException.h>
 #include <geos/export.h>
 
+#include <atomic>
 #include <vector>
 #include <memory>
 #include <cassert>
@@ -531,7 +532,9 @@ private:
     int SRID;
     const CoordinateSequenceFactory* coordinateListFactory;
 
-    mutable int _refCount;
+    // Atomic, so that geometries sharing a factory can be created
+    // and destroyed on several threads at once
+    mutable std::atomic<int> _refCount;
     bool _autoDestroy;
 
     friend class Geometry;
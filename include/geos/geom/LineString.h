@@ -213,7 +213,7 @@ protected:
 
     LineString* reverseImpl() const override;
 
-    Envelope::Ptr computeEnvelopeInternal() const override;
+    Envelope computeEnvelopeInternal() const override;
 
     CoordinateSequence::Ptr points;
 
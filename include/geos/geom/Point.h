@@ -173,7 +173,7 @@ protected:
 
     Point* reverseImpl() const override { return new Point(*this); }
 
-    Envelope::Ptr computeEnvelopeInternal() const override;
+    Envelope computeEnvelopeInternal() const override;
 
     int compareToSameClass(const Geometry* p) const override;
 
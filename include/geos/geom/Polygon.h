@@ -202,7 +202,7 @@ protected:
 
     std::vector<std::unique_ptr<LinearRing>> holes;
 
-    Envelope::Ptr computeEnvelopeInternal() const override;
+    Envelope computeEnvelopeInternal() const override;
 
     int
     getSortIndex() const override
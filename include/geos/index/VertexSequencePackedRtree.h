@@ -19,6 +19,7 @@ namespace geos {
 namespace geom {
 class Coordinate;
 class Envelope;
+class Triangle;
 }
 }
 
@@ -105,9 +106,18 @@ private:
     void queryItemRange(const Envelope& queryEnv, std::size_t itemIndex,
         std::vector<std::size_t>& result) const;
 
+    void queryNode(const geom::Triangle& queryTri, const Envelope& queryEnv,
+        std::size_t level, std::size_t nodeIndex,
+        std::vector<std::size_t>& result) const;
+    void queryNodeRange(const geom::Triangle& queryTri, const Envelope& queryEnv,
+        std::size_t level, std::size_t nodeStartIndex,
+        std::vector<std::size_t>& result) const;
+    void queryItemRange(const geom::Triangle& queryTri, const Envelope& queryEnv,
+        std::size_t itemIndex, std::vector<std::size_t>& result) const;
+
+    static bool isExterior(const geom::Triangle& tri, const Envelope& env);
+
     std::size_t levelSize(std::size_t level) const;
-    bool isNodeEmpty(std::size_t level, std::size_t index);
-    bool isItemsNodeEmpty(std::size_t nodeIndex);
 
 
 public:
@@ -139,6 +149,18 @@ public:
     */
     void query(const Envelope& queryEnv, std::vector<std::size_t>& result) const;
 
+    /**
+    * Queries the index to find all items which intersect a triangle
+    * (including its boundary).
+    * Nodes which lie outside the triangle are not searched,
+    * which is much faster than querying the triangle extent
+    * for long, thin triangles.
+    *
+    * @param queryTri the query triangle
+    * @param result vector to fill with results
+    */
+    void query(const geom::Triangle& queryTri, std::vector<std::size_t>& result) const;
+
 };
 
 
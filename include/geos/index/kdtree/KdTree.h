@@ -67,6 +67,18 @@ private:
     void queryNode(KdNode* currentNode, const geom::Envelope& queryEnv, bool odd, KdNodeVisitor& visitor);
     KdNode* queryNodePoint(KdNode* currentNode, const geom::Coordinate& queryPt, bool odd);
 
+    /**
+    * A distinct point to be bulk-loaded, with the number of
+    * times it occurs in the input.
+    */
+    struct BuildItem {
+        std::size_t index;
+        std::size_t count;
+    };
+
+    KdNode* buildBalanced(const std::vector<geom::Coordinate>& pts, const std::vector<void*>& data,
+                          std::vector<BuildItem>::iterator begin, std::vector<BuildItem>::iterator end, bool odd);
+
     /**
     * Create a node on a locally managed deque to allow easy
     * disposal and hopefully faster allocation as well.
@@ -159,6 +171,24 @@ public:
     KdNode* insert(const geom::Coordinate& p);
     KdNode* insert(const geom::Coordinate& p, void* data);
 
+    /**
+    * Inserts a set of points in the kd-tree.
+    *
+    * If the tree is empty and the tolerance is zero, a balanced tree is
+    * bulk-loaded by recursively splitting the points at their median,
+    * alternately by X and Y. The nodes are allocated in a single pass,
+    * in depth-first order. Otherwise the points are inserted one at a
+    * time, in the given order.
+    *
+    * In both cases the resulting tree holds the same nodes as if the points
+    * had been inserted one at a time: repeated points share a node,
+    * which keeps the data of the first occurrence.
+    *
+    * @param pts the points to insert
+    * @param data the data for each point, or an empty vector
+    */
+    void insert(const std::vector<geom::Coordinate>& pts, const std::vector<void*>& data = {});
+
     /**
     * Performs a range search of the points in the index and visits all nodes found.
     */
@@ -174,6 +204,19 @@ public:
     */
     void query(const geom::Envelope& queryEnv, std::vector<KdNode*>& result);
 
+    /**
+    * Performs a range search for each of a set of envelopes.
+    * The nodes found in <code>queryEnvs[i]</code> are stored in <code>result[i]</code>.
+    *
+    * The tree must not be modified while the searches run.
+    *
+    * @param queryEnvs the envelopes to search
+    * @param result the nodes found for each envelope
+    * @param numThreads the number of threads to search with
+    *   (0 to use all hardware threads)
+    */
+    void query(const std::vector<geom::Envelope>& queryEnvs, std::vector<std::vector<KdNode*>>& result, std::size_t numThreads = 1);
+
     /**
     * Searches for a given point in the index and returns its node if found.
     */
@@ -262,6 +262,76 @@ public:
         return td.isWithinDistance(*root, *other.root, maxDistance);
     }
 
+    /**
+     * For each item in this tree, determine the nearest item in `other` tree
+     * using distance metric `distance`. The visitor is called as
+     * `visitor(item, otherItem, distance)` once for every item in this tree.
+     *
+     * With `numThreads` other than 1 (0 meaning one per hardware thread),
+     * the searches are divided among worker threads and `distance` must be
+     * safe to call concurrently. The visitor is always called on the calling
+     * thread, in the same order as a serial search.
+     */
+    template<typename ItemDistance, typename Visitor>
+    void nearestNeighbours(TemplateSTRtreeImpl<ItemType, BoundsTraits>& other,
+                           ItemDistance& distance, Visitor&& visitor, std::size_t numThreads = 1) {
+        if (!getRoot() || !other.getRoot()) {
+            return;
+        }
+
+        TemplateSTRtreeDistance<ItemType, BoundsTraits, ItemDistance> td(distance);
+        td.nearestNeighbours(*root, *other.root, visitor, numThreads);
+    }
+
+    template<typename ItemDistance, typename Visitor>
+    void nearestNeighbours(TemplateSTRtreeImpl<ItemType, BoundsTraits>& other,
+                           Visitor&& visitor, std::size_t numThreads = 1) {
+        ItemDistance id;
+        nearestNeighbours(other, id, visitor, numThreads);
+    }
+
+    /// @}
+    /// \defgroup join Distance join
+    /// @{
+
+    /**
+     * Determine all pairs of items, one from this tree and one from `other`
+     * tree, that are no farther apart than `maxDistance` using distance
+     * metric `distance`. The visitor is called as
+     * `visitor(item, otherItem, distance)` for every such pair.
+     *
+     * Both trees are descended simultaneously, and pairs of nodes whose
+     * bounds are farther apart than `maxDistance` are discarded without
+     * examining their items. The item distance must therefore never be less
+     * than the distance between the items' bounds.
+     *
+     * With `numThreads` other than 1 (0 meaning one per hardware thread),
+     * the traversal is divided among worker threads and `distance` must be
+     * safe to call concurrently. The visitor is always called on the calling
+     * thread, in the same order as a serial traversal.
+     */
+    template<typename ItemDistance, typename Visitor>
+    void queryWithinDistance(TemplateSTRtreeImpl<ItemType, BoundsTraits>& other, double maxDistance,
+                             ItemDistance& distance, Visitor&& visitor, std::size_t numThreads = 1) {
+        if (maxDistance < 0) {
+            throw util::IllegalArgumentException("Distance must be non-negative");
+        }
+
+        if (!getRoot() || !other.getRoot()) {
+            return;
+        }
+
+        TemplateSTRtreeDistance<ItemType, BoundsTraits, ItemDistance> td(distance);
+        td.pairsWithinDistance(*root, *other.root, maxDistance, visitor, numThreads);
+    }
+
+    template<typename ItemDistance, typename Visitor>
+    void queryWithinDistance(TemplateSTRtreeImpl<ItemType, BoundsTraits>& other, double maxDistance,
+                             Visitor&& visitor, std::size_t numThreads = 1) {
+        ItemDistance id;
+        queryWithinDistance(other, maxDistance, id, visitor, numThreads);
+    }
+
     /// @}
     /// \defgroup query Query
     /// @{
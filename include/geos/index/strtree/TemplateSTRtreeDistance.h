@@ -18,10 +18,12 @@
 #include <geos/index/strtree/TemplateSTRNode.h>
 #include <geos/index/strtree/TemplateSTRNodePair.h>
 #include <geos/util/IllegalArgumentException.h>
+#include <geos/util/parallel.h>
 #include <geos/util.h>
 
 #include <queue>
 #include <memory>
+#include <tuple>
 #include <vector>
 
 namespace geos {
@@ -59,9 +61,183 @@ public:
         return isWithinDistance(initPair, maxDistance);
     }
 
+    /**
+     * Visits every pair of items, one from each tree, that are within
+     * `maxDistance` of each other. Both trees are descended together and
+     * node pairs whose bounds are farther apart than `maxDistance` are
+     * pruned.
+     *
+     * The visitor is called as `visitor(item1, item2, distance)` on the
+     * calling thread, in the same order regardless of `numThreads`. When
+     * `numThreads` is not 1 the item distance may be evaluated
+     * concurrently and must be safe to call from several threads.
+     */
+    template<typename Visitor>
+    void pairsWithinDistance(const Node& root1, const Node& root2, double maxDistance,
+                             Visitor&& visitor, std::size_t numThreads = 1) {
+        if (numThreads == 1) {
+            visitPairsWithinDistance(root1, root2, maxDistance, visitor);
+            return;
+        }
+
+        auto tasks = partitionPairs(root1, root2, maxDistance,
+                                    16 * (numThreads == 0 ? util::hardwareThreadCount() : numThreads));
+
+        std::vector<std::vector<ItemDistanceTuple>> results(tasks.size());
+        util::parallelFor(tasks.size(), numThreads, [&](std::size_t i) {
+            auto& found = results[i];
+            auto collect = [&found](const ItemType& a, const ItemType& b, double d) {
+                found.emplace_back(a, b, d);
+            };
+            visitPairsWithinDistance(*tasks[i].first, *tasks[i].second, maxDistance, collect);
+        });
+
+        for (const auto& found : results) {
+            for (const auto& r : found) {
+                visitor(std::get<0>(r), std::get<1>(r), std::get<2>(r));
+            }
+        }
+    }
+
+    /**
+     * For every item under `root1`, finds the nearest item under `root2`.
+     *
+     * The visitor is called as `visitor(item1, nearestItem2, distance)` on
+     * the calling thread, once per item of the first tree, in tree order.
+     * When `numThreads` is not 1 the searches run concurrently and the item
+     * distance must be safe to call from several threads.
+     */
+    template<typename Visitor>
+    void nearestNeighbours(const Node& root1, const Node& root2,
+                           Visitor&& visitor, std::size_t numThreads = 1) {
+        std::vector<const Node*> leaves;
+        collectLeaves(root1, leaves);
+
+        std::vector<ItemDistanceTuple> results;
+        results.reserve(leaves.size());
+        for (const Node* leaf : leaves) {
+            results.emplace_back(leaf->getItem(), leaf->getItem(), DoubleInfinity);
+        }
+
+        util::parallelFor(leaves.size(), numThreads, [&](std::size_t i) {
+            NodePair initPair(*leaves[i], root2, m_id);
+            NodePair nearest = nearestPair(initPair, DoubleInfinity);
+            std::get<1>(results[i]) = nearest.getSecond().getItem();
+            std::get<2>(results[i]) = nearest.getDistance();
+        }, 64);
+
+        for (const auto& r : results) {
+            visitor(std::get<0>(r), std::get<1>(r), std::get<2>(r));
+        }
+    }
+
 private:
 
+    using ItemDistanceTuple = std::tuple<ItemType, ItemType, double>;
+    using NodeRefPair = std::pair<const Node*, const Node*>;
+
+    /*
+     * HEURISTIC: If both nodes are composite, expand the one with the
+     * largest area. Otherwise, expand whichever is composite.
+     */
+    static bool expandsFirst(const Node& node1, const Node& node2) {
+        if (node1.isComposite() && node2.isComposite()) {
+            return node1.getSize() > node2.getSize();
+        }
+        return node1.isComposite();
+    }
+
+    template<typename Visitor>
+    void visitPairsWithinDistance(const Node& node1, const Node& node2, double maxDistance, Visitor& visitor) {
+        if (node1.isDeleted() || node2.isDeleted()) {
+            return;
+        }
+        if (BoundsType::distance(node1.getBounds(), node2.getBounds()) > maxDistance) {
+            return;
+        }
+
+        if (node1.isLeaf() && node2.isLeaf()) {
+            double d = m_id(node1.getItem(), node2.getItem());
+            if (d <= maxDistance) {
+                visitor(node1.getItem(), node2.getItem(), d);
+            }
+            return;
+        }
+
+        if (expandsFirst(node1, node2)) {
+            for (const auto* child = node1.beginChildren(); child < node1.endChildren(); ++child) {
+                visitPairsWithinDistance(*child, node2, maxDistance, visitor);
+            }
+        } else {
+            for (const auto* child = node2.beginChildren(); child < node2.endChildren(); ++child) {
+                visitPairsWithinDistance(node1, *child, maxDistance, visitor);
+            }
+        }
+    }
+
+    /*
+     * Expands the root pair breadth-first into at least `minTasks`
+     * independent node pairs (or as many as exist). Each pair is replaced
+     * in place by its children, so visiting the tasks in order reproduces
+     * the order of the serial depth-first traversal.
+     */
+    std::vector<NodeRefPair> partitionPairs(const Node& root1, const Node& root2,
+                                            double maxDistance, std::size_t minTasks) {
+        std::vector<NodeRefPair> tasks{ { &root1, &root2 } };
+
+        bool expanded = true;
+        while (expanded && tasks.size() < minTasks) {
+            expanded = false;
+            std::vector<NodeRefPair> next;
+            next.reserve(tasks.size() * 4);
+
+            for (const auto& task : tasks) {
+                const Node& node1 = *task.first;
+                const Node& node2 = *task.second;
+
+                if (node1.isLeaf() && node2.isLeaf()) {
+                    next.push_back(task);
+                    continue;
+                }
+                if (BoundsType::distance(node1.getBounds(), node2.getBounds()) > maxDistance) {
+                    continue;
+                }
+
+                expanded = true;
+                if (expandsFirst(node1, node2)) {
+                    for (const auto* child = node1.beginChildren(); child < node1.endChildren(); ++child) {
+                        next.emplace_back(child, &node2);
+                    }
+                } else {
+                    for (const auto* child = node2.beginChildren(); child < node2.endChildren(); ++child) {
+                        next.emplace_back(&node1, child);
+                    }
+                }
+            }
+
+            tasks.swap(next);
+        }
+
+        return tasks;
+    }
+
+    static void collectLeaves(const Node& node, std::vector<const Node*>& leaves) {
+        if (node.isLeaf()) {
+            if (!node.isDeleted()) {
+                leaves.push_back(&node);
+            }
+            return;
+        }
+        for (const auto* child = node.beginChildren(); child < node.endChildren(); ++child) {
+            collectLeaves(*child, leaves);
+        }
+    }
+
     ItemPair nearestNeighbour(NodePair& initPair, double maxDistance) {
+        return nearestPair(initPair, maxDistance).getItems();
+    }
+
+    NodePair nearestPair(NodePair& initPair, double maxDistance) {
         double distanceLowerBound = maxDistance;
         std::unique_ptr<NodePair> minPair;
 
@@ -112,39 +288,22 @@ private:
             throw util::GEOSException("Error computing nearest neighbor");
         }
 
-        return minPair->getItems();
+        return *minPair;
     }
 
     void expandToQueue(const NodePair& pair, PairQueue& priQ, double minDistance) {
         const Node& node1 = pair.getFirst();
         const Node& node2 = pair.getSecond();
 
-        bool isComp1 = node1.isComposite();
-        bool isComp2 = node2.isComposite();
-
-        /**
-         * HEURISTIC: If both boundables are composite,
-         * choose the one with largest area to expand.
-         * Otherwise, simply expand whichever is composite.
-         */
-        if (isComp1 && isComp2) {
-            if (node1.getSize() > node2.getSize()) {
-                expand(node1, node2, false, priQ, minDistance);
-                return;
-            } else {
-                expand(node2, node1, true, priQ, minDistance);
-                return;
-            }
-        } else if (isComp1) {
+        if (node1.isLeaf() && node2.isLeaf()) {
+            throw util::IllegalArgumentException("neither boundable is composite");
+        }
+
+        if (expandsFirst(node1, node2)) {
             expand(node1, node2, false, priQ, minDistance);
-            return;
-        } else if (isComp2) {
+        } else {
             expand(node2, node1, true, priQ, minDistance);
-            return;
         }
-
-        throw util::IllegalArgumentException("neither boundable is composite");
-
     }
 
     void expand(const Node &nodeComposite, const Node &nodeOther, bool isFlipped, PairQueue& priQ,
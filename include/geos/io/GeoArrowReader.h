@@ -0,0 +1,100 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace geos {
+namespace io {
+
+/**
+ * \class GeoArrowReader
+ * \brief Creates geometries from the buffers of a GeoArrow array.
+ *
+ * GeoArrow stores an array of geometries of one type as a buffer of
+ * interleaved coordinates and up to three buffers of 32-bit offsets,
+ * outermost first:
+ *
+ * - points: no offsets, one coordinate per geometry;
+ * - linestrings and multipoints: geometry to coordinate offsets;
+ * - polygons: geometry to ring, ring to coordinate offsets;
+ * - multilinestrings: geometry to part, part to coordinate offsets;
+ * - multipolygons: geometry to polygon, polygon to ring and ring to
+ *   coordinate offsets.
+ *
+ * When the coordinates have a Z value (x, y, z for each coordinate, the
+ * layout of geom::Coordinate), linestrings and rings reference the
+ * coordinate buffer through a geom::ExternalCoordinateSequence instead
+ * of copying it.
+ *
+ * XY coordinates, the most common GeoArrow layout, are always copied:
+ * geom::Coordinate has a z member, so a buffer of x, y pairs cannot be
+ * referenced by a geom::CoordinateSequence. Points are copied too.
+ */
+class GEOS_DLL GeoArrowReader {
+public:
+
+    /**
+     * \brief Initialize reader with given GeometryFactory.
+     *
+     * The created geometries keep a pointer to the factory, which must
+     * outlive them.
+     */
+    GeoArrowReader(const geom::GeometryFactory& gf);
+
+    /// Initialize reader with the default GeometryFactory.
+    GeoArrowReader();
+
+    ~GeoArrowReader() = default;
+
+    /**
+     * \brief Create the geometries of a GeoArrow array.
+     *
+     * @param type GEOS_POINT, GEOS_LINESTRING, GEOS_POLYGON, GEOS_MULTIPOINT,
+     *             GEOS_MULTILINESTRING or GEOS_MULTIPOLYGON
+     * @param coords the interleaved coordinates
+     * @param numCoords the number of coordinates in coords
+     * @param hasZ whether coords holds x, y, z rather than x, y
+     * @param offsets the offset buffers, outermost first; the outermost
+     *                buffer has numGeoms + 1 entries
+     * @param numGeoms the number of geometries in the array
+     * @param owner keeps coords alive; a copy is held by every geometry
+     *              referencing coords. If null, the caller must keep
+     *              coords alive as long as the geometries.
+     * @return the geometries
+     *
+     * @throws util::IllegalArgumentException if a buffer is null, or an
+     *         offset is out of range or smaller than the one before it
+     */
+    std::vector<std::unique_ptr<geom::Geometry>> read(geom::GeometryTypeId type,
+            const double* coords, std::size_t numCoords, bool hasZ,
+            const std::int32_t* const* offsets, std::size_t numGeoms,
+            std::shared_ptr<const void> owner = nullptr) const;
+
+private:
+
+    const geom::GeometryFactory& geometryFactory;
+};
+
+} // namespace geos::io
+} // namespace geos
@@ -0,0 +1,107 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+
+#include <geos/geom/Geometry.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace geos {
+namespace io {
+
+/**
+ * \class GeoArrowWriter
+ * \brief Writes geometries into the buffers of a GeoArrow array.
+ *
+ * The buffers have the layout read by GeoArrowReader: interleaved
+ * coordinates and up to three buffers of 32-bit offsets, outermost first.
+ * A point, linestring or polygon is written as a single part of a
+ * multipoint, multilinestring or multipolygon array, with no part if it
+ * is empty. A null geometry is written as an empty one, and an empty
+ * point as NaN coordinates.
+ *
+ * The buffers are allocated by the caller: measure() returns their sizes,
+ * write() fills them in a single pass over the geometries.
+ */
+class GEOS_DLL GeoArrowWriter {
+public:
+
+    /// The number of entries of each buffer of a GeoArrow array
+    struct Sizes {
+        /// The number of coordinates
+        std::size_t numCoords;
+        /// The number of entries of each offset buffer, outermost first
+        std::size_t numOffsets[3];
+
+        Sizes() : numCoords(0), numOffsets{0, 0, 0} {}
+    };
+
+    /**
+     * \brief Initialize writer for arrays of the given geometry type.
+     *
+     * @param type GEOS_POINT, GEOS_LINESTRING, GEOS_POLYGON, GEOS_MULTIPOINT,
+     *             GEOS_MULTILINESTRING or GEOS_MULTIPOLYGON
+     * @param includeZ whether to write x, y, z rather than x, y
+     *
+     * @throws util::IllegalArgumentException if type is not supported
+     */
+    GeoArrowWriter(geom::GeometryTypeId type, bool includeZ = false);
+
+    ~GeoArrowWriter() = default;
+
+    /// Returns the number of offset buffers of the arrays written
+    std::size_t getNumOffsetBuffers() const
+    {
+        return numOffsetBuffers;
+    }
+
+    /**
+     * \brief Compute the buffer sizes needed to write the geometries.
+     *
+     * @throws util::IllegalArgumentException if a geometry cannot be
+     *         written in an array of the writer type
+     */
+    Sizes measure(const geom::Geometry* const* geoms, std::size_t numGeoms) const;
+
+    /**
+     * \brief Write the geometries into the given buffers.
+     *
+     * @param geoms the geometries, possibly null
+     * @param numGeoms the number of geometries
+     * @param coords receives the interleaved coordinates
+     * @param offsets the getNumOffsetBuffers() offset buffers, outermost
+     *                first
+     * @param capacity the number of entries of each buffer
+     * @return the number of entries written in each buffer
+     *
+     * @throws util::IllegalArgumentException if a geometry cannot be
+     *         written in an array of the writer type, if a buffer is too
+     *         small or if an offset exceeds 32 bits
+     */
+    Sizes write(const geom::Geometry* const* geoms, std::size_t numGeoms,
+                double* coords, std::int32_t* const* offsets, const Sizes& capacity) const;
+
+private:
+
+    geom::GeometryTypeId geometryType;
+    bool includeZ;
+    std::size_t numOffsetBuffers;
+};
+
+} // namespace geos::io
+} // namespace geos
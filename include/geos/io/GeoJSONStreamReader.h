@@ -0,0 +1,100 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+
+#include <geos/io/GeoJSON.h>
+#include <geos/geom/GeometryFactory.h>
+
+#include <istream>
+#include <memory>
+
+namespace geos {
+namespace io {
+
+/**
+ * \class GeoJSONStreamReader
+ * \brief Reads the features of a GeoJSON document one at a time.
+ *
+ * GeoJSONReader parses the whole text into a JSON document before
+ * creating any geometry, so its memory use grows with the size of the
+ * input. GeoJSONStreamReader instead walks the input stream with the
+ * SAX interface of the JSON parser: only the feature being read is held
+ * in memory, and the coordinates are appended directly to the storage of
+ * its coordinate sequences. A FeatureCollection of any size can thus be
+ * read from a file (through a std::ifstream) in bounded memory.
+ *
+ * The input may be a FeatureCollection, a single Feature or a bare
+ * geometry, which is returned as a feature without properties.
+ * Geometries are read as by GeoJSONReader. Members other than
+ * "type", "geometry", "properties", "coordinates", "geometries" and
+ * "features" are skipped.
+ *
+ * The stream must stay valid for the life of the reader.
+ */
+class GEOS_DLL GeoJSONStreamReader {
+public:
+
+    /**
+     * \brief Initialize reader on a stream with the default GeometryFactory.
+     */
+    explicit GeoJSONStreamReader(std::istream& instr);
+
+    /**
+     * \brief Initialize reader on a stream with the given GeometryFactory.
+     *
+     * All Geometry objects created by the reader will contain a pointer
+     * to the given factory, which must outlive them.
+     */
+    GeoJSONStreamReader(std::istream& instr, const geom::GeometryFactory& gf);
+
+    ~GeoJSONStreamReader();
+
+    /**
+     * \brief Read the next feature of the stream.
+     *
+     * @return the feature, or nullptr once all features have been read
+     * @throws ParseException if the text is not valid GeoJSON
+     */
+    std::unique_ptr<GeoJSONFeature> next();
+
+private:
+    class FeatureBuilder;
+
+    enum class State { START, MEMBERS, FEATURES, END };
+
+    std::istream& instr;
+    std::unique_ptr<FeatureBuilder> rootBuilder;
+    std::unique_ptr<FeatureBuilder> featureBuilder;
+    State state;
+    bool firstItem;
+    bool hasFeatures;
+
+    void readStart();
+    bool readSeparator(char closer);
+    void readMember();
+    std::unique_ptr<GeoJSONFeature> readFeature();
+    std::unique_ptr<GeoJSONFeature> readEnd();
+
+    int skipWhitespace();
+    void expect(char c);
+    std::string readKey();
+    void skipNumber();
+};
+
+} // namespace io
+} // namespace geos
+
@@ -0,0 +1,92 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+
+#include <geos/io/GeoJSON.h>
+#include <geos/io/GeoJSONWriter.h>
+#include <geos/io/Writer.h>
+
+#include <cstddef>
+#include <ostream>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+namespace geos {
+namespace io {
+
+/**
+ * \class GeoJSONStreamWriter
+ * \brief Writes a GeoJSON FeatureCollection to a stream one feature at a time.
+ *
+ * The features are not kept: each one is serialized as soon as it is
+ * written, and the text is sent to the stream in blocks. The collection
+ * is closed by finish(), which must be called once all features have been
+ * written; the stream must stay valid until then.
+ *
+ * See also GeoJSONStreamReader.
+ */
+class GEOS_DLL GeoJSONStreamWriter {
+public:
+
+    /**
+     * \brief Initialize writer on a stream.
+     *
+     * @param os the stream to write to
+     * @param writer the writer whose settings (such as the rounding
+     *               precision) are used to write the features
+     */
+    explicit GeoJSONStreamWriter(std::ostream& os, const GeoJSONWriter& writer = GeoJSONWriter());
+
+    ~GeoJSONStreamWriter() = default;
+
+    /// Append a feature to the collection
+    void write(const GeoJSONFeature& feature);
+
+    /// Append a geometry to the collection, as a feature without properties
+    void write(const geom::Geometry* geometry);
+
+    /**
+     * \brief Close the FeatureCollection and flush the text to the stream.
+     *
+     * No feature can be written afterwards.
+     */
+    void finish();
+
+private:
+    static constexpr std::size_t FLUSH_SIZE = 1 << 16;
+
+    std::ostream& os;
+    GeoJSONWriter featureWriter;
+    Writer buffer;
+    std::size_t numFeatures;
+    bool finished;
+
+    void beginFeature();
+    void endFeature();
+    void flush();
+};
+
+} // namespace geos::io
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
@@ -19,7 +19,6 @@
 #include "GeoJSON.h"
 #include <string>
 #include <cctype>
-#include "geos/vend/include_nlohmann_json.hpp"
 
 #ifdef _MSC_VER
 #pragma warning(push)
@@ -29,18 +28,7 @@
 // Forward declarations
 namespace geos {
 namespace geom {
-class Coordinate;
-class CoordinateSequence;
 class Geometry;
-class GeometryCollection;
-class Point;
-class LineString;
-class LinearRing;
-class Polygon;
-class MultiPoint;
-class MultiLineString;
-class MultiPolygon;
-class PrecisionModel;
 }
 namespace io {
 class Writer;
@@ -61,9 +49,19 @@ enum class GeoJSONType {
  * \brief Outputs the GeoJSON representation of a Geometry.
  * See also GeoJSONReader for parsing.
  *
+ * The text is written directly from the coordinate sequences,
+ * without building an intermediate JSON document.
+ *
+ * By default numbers are written in the shortest form that reads
+ * back to the same value. With setRoundingPrecision() coordinates
+ * are instead rounded to a number of decimals, without trailing zeros.
+ * Either way, integral values are written with a ".0" decimal part.
+ *
+ * See GeoJSONStreamWriter to write a FeatureCollection feature by feature.
  */
 class GEOS_DLL GeoJSONWriter {
 public:
+    GeoJSONWriter();
     ~GeoJSONWriter() = default;
 
     std::string write(const geom::Geometry* geometry, GeoJSONType type = GeoJSONType::GEOMETRY);
@@ -74,37 +72,32 @@ public:
 
     std::string write(const GeoJSONFeatureCollection& features);
 
-private:
-
-    std::pair<double, double> convertCoordinate(const geom::Coordinate* c);
-
-    std::vector<std::pair<double, double>> convertCoordinateSequence(const geom::CoordinateSequence* c);
-
-    void encode(const geom::Geometry* g, GeoJSONType type, geos_nlohmann::ordered_json& j);
-
-    void encodeGeometry(const geom::Geometry* g, geos_nlohmann::ordered_json& j);
+    /// Append the GeoJSON of a Geometry to the given Writer
+    void write(const geom::Geometry* geometry, Writer* writer, GeoJSONType type = GeoJSONType::GEOMETRY);
 
-    void encodePoint(const geom::Point* p, geos_nlohmann::ordered_json& j);
+    /// Append the GeoJSON of a Feature to the given Writer
+    void write(const GeoJSONFeature& feature, Writer* writer);
 
-    void encodeLineString(const geom::LineString* l, geos_nlohmann::ordered_json& j);
+    /// Append the GeoJSON of a FeatureCollection to the given Writer
+    void write(const GeoJSONFeatureCollection& features, Writer* writer);
 
-    void encodePolygon(const geom::Polygon* p, geos_nlohmann::ordered_json& j);
+    /**
+     * Sets the number of decimals of the coordinates written.
+     * A precision of -1 (the default) writes the shortest
+     * representation that reads back to the same value.
+     *
+     * @param decimals the new precision to use
+     */
+    void setRoundingPrecision(int decimals);
 
-    void encodeMultiPoint(const geom::MultiPoint* p, geos_nlohmann::ordered_json& j);
+    int getRoundingPrecision() const
+    {
+        return decimalPlaces;
+    }
 
-    void encodeMultiLineString(const geom::MultiLineString* l, geos_nlohmann::ordered_json& j);
-
-    void encodeMultiPolygon(const geom::MultiPolygon* m, geos_nlohmann::ordered_json& j);
-
-    void encodeGeometryCollection(const geom::GeometryCollection* g, geos_nlohmann::ordered_json& j);
-
-    void encodeFeature(const geom::Geometry* g, geos_nlohmann::ordered_json& j);
-
-    void encodeFeatureCollection(const geom::Geometry* g, geos_nlohmann::ordered_json& j);
-
-    void encodeFeature(const GeoJSONFeature& feature, geos_nlohmann::ordered_json& j);
+private:
 
-    void encodeGeoJSONValue(const std::string& key, const GeoJSONValue& value, geos_nlohmann::ordered_json& j);
+    int decimalPlaces;
 
 };
 
@@ -0,0 +1,39 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+namespace geos {
+namespace io {
+
+/// Constant values used by the TWKB format, whose geometry types are those of WKB
+namespace TWKBConstants {
+
+    enum metadataFlag {
+        twkbBBox = 0x01,
+        twkbSize = 0x02,
+        twkbIdList = 0x04,
+        twkbExtendedDims = 0x08,
+        twkbEmpty = 0x10
+    };
+
+    enum extendedDimsFlag {
+        twkbHasZ = 0x01,
+        twkbHasM = 0x02
+    };
+
+}
+
+} // namespace geos::io
+} // namespace geos
@@ -0,0 +1,96 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+
+#include <cstddef>
+#include <iosfwd>
+#include <memory>
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+class GeometryFactory;
+} // namespace geom
+} // namespace geos
+
+namespace geos {
+namespace io {
+
+/**
+ * \class TWKBReader
+ *
+ * \brief Reads a Geometry from Tiny Well-Known Binary format.
+ *
+ * TWKB geometries are self-delimiting: a buffer or a stream holding
+ * several of them one after the other can be read one geometry at a
+ * time. The id lists are ignored, and so are M values, which GEOS
+ * geometries do not hold.
+ *
+ * Geometry collections may be nested up to 64 levels deep; deeper
+ * input is rejected like any other invalid input.
+ *
+ * \see TWKBWriter
+ */
+class GEOS_DLL TWKBReader {
+
+public:
+
+    /**
+     * \brief Initialize reader with given GeometryFactory.
+     *
+     * The created geometries keep a pointer to the factory, which must
+     * outlive them.
+     */
+    TWKBReader(const geom::GeometryFactory& f);
+
+    /// Initialize reader with the default GeometryFactory.
+    TWKBReader();
+
+    /**
+     * \brief Reads a Geometry from a buffer.
+     *
+     * @param buf the buffer to read from
+     * @param size the size of the buffer in bytes
+     * @param bytesRead if not null, receives the number of bytes of the
+     *                  geometry read, which may be less than size
+     * @return the Geometry read
+     * @throws ParseException if the buffer does not start with a valid
+     *         TWKB geometry
+     */
+    std::unique_ptr<geom::Geometry> read(const unsigned char* buf, std::size_t size,
+                                         std::size_t* bytesRead = nullptr) const;
+
+    /**
+     * \brief Reads the next Geometry of a stream.
+     *
+     * The stream is left positioned after the geometry.
+     *
+     * @param is the stream to read from
+     * @return the Geometry read, or nullptr if the stream is at its end
+     * @throws ParseException if the stream does not continue with a
+     *         valid TWKB geometry
+     */
+    std::unique_ptr<geom::Geometry> read(std::istream& is) const;
+
+private:
+
+    const geom::GeometryFactory& factory;
+};
+
+} // namespace geos::io
+} // namespace geos
@@ -0,0 +1,143 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+} // namespace geom
+} // namespace geos
+
+namespace geos {
+namespace io {
+
+/**
+ * \class TWKBWriter
+ *
+ * \brief Writes a Geometry in Tiny Well-Known Binary format.
+ *
+ * TWKB (https://github.com/TWKB/Specification) stores the ordinates
+ * rounded to a number of decimal digits, as the variable-length
+ * difference to the previous vertex of the geometry. A geometry
+ * typically takes a fraction of the space of its WKB.
+ *
+ * A collection is written with a header per member geometry. Empty
+ * members of multi-geometries cannot be represented and are rejected.
+ */
+class GEOS_DLL TWKBWriter {
+
+public:
+
+    /**
+     * \brief Initialize writer with the precision of the x and y ordinates.
+     *
+     * @param xyPrecision the number of decimal digits of x and y, from -7
+     *                    to 7. A negative precision rounds to tens,
+     *                    hundreds...
+     * @param dims 2 or 3. Note that 3 indicates up to 3 dimensions will
+     *             be written but 2D TWKB is still produced for 2D
+     *             geometries.
+     */
+    TWKBWriter(int xyPrecision = 0, uint8_t dims = 2);
+
+    ~TWKBWriter() = default;
+
+    int
+    getXYPrecision() const
+    {
+        return xyPrecision;
+    }
+
+    /// Sets the number of decimal digits of x and y, from -7 to 7
+    void setXYPrecision(int newPrecision);
+
+    int
+    getZPrecision() const
+    {
+        return zPrecision;
+    }
+
+    /// Sets the number of decimal digits of z, from 0 to 7
+    void setZPrecision(int newPrecision);
+
+    uint8_t
+    getOutputDimension() const
+    {
+        return outputDimension;
+    }
+
+    /// Sets the output dimension, 2 or 3
+    void setOutputDimension(uint8_t newOutputDimension);
+
+    bool
+    getIncludeSize() const
+    {
+        return includeSize;
+    }
+
+    /// Sets whether the size in bytes of each geometry is written, letting readers skip it
+    void
+    setIncludeSize(bool newIncludeSize)
+    {
+        includeSize = newIncludeSize;
+    }
+
+    bool
+    getIncludeBBox() const
+    {
+        return includeBBox;
+    }
+
+    /// Sets whether the bounding box of each geometry is written
+    void
+    setIncludeBBox(bool newIncludeBBox)
+    {
+        includeBBox = newIncludeBBox;
+    }
+
+    /**
+     * \brief Append the TWKB of a Geometry to a buffer.
+     *
+     * @throws util::IllegalArgumentException if the geometry cannot be
+     *         represented in TWKB
+     */
+    void write(const geom::Geometry& g, std::vector<unsigned char>& buf) const;
+
+    /**
+     * \brief Write a Geometry to an ostream.
+     *
+     * @throws util::IllegalArgumentException if the geometry cannot be
+     *         represented in TWKB
+     */
+    void write(const geom::Geometry& g, std::ostream& os) const;
+
+private:
+
+    int xyPrecision;
+    int zPrecision;
+    uint8_t outputDimension;
+    bool includeSize;
+    bool includeBBox;
+};
+
+} // namespace geos::io
+} // namespace geos
@@ -0,0 +1,189 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Geometry.h>
+#include <geos/io/ParseException.h>
+#include <geos/io/OrdinateSet.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Coordinate;
+class CoordinateSequence;
+class GeometryCollection;
+class Point;
+class LineString;
+class LinearRing;
+class Polygon;
+class MultiPoint;
+class MultiLineString;
+class MultiPolygon;
+class PrecisionModel;
+}
+}
+
+
+namespace geos {
+namespace io {
+
+/**
+ * \class WKTBufferReader
+ * \brief WKT parser working directly on a character buffer.
+ *
+ * Reads the same WKT dialect as WKTReader and produces the same geometries,
+ * but is designed for throughput when loading large amounts of WKT:
+ *
+ * - the text is tokenized in place, without allocating a string per token;
+ * - numbers are parsed with util::parseDouble, which is independent of the
+ *   current locale, so no CLocalizer is needed;
+ * - coordinates are appended straight into the storage of the
+ *   coordinate sequence.
+ *
+ * Several geometries separated by white space (such as a file with one
+ * geometry per line) can be read from the same buffer with readNext().
+ *
+ * The messages of the ParseException thrown for invalid text
+ * may differ from those of WKTReader.
+ */
+class GEOS_DLL WKTBufferReader {
+public:
+
+    /**
+     * \brief Initialize parser with given GeometryFactory.
+     *
+     * Note that all Geometry objects created by the
+     * parser will contain a pointer to the given factory
+     * so be sure you'll keep the factory alive for the
+     * whole WKTBufferReader and created Geometry life.
+     */
+    explicit WKTBufferReader(const geom::GeometryFactory& gf)
+        : geometryFactory(&gf)
+        , precisionModel(gf.getPrecisionModel())
+        , fixStructure(false)
+        {};
+
+    /**
+     * \brief Initialize parser with default GeometryFactory.
+     */
+    WKTBufferReader()
+        : geometryFactory(geom::GeometryFactory::getDefaultInstance())
+        , precisionModel(geometryFactory->getPrecisionModel())
+        , fixStructure(false)
+        {};
+
+    void
+    setFixStructure(bool doFixStructure) {
+        fixStructure = doFixStructure;
+    }
+
+    /// Parse a WKT string returning a Geometry
+    template<typename T>
+    std::unique_ptr<T> read(const std::string& wkt) const {
+        auto g = read(wkt);
+        auto gt = dynamic_cast<const T*>(g.get());
+        if (!gt) {
+            throw io::ParseException("Unexpected WKT type");
+        }
+        return std::unique_ptr<T>(static_cast<T*>(g.release()));
+    }
+
+    /**
+     * \brief Parse a WKT string returning a Geometry.
+     *
+     * The text must contain a single geometry, optionally surrounded
+     * by white space.
+     */
+    std::unique_ptr<geom::Geometry> read(const std::string& wellKnownText) const
+    {
+        return read(wellKnownText.data(), wellKnownText.size());
+    }
+
+    /**
+     * \brief Parse the WKT held in a character buffer, which does not
+     * need to be null-terminated.
+     *
+     * @param text the first character of the buffer
+     * @param length the number of characters in the buffer
+     */
+    std::unique_ptr<geom::Geometry> read(const char* text, std::size_t length) const;
+
+    /**
+     * \brief Parse the next geometry of a buffer holding several
+     * geometries separated by white space.
+     *
+     * @param text the buffer
+     * @param pos the offset in the buffer to start reading at;
+     *            advanced past the geometry read
+     * @return the geometry read, or nullptr if only white space remains
+     */
+    std::unique_ptr<geom::Geometry> readNext(const std::string& text, std::size_t& pos) const
+    {
+        return readNext(text.data(), text.size(), pos);
+    }
+
+    /**
+     * \brief Parse the next geometry of a character buffer holding several
+     * geometries separated by white space.
+     *
+     * @param text the first character of the buffer
+     * @param length the number of characters in the buffer
+     * @param pos the offset in the buffer to start reading at;
+     *            advanced past the geometry read
+     * @return the geometry read, or nullptr if only white space remains
+     */
+    std::unique_ptr<geom::Geometry> readNext(const char* text, std::size_t length, std::size_t& pos) const;
+
+private:
+    class Tokenizer;
+    struct Word;
+
+    const geom::GeometryFactory* geometryFactory;
+    const geom::PrecisionModel* precisionModel;
+    bool fixStructure;
+
+    std::unique_ptr<geom::Geometry> readGeometryTaggedText(Tokenizer& tokenizer, OrdinateSet& ordinateFlags) const;
+    std::unique_ptr<geom::Point> readPointText(Tokenizer& tokenizer, OrdinateSet& ordinateFlags) const;
+    std::unique_ptr<geom::LineString> readLineStringText(Tokenizer& tokenizer, OrdinateSet& ordinateFlags) const;
+    std::unique_ptr<geom::LinearRing> readLinearRingText(Tokenizer& tokenizer, OrdinateSet& ordinateFlags) const;
+    std::unique_ptr<geom::MultiPoint> readMultiPointText(Tokenizer& tokenizer, OrdinateSet& ordinateFlags) const;
+    std::unique_ptr<geom::Polygon> readPolygonText(Tokenizer& tokenizer, OrdinateSet& ordinateFlags) const;
+    std::unique_ptr<geom::MultiLineString> readMultiLineStringText(Tokenizer& tokenizer, OrdinateSet& ordinateFlags) const;
+    std::unique_ptr<geom::MultiPolygon> readMultiPolygonText(Tokenizer& tokenizer, OrdinateSet& ordinateFlags) const;
+    std::unique_ptr<geom::GeometryCollection> readGeometryCollectionText(Tokenizer& tokenizer, OrdinateSet& ordinateFlags) const;
+
+    std::unique_ptr<geom::CoordinateSequence> getCoordinates(Tokenizer& tokenizer, OrdinateSet& ordinateFlags,
+                                                             bool closeRing) const;
+    void getPreciseCoordinate(Tokenizer& tokenizer, OrdinateSet& ordinateFlags, geom::Coordinate& coord) const;
+
+    static double getNextNumber(Tokenizer& tokenizer);
+    static bool getNextEmptyOrOpener(Tokenizer& tokenizer, OrdinateSet& ordinateFlags);
+    static bool getNextCloserOrComma(Tokenizer& tokenizer);
+    static void getNextCloser(Tokenizer& tokenizer);
+    static Word getNextWord(Tokenizer& tokenizer);
+
+    static void readOrdinateFlags(const Word& s, OrdinateSet& ordinateFlags);
+};
+
+} // namespace io
+} // namespace geos
+
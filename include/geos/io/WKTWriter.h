@@ -22,6 +22,7 @@
 
 #include <geos/export.h>
 
+#include <cstddef>
 #include <string>
 #include <cctype>
 
@@ -91,6 +92,20 @@ public:
     // Send Geometry's WKT to the given Writer
     void write(const geom::Geometry* geometry, Writer* writer);
 
+    /**
+     * \brief Writes the WKT of a Geometry into a caller-provided buffer.
+     *
+     * Like snprintf, at most size - 1 characters are written, followed
+     * by a null character. Nothing is allocated for the text.
+     *
+     * @param geometry the Geometry to write
+     * @param buffer the buffer to write into
+     * @param size the size of the buffer
+     * @return the length of the WKT, not counting the null character.
+     *         The WKT has been truncated if it is size or more.
+     */
+    std::size_t write(const geom::Geometry* geometry, char* buffer, std::size_t size);
+
     std::string writeFormatted(const geom::Geometry* geometry);
 
     void writeFormatted(const geom::Geometry* geometry, Writer* writer);
@@ -272,6 +287,8 @@ private:
         bool isFormatted, Writer* writer);
 
     void indent(int level, Writer* writer) const;
+
+    void appendNumber(double d, Writer* writer) const;
 };
 
 } // namespace geos::io
@@ -21,6 +21,8 @@
 
 #include <geos/export.h>
 
+#include <cstddef>
+#include <cstring>
 #include <string>
 
 #ifdef _MSC_VER
@@ -31,15 +33,130 @@
 namespace geos {
 namespace io {
 
+/**
+ * \class Writer
+ * \brief A character buffer that text output is appended to.
+ *
+ * By default the text is held in a buffer that grows as needed.
+ * A Writer can also write into a buffer provided by the caller,
+ * in which case the text that does not fit is discarded, but still
+ * counted by getLength(). A null buffer of size 0 therefore only
+ * measures the text.
+ */
 class GEOS_DLL Writer {
 public:
     Writer();
+
+    /**
+     * \brief Creates a Writer writing into a caller-provided buffer.
+     *
+     * No null character is written. The text itself is never
+     * allocated: only a number that does not fit in the buffer is
+     * formatted in a small scratch space first.
+     *
+     * @param buffer the buffer to write into, or null if size is 0
+     * @param size the size of the buffer
+     * @throws util::IllegalArgumentException if buffer is null and size is not 0
+     */
+    Writer(char* buffer, std::size_t size);
+
     void reserve(std::size_t capacity);
     ~Writer() = default;
-    void write(const std::string& txt);
+
+    void write(const std::string& txt)
+    {
+        write(txt.data(), txt.size());
+    }
+
+    void write(const char* txt)
+    {
+        write(txt, std::strlen(txt));
+    }
+
+    void write(const char* txt, std::size_t len)
+    {
+        if (length + len <= getCapacity()) {
+            std::memcpy(getData() + length, txt, len);
+            length += len;
+        }
+        else {
+            writeOverflow(txt, len);
+        }
+    }
+
+    void write(char c)
+    {
+        if (length < getCapacity()) {
+            getData()[length++] = c;
+        }
+        else {
+            writeOverflow(&c, 1);
+        }
+    }
+
+    /**
+     * \brief Returns space for up to n characters to be formatted in place.
+     *
+     * The characters formatted must then be added with commit().
+     */
+    char* prepare(std::size_t n)
+    {
+        if (length + n <= getCapacity()) {
+            return getData() + length;
+        }
+        return prepareOverflow(n);
+    }
+
+    /**
+     * \brief Adds the n characters formatted in the space returned
+     * by prepare().
+     */
+    void commit(std::size_t n)
+    {
+        if (usingScratch) {
+            usingScratch = false;
+            writeOverflow(str.data(), n);
+        }
+        else {
+            length += n;
+        }
+    }
+
+    /// Returns the number of characters written
+    std::size_t getLength() const
+    {
+        return length;
+    }
+
+    /// Discards the text written
+    void clear()
+    {
+        length = 0;
+    }
+
     const std::string& toString();
+
 private:
     std::string str;
+    char* buf;
+    std::size_t bufSize;
+    std::size_t length;
+    bool external;
+    bool usingScratch;
+
+    char* getData()
+    {
+        return external ? buf : &str[0];
+    }
+
+    std::size_t getCapacity() const
+    {
+        return external ? bufSize : str.size();
+    }
+
+    void writeOverflow(const char* txt, std::size_t len);
+
+    char* prepareOverflow(std::size_t n);
 };
 
 } // namespace geos::io
@@ -69,6 +69,7 @@ private:
     /* methods */
     geom::Coordinate round(const geom::Coordinate& c);
     HotPixel* find(const geom::Coordinate& pixelPt);
+    void addOneByOne(const std::vector<geom::Coordinate>& pts, const std::vector<geom::Coordinate>& nodePts);
 
 public:
 
@@ -79,6 +80,14 @@ public:
     void addNodes(const geom::CoordinateSequence* pts);
     void addNodes(const std::vector<geom::Coordinate>& pts);
 
+    /**
+    * Adds hot pixels for a set of vertices and a set of nodes.
+    * This has the same effect as adding the nodes and then the
+    * vertices, but if the index is empty it is bulk-loaded,
+    * which gives a balanced index without shuffling the input.
+    */
+    void add(const std::vector<geom::Coordinate>& pts, const std::vector<geom::Coordinate>& nodePts);
+
     /**
     * Visits all the hot pixels which may intersect a segment (p0-p1).
     * The visitor must determine whether each hot pixel actually intersects
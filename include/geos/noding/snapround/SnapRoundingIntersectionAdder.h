@@ -69,6 +69,17 @@ private:
     // const geom::PrecisionModel* pm;
     double nearnessTol;
 
+    struct DeferredNode {
+        NodedSegmentString* ss;
+        geom::Coordinate pt;
+        std::size_t segIndex;
+    };
+
+    bool deferNodes;
+    std::vector<DeferredNode> deferredNodes;
+
+    void addNode(SegmentString* ss, const geom::Coordinate& pt, std::size_t segIndex);
+
     /**
     * If an endpoint of one segment is near
     * the interior of the other segment, add it as an intersection.
@@ -92,10 +103,26 @@ public:
         : SegmentIntersector()
         , intersections(new std::vector<geom::Coordinate>)
         , nearnessTol(p_nearnessTol)
+        , deferNodes(false)
     {}
 
     std::unique_ptr<std::vector<geom::Coordinate>> getIntersections() { return std::move(intersections); };
 
+    /**
+    * Sets whether nodes are recorded rather than added to the
+    * segment strings as they are found.
+    * Since the segment strings are then only read, several adders may
+    * process segments of the same strings concurrently.
+    * The recorded nodes are added by addDeferredNodes().
+    */
+    void setDeferNodes(bool isDeferred) { deferNodes = isDeferred; };
+
+    /**
+    * Adds the nodes recorded while nodes were deferred to their
+    * segment strings, in the order they were found.
+    */
+    void addDeferredNodes();
+
     /**
     * This method is called by clients
     * of the {@link SegmentIntersector} class to process
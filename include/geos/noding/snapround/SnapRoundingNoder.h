@@ -77,29 +77,46 @@ private:
     */
     static constexpr int INTERSECTION_NEARNESS_FACTOR = 100;
 
+    /**
+    * The number of monotone chains intersected by each task
+    * when intersections are found in parallel.
+    */
+    static constexpr std::size_t CHAIN_BLOCK_SIZE = 64;
+
+    /**
+    * A hot pixel intersected by a segment of a snapped segment string.
+    */
+    struct PixelHit {
+        std::size_t segIndex;
+        HotPixel* hp;
+        bool containsVertex; // whether the pixel contains a segment endpoint
+    };
+
     // Members
     const geom::PrecisionModel* pm;
     noding::snapround::HotPixelIndex pixelIndex;
     std::vector<SegmentString*> snappedResult;
+    std::size_t numThreads;
 
     // Methods
     void snapRound(std::vector<SegmentString*>& inputSegStrings, std::vector<SegmentString*>& resultNodedSegments);
 
     /**
-    * Creates HotPixels for each vertex in the input segStrings.
-    * The HotPixels are not marked as nodes, since they will
-    * only be nodes in the final line arrangement
+    * Gets the vertices of the input segStrings.
+    * HotPixels are created for them which are not marked as nodes,
+    * since they will only be nodes in the final line arrangement
     * if they interact with other segments (or they are already
     * created as intersection nodes).
     */
-    void addVertexPixels(std::vector<SegmentString*>& segStrings);
+    static std::vector<geom::Coordinate> getVertices(const std::vector<SegmentString*>& segStrings);
 
     /**
     * Detects interior intersections in the collection of {@link SegmentString}s,
     * and adds nodes for them to the segment strings.
-    * Also creates HotPixel nodes for the intersection points.
+    * Returns the intersection points, for which HotPixel nodes are created.
     */
-    void addIntersectionPixels(std::vector<SegmentString*>& segStrings);
+    std::vector<geom::Coordinate> findInteriorIntersections(std::vector<SegmentString*>& segStrings);
+    std::vector<geom::Coordinate> findInteriorIntersectionsParallel(std::vector<SegmentString*>& segStrings, double tolerance);
 
     /**
     * Gets a list of the rounded coordinates.
@@ -118,7 +135,8 @@ private:
     * @return the snapped segment strings
     */
     void computeSnaps(const std::vector<SegmentString*>& segStrings, std::vector<SegmentString*>& snapped);
-    NodedSegmentString* computeSegmentSnaps(NodedSegmentString* ss);
+    void computeSnapsParallel(const std::vector<SegmentString*>& segStrings, std::vector<SegmentString*>& snapped);
+    NodedSegmentString* computeSegmentSnaps(NodedSegmentString* ss, std::vector<PixelHit>* hits);
 
     /**
     * Snaps a segment in a segmentString to HotPixels that it intersects.
@@ -127,8 +145,11 @@ private:
     * @param p1 the segment end coordinate
     * @param ss the segment string to add intersections to
     * @param segIndex the index of the segment
+    * @param hits if not null, the intersected hot pixels are recorded here
+    *        instead of being snapped to
     */
-    void snapSegment(geom::Coordinate& p0, geom::Coordinate& p1, NodedSegmentString* ss, std::size_t segIndex);
+    void snapSegment(geom::Coordinate& p0, geom::Coordinate& p1, NodedSegmentString* ss, std::size_t segIndex,
+                     std::vector<PixelHit>* hits);
 
     /**
     * Add nodes for any vertices in hot pixels that were
@@ -143,8 +164,21 @@ public:
     SnapRoundingNoder(const geom::PrecisionModel* p_pm)
         : pm(p_pm)
         , pixelIndex(p_pm)
+        , numThreads(1)
         {}
 
+    /**
+    * Sets the number of threads used to find intersections and
+    * to snap segment strings to hot pixels.
+    * The noded result is the same for any number of threads.
+    *
+    * @param p_numThreads the number of threads (0 to use all hardware threads)
+    */
+    void setNumThreads(std::size_t p_numThreads)
+    {
+        numThreads = p_numThreads;
+    }
+
     /**
     * @return a Collection of NodedSegmentStrings representing the substrings
     */
@@ -26,11 +26,14 @@
 // Forward declarations
 namespace geos {
 namespace geom {
+    class CoordinateXY;
     class Envelope;
     class Geometry;
 }
 namespace operation {
 namespace cluster {
+    class ConcurrentUnionFind;
+    class PointGrid;
     class UnionFind;
 }
 }
@@ -47,6 +50,25 @@ namespace cluster {
 class GEOS_DLL AbstractClusterFinder {
 
 public:
+    virtual ~AbstractClusterFinder() = default;
+
+    /**
+     * Set the number of threads used to cluster geometries. With a single
+     * thread (the default) geometries are clustered serially. With zero,
+     * one thread per processor is used.
+     *
+     * Clusters found with several threads contain the same elements as those
+     * found serially, but may be reported in a different order. Clusters found
+     * with several threads, and clusters of Point-only inputs found with
+     * `processPoints` whatever the number of threads, are ordered by their
+     * smallest element.
+     *
+     * @param numThreads the number of threads to use
+     */
+    void setNumThreads(std::size_t numThreads) {
+        m_numThreads = numThreads;
+    }
+
     /**
      * Cluster the provided geometries, returning an object that provides access
      * to the components of each cluster.
@@ -123,7 +145,56 @@ protected:
                  index::strtree::TemplateSTRtree<std::size_t> & index,
                  UnionFind & uf);
 
+    /**
+     * Multi-threaded equivalent of `process`. The index has already been built,
+     * and may be queried concurrently.
+     * @param components a vector of Geometry components
+     * @param index a spatial index storing pointers to those components
+     * @param uf a ConcurrentUnionFind
+     * @param numThreads the number of threads to use
+     * @return a vector of with the indices of all components that should be included in a cluster
+     */
+    virtual Clusters processParallel(const std::vector<const geom::Geometry*> & components,
+                                     index::strtree::TemplateSTRtree<std::size_t> & index,
+                                     ConcurrentUnionFind & uf,
+                                     std::size_t numThreads);
+
+    /**
+     * Return the distance within which two Points are clustered together, if
+     * this finder's treatment of Points depends only on the distance between
+     * them, or a negative number otherwise. When it is non-negative and every
+     * input is a non-empty Point, `processPoints` is used instead of `process`.
+     */
+    virtual double pointClusterDistance() const {
+        return -1;
+    }
+
+    /**
+     * Cluster a set of points, using a grid instead of a spatial index to
+     * find neighbors. The default implementation joins every pair of points
+     * reported as neighbors by the grid. Clusters are ordered by their
+     * smallest element.
+     * @param grid a PointGrid indexing the points at `pointClusterDistance()`
+     * @param uf a ConcurrentUnionFind, to be used from `numThreads` threads
+     * @param numThreads the number of threads to use
+     * @return a vector of with the indices of all components that should be included in a cluster
+     */
+    virtual Clusters processPoints(const PointGrid & grid,
+                                   ConcurrentUnionFind & uf,
+                                   std::size_t numThreads);
+
+    /**
+     * Create a finder with the same parameters as this one, so that `queryEnvelope`
+     * and `shouldJoin` can be called from several threads, each using its own finder.
+     * Finders that return `nullptr` (the default) are processed serially.
+     */
+    virtual std::unique_ptr<AbstractClusterFinder> cloneFinder() const {
+        return nullptr;
+    }
+
 private:
+    std::size_t m_numThreads = 1;
+
     static std::vector<std::unique_ptr<geom::Geometry>> getComponents(std::unique_ptr<geom::Geometry>&& g);
 };
 
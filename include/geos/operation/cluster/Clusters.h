@@ -24,6 +24,7 @@ namespace operation {
 namespace cluster {
 
 class UnionFind;
+class ConcurrentUnionFind;
 
 class GEOS_DLL Clusters {
 private:
@@ -36,6 +37,8 @@ public:
 
     explicit Clusters(UnionFind & uf, std::vector<std::size_t> elemsInCluster, std::size_t numElems);
 
+    explicit Clusters(ConcurrentUnionFind & uf, std::vector<std::size_t> elemsInCluster, std::size_t numElems);
+
     // Get the number of clusters available
     std::size_t getNumClusters() const {
         return m_starts.size();
@@ -63,6 +66,10 @@ public:
         return begin(cluster + 1);
     }
 
+private:
+    template<typename UF>
+    void groupByCluster(UF & uf);
+
 };
 
 }
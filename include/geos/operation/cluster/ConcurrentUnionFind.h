@@ -0,0 +1,174 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_OPERATION_CLUSTER_CONCURRENTUNIONFIND
+#define GEOS_OPERATION_CLUSTER_CONCURRENTUNIONFIND
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include <geos/export.h>
+#include <geos/operation/cluster/Clusters.h>
+
+namespace geos {
+namespace operation {
+namespace cluster {
+
+/** ConcurrentUnionFind is a lock-free disjoint set structure whose `find`,
+ * `same` and `join` operations may be called from several threads at once.
+ *
+ * Sets are always linked so that the smaller index becomes the root. The
+ * root of every set is therefore its smallest element, regardless of the
+ * order in which the joins were performed, and the clusters returned by
+ * getClusters() are ordered by their smallest element.
+ */
+class GEOS_DLL ConcurrentUnionFind {
+
+public:
+    /** Create a ConcurrentUnionFind object
+     *
+     * @param n the number of elements to be clustered (fixed size)
+     */
+    explicit ConcurrentUnionFind(size_t n) :
+            parents(new std::atomic<size_t>[n]),
+            numElems(n) {
+        for (size_t i = 0; i < n; i++) {
+            parents[i].store(i, std::memory_order_relaxed);
+        }
+    }
+
+    // Are two elements in the same cluster?
+    bool same(size_t i, size_t j) {
+        if (i == j) {
+            return true;
+        }
+
+        // Roots may change while we look at them; two elements are known to
+        // be in the same cluster only once they share a root that is still a
+        // root after the comparison.
+        while (true) {
+            i = find(i);
+            j = find(j);
+            if (i == j) {
+                return true;
+            }
+            if (parents[i].load(std::memory_order_acquire) == i) {
+                return false;
+            }
+        }
+    }
+
+    // Are two elements in a different cluster?
+    bool different(size_t i, size_t j) {
+        return !same(i, j);
+    }
+
+    /**
+     * Return the ID of the cluster associated with an item, which is the
+     * smallest index of any item in the cluster once all joins are complete.
+     * @param i index of the item to lookup
+     * @return a numeric cluster ID
+     */
+    size_t find(size_t i) {
+        // Path halving: point each visited element at its grandparent.
+        // A failed exchange only means another thread already shortened
+        // the path.
+        while (true) {
+            size_t parent = parents[i].load(std::memory_order_acquire);
+            if (parent == i) {
+                return i;
+            }
+            size_t grandparent = parents[parent].load(std::memory_order_acquire);
+            if (grandparent != parent) {
+                parents[i].compare_exchange_weak(parent, grandparent, std::memory_order_acq_rel);
+            }
+            i = grandparent;
+        }
+    }
+
+    /**
+     * Merge the clusters associated with two items
+     * @param i ID of an item associated with the first cluster
+     * @param j ID of an item associated with the second cluster
+     */
+    void join(size_t i, size_t j) {
+        while (true) {
+            size_t a = find(i);
+            size_t b = find(j);
+
+            if (a == b) {
+                return;
+            }
+
+            if (a < b) {
+                std::swap(a, b);
+            }
+
+            // link the larger root below the smaller one, if it is still a root
+            size_t expected = a;
+            if (parents[a].compare_exchange_strong(expected, b, std::memory_order_acq_rel)) {
+                return;
+            }
+        }
+    }
+
+    /**
+     * Return the number of clusters. Must not be called while joins are in progress.
+     */
+    size_t getNumClusters() const {
+        size_t n = 0;
+        for (size_t i = 0; i < numElems; i++) {
+            if (parents[i].load(std::memory_order_relaxed) == i) {
+                n++;
+            }
+        }
+        return n;
+    }
+
+    template<typename T>
+    void sortByCluster(T begin, T end) {
+        std::sort(begin, end, [this](size_t a, size_t b) {
+            auto ra = find(a);
+            auto rb = find(b);
+            return ra < rb || (ra == rb && a < b);
+        });
+    }
+
+    /**
+     * Return the clusters associated with all elements.
+     * Must not be called while joins are in progress.
+     * @return an object that allows iteration over the elements of each cluster
+     */
+    Clusters getClusters();
+
+    /**
+     * Return the clusters associated with the given elements
+     * Must not be called while joins are in progress.
+     * @param elems a vector of element ids
+     * @return an object that allows iteration over the elements of each cluster
+     */
+    Clusters getClusters(std::vector<size_t> elems);
+
+private:
+    std::unique_ptr<std::atomic<size_t>[]> parents;
+    size_t numElems;
+};
+
+}
+}
+}
+
+#endif
@@ -42,6 +42,19 @@ protected:
              index::strtree::TemplateSTRtree<std::size_t> & index,
              UnionFind & uf) override;
 
+    Clusters processParallel(const std::vector<const geom::Geometry*> & components,
+                             index::strtree::TemplateSTRtree<std::size_t> & index,
+                             ConcurrentUnionFind & uf,
+                             std::size_t numThreads) override;
+
+    double pointClusterDistance() const override {
+        return m_eps;
+    }
+
+    Clusters processPoints(const PointGrid & grid,
+                           ConcurrentUnionFind & uf,
+                           std::size_t numThreads) override;
+
     bool shouldJoin(const geom::Geometry*, const geom::Geometry*) override {
         throw std::runtime_error("Never get here.");
     }
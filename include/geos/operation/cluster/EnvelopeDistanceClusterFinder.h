@@ -30,6 +30,10 @@ public:
     explicit EnvelopeDistanceClusterFinder(double d) : m_distance(d), m_distance_squared(d*d) {}
 
 protected:
+    std::unique_ptr<AbstractClusterFinder> cloneFinder() const override {
+        return detail::make_unique<EnvelopeDistanceClusterFinder>(m_distance);
+    }
+
     const geom::Envelope& queryEnvelope(const geom::Geometry* a) override {
         m_envelope = *a->getEnvelopeInternal();
         m_envelope.expandBy(m_distance);
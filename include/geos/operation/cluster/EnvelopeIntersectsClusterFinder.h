@@ -26,6 +26,10 @@ namespace cluster {
  */
 class GEOS_DLL EnvelopeIntersectsClusterFinder : public AbstractClusterFinder {
 protected:
+    std::unique_ptr<AbstractClusterFinder> cloneFinder() const override {
+        return detail::make_unique<EnvelopeIntersectsClusterFinder>();
+    }
+
 
     const geom::Envelope& queryEnvelope(const geom::Geometry* a) override {
         return *(a->getEnvelopeInternal());
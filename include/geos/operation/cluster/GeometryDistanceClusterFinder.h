@@ -32,6 +32,10 @@ public:
     explicit GeometryDistanceClusterFinder(double distance) : m_distance(distance) {}
 
 protected:
+    std::unique_ptr<AbstractClusterFinder> cloneFinder() const override {
+        return detail::make_unique<GeometryDistanceClusterFinder>(m_distance);
+    }
+
     bool shouldJoin(const geom::Geometry* a, const geom::Geometry *b) override {
         if (m_prep == nullptr || &(m_prep->getGeometry()) != a) {
             m_prep = geom::prep::PreparedGeometryFactory::prepare(a);
@@ -40,6 +44,10 @@ protected:
         return m_prep->isWithinDistance(b, m_distance);
     }
 
+    double pointClusterDistance() const override {
+        return m_distance;
+    }
+
     const geom::Envelope& queryEnvelope(const geom::Geometry* a) override {
         m_envelope = *a->getEnvelopeInternal();
         m_envelope.expandBy(m_distance);
@@ -29,6 +29,10 @@ namespace cluster {
  */
 class GEOS_DLL GeometryIntersectsClusterFinder : public AbstractClusterFinder {
 protected:
+    std::unique_ptr<AbstractClusterFinder> cloneFinder() const override {
+        return detail::make_unique<GeometryIntersectsClusterFinder>();
+    }
+
     const geom::Envelope& queryEnvelope(const geom::Geometry* a) override {
         return *(a->getEnvelopeInternal());
     }
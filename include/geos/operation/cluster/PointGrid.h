@@ -0,0 +1,143 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#ifndef GEOS_OPERATION_CLUSTER_POINTGRID
+#define GEOS_OPERATION_CLUSTER_POINTGRID
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <geos/export.h>
+#include <geos/geom/Coordinate.h>
+
+namespace geos {
+namespace operation {
+namespace cluster {
+
+/** PointGrid buckets a set of points into a uniform grid whose cells are as
+ * wide as a clustering distance, so that all points within that distance of a
+ * given point can be found by examining only the 3x3 block of cells around it.
+ *
+ * It is used in place of a spatial index when every input to a distance-based
+ * cluster finder is a Point.
+ */
+class GEOS_DLL PointGrid {
+
+public:
+    /**
+     * Determine whether a PointGrid can index the given points with the
+     * given distance. A grid is not used for a zero or non-finite distance,
+     * for non-finite coordinates, or when the extent of the points spans
+     * too many cells for the cell coordinates to be represented exactly.
+     */
+    static bool isApplicable(const std::vector<geom::CoordinateXY>& pts, double distance);
+
+    /**
+     * Index the given points.
+     * @param pts the points to index; the vector must outlive the grid
+     * @param distance the distance within which points are neighbors
+     */
+    PointGrid(const std::vector<geom::CoordinateXY>& pts, double distance);
+
+    std::size_t size() const {
+        return m_pts.size();
+    }
+
+    /**
+     * Call `visitor(j)` for every point `j` (including `i` itself) that is no
+     * farther than the grid distance from point `i`.
+     */
+    template<typename F>
+    void visitNeighbors(std::size_t i, F&& visitor) const {
+        const geom::CoordinateXY& p = m_pts[i];
+        auto cx = cellX(p.x);
+        auto cy = cellY(p.y);
+
+        for (std::int64_t x = cx - 1; x <= cx + 1; x++) {
+            for (std::int64_t y = cy - 1; y <= cy + 1; y++) {
+                auto it = m_cells.find(CellKey{x, y});
+                if (it == m_cells.end()) {
+                    continue;
+                }
+
+                for (std::size_t k = it->second.first; k < it->second.second; k++) {
+                    std::size_t j = m_order[k];
+                    if (isWithinDistance(p.distanceSquared(m_pts[j]))) {
+                        visitor(j);
+                    }
+                }
+            }
+        }
+    }
+
+private:
+    struct CellKey {
+        std::int64_t x;
+        std::int64_t y;
+
+        bool operator==(const CellKey& other) const {
+            return x == other.x && y == other.y;
+        }
+    };
+
+    struct CellKeyHash {
+        std::size_t operator()(const CellKey& k) const {
+            auto h = static_cast<std::uint64_t>(k.x) * 0x9E3779B97F4A7C15ull;
+            h ^= static_cast<std::uint64_t>(k.y) + 0x7F4A7C159E3779B9ull + (h << 6) + (h >> 2);
+            return static_cast<std::size_t>(h);
+        }
+    };
+
+    std::int64_t cellX(double x) const {
+        return static_cast<std::int64_t>(std::floor((x - m_originX) / m_cellSize));
+    }
+
+    std::int64_t cellY(double y) const {
+        return static_cast<std::int64_t>(std::floor((y - m_originY) / m_cellSize));
+    }
+
+    // Equivalent to sqrt(distSq) <= distance, as computed by Geometry::distance,
+    // without taking a square root unless distSq is within rounding error of
+    // the squared distance.
+    bool isWithinDistance(double distSq) const {
+        if (distSq < m_distSqLow) {
+            return true;
+        }
+        if (distSq > m_distSqHigh) {
+            return false;
+        }
+        return std::sqrt(distSq) <= m_distance;
+    }
+
+    const std::vector<geom::CoordinateXY>& m_pts;
+    double m_distance;
+    double m_distSqLow;
+    double m_distSqHigh;
+    double m_cellSize;
+    double m_originX;
+    double m_originY;
+
+    std::vector<std::size_t> m_order; // point indices, grouped by cell
+    std::unordered_map<CellKey, std::pair<std::size_t, std::size_t>, CellKeyHash> m_cells; // range of m_order in each cell
+};
+
+}
+}
+}
+
+#endif
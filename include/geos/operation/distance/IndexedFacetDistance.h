@@ -86,6 +86,16 @@ public:
     /// \return the computed distance
     double distance(const geom::Geometry* g) const;
 
+    /// \brief Computes the distance from the base geometry to the given point.
+    ///
+    /// This avoids creating a geometry and an index for the point,
+    /// which matters when computing the distance to many points.
+    ///
+    /// \param pt the point to compute the distance to
+    ///
+    /// \return the computed distance
+    double distance(const geom::CoordinateXY& pt) const;
+
     /// \brief Tests whether the base geometry lies within a specified distance of the given geometry.
     ///
     /// \param g the geometry to test
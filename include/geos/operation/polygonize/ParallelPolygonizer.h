@@ -0,0 +1,244 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/Coordinate.h>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+namespace algorithm {
+namespace locate {
+class IndexedPointInAreaLocator;
+}
+}
+namespace geom {
+class Geometry;
+class GeometryFactory;
+class LinearRing;
+class LineString;
+class Polygon;
+}
+}
+
+namespace geos {
+namespace operation { // geos::operation
+namespace polygonize { // geos::operation::polygonize
+
+/** \brief
+ * Polygonizes a set of Geometrys which contain linework that
+ * represents the edges of a planar graph, using a compact graph
+ * representation and multiple threads.
+ *
+ * The semantics are those of Polygonizer, and the polygons are the same
+ * and in the same order as those computed by Polygonizer.
+ *
+ * The edge graph is held in flat arrays indexed by half-edge, rather than
+ * as a graph of individually allocated objects.
+ * Edge \f$ e \f$ is represented by the half-edges \f$ 2e \f$
+ * (in the direction of the line) and \f$ 2e+1 \f$ (in the reverse direction).
+ * The coordinates of the input lines are not copied into the graph.
+ *
+ * Dangles, cut edges and edge rings are computed for each connected
+ * component of the graph independently, and the edge rings are then
+ * validated and assigned holes concurrently (see setNumThreads()).
+ * The result does not depend on the number of threads.
+ *
+ * Dangles and cut edges are reported in the order the lines were added,
+ * which may differ from the order reported by Polygonizer.
+ *
+ * The input geometries must be kept alive until the Polygonizer
+ * is no longer used, as the dangles and cut edges refer to them.
+ */
+class GEOS_DLL ParallelPolygonizer {
+
+public:
+
+    /** \brief
+     * Create a polygonizer with the same GeometryFactory
+     * as the input Geometry
+     *
+     * @param onlyPolygonal true if only polygons which form a valid
+     *                      polygonal geometry should be extracted
+     */
+    explicit ParallelPolygonizer(bool onlyPolygonal = false);
+
+    ~ParallelPolygonizer();
+
+    /** \brief
+     * Add a collection of geometries to be polygonized.
+     * May be called multiple times.
+     * Any dimension of Geometry may be added;
+     * the constituent linework will be extracted and used
+     *
+     * @param geomList a list of Geometry with linework to be polygonized
+     */
+    void add(const std::vector<const geom::Geometry*>& geomList);
+
+    /** \brief
+     * Add a geometry to the linework to be polygonized.
+     * May be called multiple times.
+     * Any dimension of Geometry may be added;
+     * the constituent linework will be extracted and used
+     *
+     * @param g a Geometry with linework to be polygonized
+     */
+    void add(const geom::Geometry* g);
+
+    /** \brief
+     * Sets the number of threads used to polygonize.
+     *
+     * @param numThreads the number of threads (0 to use all hardware threads)
+     */
+    void setNumThreads(std::size_t numThreads);
+
+    /** \brief
+     * Gets the list of polygons formed by the polygonization.
+     *
+     * Ownership of vector is transferred to caller, subsequent
+     * calls will return NULL.
+     * @return a collection of Polygons
+     */
+    std::vector<std::unique_ptr<geom::Polygon>> getPolygons();
+
+    /** \brief
+     * Get the list of dangling lines found during polygonization.
+     *
+     * @return a (possibly empty) collection of pointers to
+     *         the input LineStrings which are dangles.
+     */
+    const std::vector<const geom::LineString*>& getDangles();
+
+    /** \brief
+     * Get the list of cut edges found during polygonization.
+     *
+     * @return a (possibly empty) collection of pointers to
+     *         the input LineStrings which are cut edges.
+     */
+    const std::vector<const geom::LineString*>& getCutEdges();
+
+    /** \brief
+     * Get the list of lines forming invalid rings found during
+     * polygonization.
+     *
+     * @return a (possibly empty) collection of pointers to
+     *         the input LineStrings which are invalid rings
+     */
+    const std::vector<std::unique_ptr<geom::LineString>>& getInvalidRingLines();
+
+private:
+
+    struct Ring {
+        std::size_t start; // lowest index of the half-edges in the ring
+        std::unique_ptr<geom::LinearRing> ring;
+        std::unique_ptr<geom::LineString> invalidLine;
+        bool isHole = false;
+        std::size_t shell;
+        std::vector<std::size_t> holes;
+        bool isIncluded = false;
+        bool isIncludedSet = false;
+        bool isProcessed = false;
+        bool isVisited = false;
+
+        //-- built on demand when the ring is tested for containing a hole
+        std::unique_ptr<algorithm::locate::IndexedPointInAreaLocator> locator;
+        std::vector<geom::CoordinateXY> sortedPts;
+    };
+
+    void addLine(const geom::LineString* line);
+
+    void polygonize();
+
+    void buildGraph();
+
+    std::vector<std::size_t> processComponent(const std::vector<std::size_t>& nodes,
+                                              const std::vector<std::size_t>& halfEdges);
+
+    void deleteDangles(const std::vector<std::size_t>& nodes);
+
+    void deleteCutEdges(const std::vector<std::size_t>& nodes,
+                        const std::vector<std::size_t>& halfEdges);
+
+    void computeNextCWEdges(const std::vector<std::size_t>& nodes);
+
+    void computeNextCCWEdges(std::size_t node, std::size_t label);
+
+    void convertMaximalToMinimalEdgeRings(const std::vector<std::size_t>& ringStarts);
+
+    std::vector<std::size_t> findLabeledEdgeRings(const std::vector<std::size_t>& halfEdges);
+
+    std::size_t getDegree(std::size_t node, std::size_t label) const;
+
+    void buildRing(Ring& ring) const;
+
+    std::size_t findShellContaining(const Ring& hole,
+                                    const std::vector<std::size_t>& candidates);
+
+    void prepareShell(Ring& shell) const;
+
+    std::size_t getRingIndex(std::size_t halfEdge) const;
+
+    std::size_t getShell(std::size_t ringIndex) const;
+
+    std::size_t getOuterHole(std::size_t ringIndex) const;
+
+    void findDisjointShells(const std::vector<std::size_t>& shells);
+
+    void updateIncluded(std::size_t shellIndex);
+
+    bool extractOnlyPolygonal;
+    bool computed;
+    std::size_t numThreads;
+    const geom::GeometryFactory* factory;
+
+    //-- edge e has the half-edges 2e and 2e + 1
+    std::vector<const geom::LineString*> edgeLines;
+    std::vector<geom::CoordinateXY> edgeDirPts; // direction point of each half-edge
+    std::vector<geom::CoordinateXY> nodePts;
+
+    std::vector<std::size_t> halfEdgeNode; // origin node of each half-edge
+    std::vector<std::size_t> nodeStarStart; // offsets of the node stars
+    std::vector<std::size_t> nodeStar; // out half-edges of each node, in CCW order
+    std::vector<std::size_t> halfEdgeNext;
+    std::vector<std::size_t> halfEdgeLabel;
+    std::vector<std::size_t> nodeDegree;
+    std::vector<char> halfEdgeMarked;
+    std::vector<char> isDangle;
+    std::vector<char> isCutEdge;
+
+    std::vector<Ring> rings;
+
+    std::vector<const geom::LineString*> dangles;
+    std::vector<const geom::LineString*> cutEdges;
+    std::vector<std::unique_ptr<geom::LineString>> invalidRingLines;
+    std::vector<std::unique_ptr<geom::Polygon>> polyList;
+};
+
+} // namespace geos::operation::polygonize
+} // namespace geos::operation
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
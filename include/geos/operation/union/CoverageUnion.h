@@ -17,8 +17,11 @@
 #include <geos/geom/LineSegment.h>
 #include <geos/geom/Geometry.h>
 
+#include <cstdint>
+#include <map>
 #include <memory>
 #include <unordered_set>
+#include <vector>
 
 namespace geos {
     namespace geom {
@@ -37,6 +40,27 @@ namespace geounion {
     public:
         static std::unique_ptr<geom::Geometry> Union(const geom::Geometry* geom);
 
+        /**
+         * Unions the polygons of a coverage which have equal group keys.
+         *
+         * Only the segments shared by polygons of the same group are
+         * removed, so all groups are dissolved in a single pass over the
+         * coverage segments. Segment hashing and the polygonization of
+         * each group can be spread over several threads; the result does
+         * not depend on the number of threads.
+         *
+         * @param geoms the polygonal elements of the coverage
+         * @param keys the group key of each element
+         * @param numThreads the number of threads (0 to use all hardware threads)
+         * @return the union of each group, by group key
+         * @throws IllegalArgumentException if the number of keys and elements differ
+         * @throws TopologyException if the elements of a group do not form a valid coverage
+         */
+        static std::map<std::int64_t, std::unique_ptr<geom::Geometry>> Union(
+            const std::vector<const geom::Geometry*>& geoms,
+            const std::vector<std::int64_t>& keys,
+            std::size_t numThreads = 1);
+
     private:
         CoverageUnion() = default;
 
@@ -60,6 +60,22 @@ public:
         const CoordsVect& nPts,
         double distanceTolerance);
 
+    /** \brief
+     * Computes the tolerance at which each point is eliminated
+     * by Douglas-Peucker simplification.
+     *
+     * A point is retained by simplify() exactly when its elimination
+     * tolerance is greater than the distance tolerance, so a line can be
+     * simplified with many tolerances by filtering the points, without
+     * repeating the recursion.
+     * The endpoints have an infinite elimination tolerance.
+     *
+     * @param nPts the points of the line
+     * @return the elimination tolerance of each point
+     */
+    static std::vector<double> computeEliminationTolerances(
+        const CoordsVect& nPts);
+
     DouglasPeuckerLineSimplifier(const CoordsVect& nPts);
 
     /** \brief
@@ -20,6 +20,7 @@
 
 #include <geos/export.h>
 #include <memory> // for unique_ptr
+#include <vector>
 
 // Forward declarations
 namespace geos {
@@ -54,6 +55,23 @@ public:
         const geom::Geometry* geom,
         double tolerance);
 
+    /** \brief
+     * Simplifies a geometry with several distance tolerances,
+     * e.g. to build the levels of detail of a tile pyramid.
+     *
+     * The Douglas-Peucker recursion is computed once per line,
+     * recording the tolerance at which each vertex is eliminated.
+     * Each result is then produced by filtering the vertices,
+     * and is identical to the result of simplify(geom, tolerance).
+     *
+     * @param geom the geometry to simplify
+     * @param tolerances the distance tolerances to use
+     * @return the simplified geometry for each tolerance, in the same order
+     */
+    static std::vector<std::unique_ptr<geom::Geometry>> simplify(
+        const geom::Geometry* geom,
+        const std::vector<double>& tolerances);
+
     DouglasPeuckerSimplifier(const geom::Geometry* geom);
 
     /** \brief
@@ -18,6 +18,9 @@
 #include <geos/util/IllegalArgumentException.h>
 #include <geos/simplify/RingHull.h>
 
+#include <memory>
+#include <vector>
+
 
 namespace geos {
 namespace geom {
@@ -145,6 +148,43 @@ public:
         double areaDeltaRatio);
 
 
+    /**
+    * Computes hulls of a polygonal geometry for several vertex number
+    * fractions, e.g. to build the levels of detail of a tile pyramid.
+    *
+    * The corner removal sequence of each ring is computed once,
+    * and each hull is extracted from it.
+    * Where rings are not constrained by other rings
+    * (e.g. outer hulls of single polygons) the hulls are identical
+    * to those computed by hull(const Geometry*, bool, double).
+    * Otherwise each ring is checked against all input vertices
+    * of the other rings, which keeps every combination of levels
+    * valid but may retain slightly more vertices.
+    *
+    * @param geom the polygonal geometry to process
+    * @param isOuter indicates whether to compute outer or inner hulls
+    * @param vertexNumFractions the target fractions of number of input vertices
+    * @return the hull geometry for each fraction, in the same order
+    */
+    static std::vector<std::unique_ptr<Geometry>> hull(
+        const Geometry* geom,
+        bool isOuter,
+        const std::vector<double>& vertexNumFractions);
+
+    /**
+    * Computes hulls of a polygonal geometry for several area delta ratios,
+    * in the same way as hull(const Geometry*, bool, const std::vector<double>&).
+    *
+    * @param geom the polygonal geometry to process
+    * @param isOuter indicates whether to compute outer or inner hulls
+    * @param areaDeltaRatios the target ratios of area difference to original area
+    * @return the hull geometry for each ratio, in the same order
+    */
+    static std::vector<std::unique_ptr<Geometry>> hullByAreaDelta(
+        const Geometry* geom,
+        bool isOuter,
+        const std::vector<double>& areaDeltaRatios);
+
     /**
     * Sets the target fraction of input vertices
     * which are retained in the result.
@@ -212,6 +252,10 @@ private:
         double areaTotal,
         RingHullIndex& hullIndex);
 
+    std::vector<std::unique_ptr<Geometry>> computeLevels(
+        const std::vector<double>& targets,
+        bool isAreaDelta);
+
     std::unique_ptr<Polygon> polygonHull(
         const Polygon* poly,
         std::vector<RingHull*>& ringHulls,
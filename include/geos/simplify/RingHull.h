@@ -72,6 +72,28 @@ public:
 
     void compute(RingHullIndex& hullIndex);
 
+    /*
+    * Removes all removable corners, as if no target were set,
+    * recording the order of removal so that the hull for any
+    * target can be extracted by getHullForVertexNum()
+    * or getHullForAreaDelta().
+    *
+    * @param hullIndex the other rings to check for intersections
+    */
+    void computeRemovals(RingHullIndex& hullIndex);
+
+    /*
+    * Gets the hull which compute() produces for a minimum vertex number.
+    * Requires computeRemovals() to have been called.
+    */
+    std::unique_ptr<LinearRing> getHullForVertexNum(std::size_t minVertexNum) const;
+
+    /*
+    * Gets the hull which compute() produces for a maximum area delta.
+    * Requires computeRemovals() to have been called.
+    */
+    std::unique_ptr<LinearRing> getHullForAreaDelta(double maxAreaDelta) const;
+
     std::unique_ptr<Polygon> toGeometry() const;
 
 
@@ -153,6 +175,17 @@ private:
 
     std::priority_queue<Corner> cornerQueue;
 
+    /**
+    * When recording, the vertices removed in order, and for each
+    * removal the largest area delta tested by isAtTarget() up to
+    * that removal.
+    */
+    bool isRecording = false;
+    std::vector<std::size_t> removedVertex;
+    std::vector<double> removalAreaDelta;
+
+    std::unique_ptr<LinearRing> buildHull(std::size_t numRemoved) const;
+
 
     void init(std::vector<Coordinate>& ring, bool isOuter);
     void addCorner(std::size_t i, std::priority_queue<Corner>& cornerQueue);
@@ -27,6 +27,7 @@
 #include <cstddef>
 #include <vector>
 #include <memory>
+#include <unordered_set>
 
 #ifdef _MSC_VER
 #pragma warning(push)
@@ -66,6 +67,8 @@ public:
     TaggedLineStringSimplifier(LineSegmentIndex* inputIndex,
                                LineSegmentIndex* outputIndex);
 
+    ~TaggedLineStringSimplifier();
+
     /** \brief
      * Sets the distance tolerance for the simplification.
      *
@@ -84,6 +87,23 @@ public:
      */
     void simplify(TaggedLineString* line);
 
+    /**
+     * Sets whether updates to the shared segment indexes are deferred.
+     *
+     * When deferred, segments removed from the input index and
+     * segments added to the output index are only visible to this
+     * simplifier, so that the shared indexes are only read while
+     * simplifying. The updates are applied by applyIndexUpdates().
+     *
+     * @param isDeferred true if index updates are to be deferred
+     */
+    void setDeferIndexUpdates(bool isDeferred);
+
+    /**
+     * Applies deferred index updates to the shared indexes.
+     */
+    void applyIndexUpdates();
+
 
 private:
 
@@ -102,6 +122,18 @@ private:
 
     double distanceTolerance;
 
+    bool deferIndexUpdates;
+
+    /// Input segments removed while index updates are deferred
+    std::unordered_set<const geom::LineSegment*> removedSegs;
+
+    std::vector<const geom::LineSegment*> removedSegList;
+
+    /// Output segments added while index updates are deferred
+    std::unique_ptr<LineSegmentIndex> addedIndex;
+
+    std::vector<const geom::LineSegment*> addedSegList;
+
     void simplifySection(std::size_t i, std::size_t j,
                          std::size_t depth);
 
@@ -158,6 +190,12 @@ TaggedLineStringSimplifier::setDistanceTolerance(double d)
     distanceTolerance = d;
 }
 
+inline void
+TaggedLineStringSimplifier::setDeferIndexUpdates(bool isDeferred)
+{
+    deferIndexUpdates = isDeferred;
+}
+
 } // namespace geos::simplify
 } // namespace geos
 
@@ -68,6 +68,19 @@ public:
      */
     void setDistanceTolerance(double tolerance);
 
+    /** \brief
+     * Sets the number of threads used to simplify the lines.
+     *
+     * Lines are simplified in waves of lines with disjoint envelopes,
+     * which cannot affect each other's simplification. Each wave is
+     * simplified concurrently, and the index updates are applied in line
+     * order between waves, so the result is the same as for serial
+     * simplification.
+     *
+     * @param numThreads the number of threads (0 to use all hardware threads)
+     */
+    void setNumThreads(std::size_t numThreads);
+
     /** \brief
      * Simplify a set of {@link TaggedLineString}s
      *
@@ -83,6 +96,16 @@ public:
         iterator_type begin,
         iterator_type end)
     {
+        if(numThreads != 1) {
+            std::vector<TaggedLineString*> lines;
+            for(iterator_type it = begin; it != end; ++it) {
+                assert(*it);
+                lines.push_back(*it);
+            }
+            simplifyParallel(lines);
+            return;
+        }
+
         // add lines to the index
         for(iterator_type it = begin; it != end; ++it) {
             assert(*it);
@@ -101,11 +124,19 @@ private:
 
     void simplify(TaggedLineString& line);
 
+    void simplifyParallel(const std::vector<TaggedLineString*>& lines);
+
+    static std::vector<std::size_t> computeWaves(const std::vector<TaggedLineString*>& lines);
+
     std::unique_ptr<LineSegmentIndex> inputIndex;
 
     std::unique_ptr<LineSegmentIndex> outputIndex;
 
     std::unique_ptr<TaggedLineStringSimplifier> taggedlineSimplifier;
+
+    double distanceTolerance;
+
+    std::size_t numThreads;
 };
 
 } // namespace geos::simplify
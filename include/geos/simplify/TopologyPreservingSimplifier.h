@@ -75,6 +75,15 @@ public:
      */
     void setDistanceTolerance(double tolerance);
 
+    /** \brief
+     * Sets the number of threads used to simplify the component lines.
+     *
+     * The result is identical to the single-threaded result.
+     *
+     * @param numThreads the number of threads (0 to use all hardware threads)
+     */
+    void setNumThreads(std::size_t numThreads);
+
     std::unique_ptr<geom::Geometry> getResultGeometry();
 
 private:
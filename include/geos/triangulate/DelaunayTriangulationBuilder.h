@@ -78,9 +78,22 @@ public:
      */
     static std::unique_ptr<geom::CoordinateSequence> unique(const geom::CoordinateSequence* seq);
 
+    /**
+     * Sorts vertices into an insertion order with good spatial locality.
+     *
+     * The vertices are split into rounds of geometrically increasing size
+     * (a Biased Randomized Insertion Order), and each round is sorted
+     * along a Hilbert curve.
+     * The order is deterministic.
+     *
+     * @param vertices the vertices to sort
+     */
+    static void spatialSort(IncrementalDelaunayTriangulator::VertexList& vertices);
+
 private:
     std::unique_ptr<geom::CoordinateSequence> siteCoords;
     double tolerance;
+    bool isSpatialSort;
     std::unique_ptr<quadedge::QuadEdgeSubdivision> subdiv;
 
 public:
@@ -121,6 +134,24 @@ public:
         this->tolerance = p_tolerance;
     }
 
+    /**
+     * Sets whether sites are inserted in spatial order (see spatialSort()),
+     * with each site located by walking from the previous one.
+     * This is much faster for large numbers of sites.
+     * For sites in general position the triangulation is the same as with
+     * the default insertion order, although the triangles may be output in
+     * a different order. Where four or more sites are cocircular (as on a
+     * regular grid) the Delaunay triangulation is not unique, and which
+     * of the valid triangulations is built depends on the insertion order.
+     *
+     * @param p_isSpatialSort true to insert sites in spatial order
+     */
+    inline void
+    setSpatialSort(bool p_isSpatialSort)
+    {
+        this->isSpatialSort = p_isSpatialSort;
+    }
+
 private:
     void create();
 
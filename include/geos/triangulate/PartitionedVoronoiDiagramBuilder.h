@@ -0,0 +1,154 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/index/strtree/TemplateSTRtree.h>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace geos {
+namespace geom {
+class Geometry;
+class GeometryCollection;
+class GeometryFactory;
+}
+namespace triangulate { //geos.triangulate
+
+/** \brief
+ * A builder for the Voronoi diagram of a large set of sites, which splits
+ * the sites into tiles and computes the cells of each tile independently.
+ *
+ * Each tile is triangulated together with a halo of the sites around it.
+ * A cell computed this way can only be larger than the true cell, and it
+ * is exact if no site outside the halo is nearer to any cell vertex than
+ * the cell site. If any cell fails this test the tile is recomputed with
+ * a larger halo.
+ * Cells are clipped to the same envelope as VoronoiDiagramBuilder uses,
+ * so the cells are the same as those computed by VoronoiDiagramBuilder.
+ *
+ * Tiles are computed concurrently (see setNumThreads()).
+ * The cells are output in tile order, and by site order within each tile,
+ * independently of the number of threads.
+ * They can be consumed as they are computed, without building a
+ * collection of the whole diagram.
+ */
+class GEOS_DLL PartitionedVoronoiDiagramBuilder {
+public:
+    /** \brief
+     * Creates a new Voronoi diagram builder.
+     */
+    PartitionedVoronoiDiagramBuilder();
+
+    /** \brief
+     * Sets the sources to be diagrammed.
+     * All vertices of the given geometry will be used as sites.
+     *
+     * @param geom the geometry from which the sites will be extracted.
+     */
+    void setSites(const geom::Geometry& geom);
+
+    /** \brief
+     * Sets the sources to be diagrammed.
+     *
+     * @param coords the coordinates of the sites.
+     */
+    void setSites(const geom::CoordinateSequence& coords);
+
+    /** \brief
+     * Sets the envelope to clip the diagram to.
+     *
+     * @param clipEnv the clip envelope; must be kept alive by caller
+     *                until done with this object;
+     *                set to 0 for no clipping.
+     */
+    void setClipEnvelope(const geom::Envelope* clipEnv);
+
+    /** \brief
+     * Sets the snapping tolerance which will be used
+     * to improved the robustness of the triangulation computation.
+     *
+     * @param tolerance the tolerance distance to use
+     */
+    void setTolerance(double tolerance);
+
+    /** \brief
+     * Sets the number of threads used to compute tiles.
+     *
+     * @param numThreads the number of threads (0 to use all hardware threads)
+     */
+    void setNumThreads(std::size_t numThreads);
+
+    /** \brief
+     * Sets the maximum number of sites in a tile.
+     *
+     * Smaller tiles use less memory, at the cost of triangulating
+     * more halo sites.
+     *
+     * @param maxTileSize the maximum number of sites in a tile
+     */
+    void setMaxTileSize(std::size_t maxTileSize);
+
+    /** \brief
+     * Gets the faces of the computed diagram as a GeometryCollection
+     * of Polygons, clipped as specified.
+     *
+     * @param geomFact the geometry factory to use to create the output
+     * @return the faces of the diagram
+     */
+    std::unique_ptr<geom::GeometryCollection> getDiagram(const geom::GeometryFactory& geomFact);
+
+    /** \brief
+     * Computes the faces of the diagram, passing each to a visitor as
+     * soon as its tile is complete.
+     *
+     * The visitor is called on the calling thread, in the order of the
+     * faces in getDiagram(). Only a few tiles are held in memory at once.
+     *
+     * @param geomFact the geometry factory to use to create the output
+     * @param visitor the function to receive each face
+     */
+    void getDiagram(const geom::GeometryFactory& geomFact,
+                    const std::function<void(std::unique_ptr<geom::Geometry>)>& visitor);
+
+private:
+    struct Tile {
+        std::vector<std::size_t> siteIndexes;
+        geom::Envelope env;
+    };
+
+    std::unique_ptr<geom::CoordinateSequence> siteCoords;
+    double tolerance;
+    const geom::Envelope* clipEnv; // externally owned
+    std::size_t numThreads;
+    std::size_t maxTileSize;
+
+    std::vector<Tile> createTiles(const std::vector<geom::Coordinate>& sites) const;
+
+    std::vector<std::unique_ptr<geom::Geometry>> computeTile(
+        const Tile& tile,
+        const std::vector<geom::Coordinate>& sites,
+        index::strtree::TemplateSTRtree<std::size_t>& siteIndex,
+        const geom::Envelope& diagramEnv,
+        const geom::GeometryFactory& geomFact) const;
+};
+
+} //namespace geos.triangulate
+} //namespace geos
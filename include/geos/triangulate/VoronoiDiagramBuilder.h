@@ -90,6 +90,23 @@ public:
      */
     void setTolerance(double tolerance);
 
+    /** \brief
+     * Sets whether sites are inserted in spatial order, which is much
+     * faster for large numbers of sites.
+     *
+     * For sites in general position the diagram is the same as with the
+     * default insertion order, although the cells may be output in a
+     * different order. Where four or more sites are cocircular the
+     * underlying triangulation depends on the insertion order, so the
+     * cell vertices are computed from different triangles and may differ
+     * by round-off.
+     *
+     * @param isSpatialSort true to insert sites in spatial order
+     *
+     * @see DelaunayTriangulationBuilder::setSpatialSort
+     */
+    void setSpatialSort(bool isSpatialSort);
+
     /** \brief
      * Gets the quadedge::QuadEdgeSubdivision which models the computed diagram.
      *
@@ -119,6 +136,7 @@ private:
 
     std::unique_ptr<geom::CoordinateSequence> siteCoords;
     double tolerance;
+    bool isSpatialSort;
     std::unique_ptr<quadedge::QuadEdgeSubdivision> subdiv;
     const geom::Envelope* clipEnv; // externally owned
     geom::Envelope diagramEnv;
@@ -80,6 +80,7 @@ private:
     */
     std::vector<Coordinate> vertex;
     std::vector<std::size_t> vertexNext;
+    std::vector<std::size_t> vertexPrev;
     std::size_t vertexSize;
 
     // first available vertex index
@@ -89,20 +90,47 @@ private:
     std::array<std::size_t, 3> cornerIndex;
 
     /**
-    * Indexing vertices improves ear intersection testing performance a lot.
-    * The polyShell vertices are contiguous, so are suitable for an SPRtree.
+    * Links each vertex to the next vertex with the same coordinate,
+    * forming a cycle (a vertex which is not repeated links to itself).
+    * Repeated vertices are created by hole joining.
     */
-    VertexSequencePackedRtree vertexCoordIndex;
+    std::vector<std::size_t> vertexRepeat;
+
+    /**
+    * Only non-convex or repeated vertices can invalidate an ear,
+    * since an ear of a simple ring which contains a vertex
+    * also contains a reflex vertex.
+    * These candidate vertices are indexed, which improves ear
+    * intersection testing performance a lot.
+    * They are a subsequence of the polyShell vertices, so are still
+    * spatially coherent and suitable for an SPRtree.
+    * A convex vertex never becomes reflex as ears are removed,
+    * so candidates are dropped from the index when they become convex.
+    */
+    std::vector<Coordinate> candidateCoord;
+    std::vector<std::size_t> candidateVertex;
+    std::vector<std::size_t> vertexCandidate;
+    std::unique_ptr<VertexSequencePackedRtree> candidateIndex;
 
     // Methods
 
     std::vector<std::size_t> createNextLinks(std::size_t size) const;
 
+    std::vector<std::size_t> createPrevLinks(std::size_t size) const;
+
+    std::vector<std::size_t> createRepeatLinks() const;
+
+    void initCandidates();
+
+    bool isRepeated(std::size_t vertexIndex) const;
+
+    bool isConvex(std::size_t vertexIndex) const;
+
     bool isValidEar(std::size_t cornerIndex, const std::array<Coordinate, 3>& corner);
 
     /**
     * Finds another vertex intersecting the corner triangle, if any.
-    * Uses the vertex spatial index for efficiency.
+    * Uses the candidate vertex spatial index for efficiency.
     *
     * Also finds any vertex which is a duplicate of the corner apex vertex,
     * which then requires a full scan of the vertices to confirm ear is valid.
@@ -115,8 +143,8 @@ private:
     std::size_t findIntersectingVertex(std::size_t cornerIndex, const std::array<Coordinate, 3>& corner) const;
 
     /**
-    * Scan all vertices in current ring to check if any are duplicates
-    * of the corner apex vertex, and if so whether the corner ear
+    * Scan the vertices in current ring which are duplicates
+    * of the corner apex vertex, to check whether the corner ear
     * intersects the adjacent segments and thus is invalid.
     *
     * @param cornerIndex the index of the corner apex
@@ -125,14 +153,13 @@ private:
     */
     bool isValidEarScan(std::size_t cornerIndex, const std::array<Coordinate, 3>& corner) const;
 
-    /* private  */
-    static Envelope envelope(const std::array<Coordinate, 3>& corner);
-
     /**
     * Remove the corner apex vertex and update the candidate corner location.
     */
     void removeCorner();
 
+    void removeCandidate(std::size_t vertexIndex);
+
     bool isRemoved(std::size_t vertexIndex) const;
 
     void initCornerIndex();
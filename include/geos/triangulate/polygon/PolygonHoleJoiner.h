@@ -15,8 +15,13 @@
 #pragma once
 
 #include <geos/geom/Coordinate.h>
-#include <geos/noding/SegmentSetMutualIntersector.h>
+#include <geos/geom/LineSegment.h>
+#include <geos/index/strtree/TemplateSTRtree.h>
 
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <set>
 #include <unordered_map>
 #include <vector>
 
@@ -27,9 +32,7 @@ class Envelope;
 class Geometry;
 class CoordinateSequence;
 class LinearRing;
-}
-namespace noding {
-class SegmentString;
+class Polygon;
 }
 }
 
@@ -64,7 +67,23 @@ private:
 
     static constexpr double EPS = 1.0E-4;
 
+    static constexpr std::size_t NO_NODE = std::numeric_limits<std::size_t>::max();
+
+    /**
+    * The joined ring is held as a linked list of vertex nodes,
+    * so that holes can be inserted in constant time.
+    * Each node carries an order label which increases along the ring,
+    * so that the ring order of nodes can be compared
+    * without traversing the ring.
+    */
     std::vector<Coordinate> shellCoords;
+    std::vector<std::size_t> shellNext;
+    std::vector<std::size_t> shellPrev;
+    std::vector<std::uint64_t> shellOrder;
+    std::size_t shellFirst;
+
+    // the shell nodes, sorted by coordinate
+    std::multimap<Coordinate, std::size_t> shellCoordNodes;
 
     // orderedCoords is a copy of shellCoords for sort purposes
     std::set<Coordinate> shellCoordsSorted;
@@ -72,16 +91,34 @@ private:
     // Key: starting end of the cut; Value: list of the other end of the cut
     std::unordered_map<Coordinate, std::vector<Coordinate>, Coordinate::HashCode> cutMap;
 
-    std::unique_ptr<noding::SegmentSetMutualIntersector> polygonIntersector;
+    // the segments of the input polygon
+    index::strtree::TemplateSTRtree<geom::LineSegment> polygonSegmentIndex;
+    geom::LineSegment lastCrossing;
+    bool isLastCrossingValid;
     const Polygon* inputPolygon;
 
-    // The segstrings allocated in createPolygonIntersector need a
-    // place to hold ownership through the lifecycle of the hole joiner
-    std::vector<std::unique_ptr<noding::SegmentString>> polySegStringStore;
-
     // Methods
 
-    static std::vector<Coordinate> ringCoordinates(const LinearRing* ring);
+    void initShell(const LinearRing* ring);
+
+    std::vector<Coordinate> shellCoordinates() const;
+
+    /**
+    * Inserts a section of vertices into the shell before a node.
+    *
+    * @param node the node to insert before
+    * @param section the vertices to insert
+    */
+    void insertShellSection(std::size_t node, const std::vector<Coordinate>& section);
+
+    /**
+    * Assigns order labels to a run of shell nodes.
+    *
+    * @param first the first node of the run
+    * @param last the last node of the run
+    * @param numNodes the number of nodes in the run
+    */
+    void labelShellNodes(std::size_t first, std::size_t last, std::size_t numNodes);
 
     void joinHoles();
 
@@ -93,17 +130,17 @@ private:
     void joinHole(const LinearRing* hole);
 
     /**
-    * Get the ith shellvertex in shellCoords[] that the current should add after
+    * Get the shell node that the current hole should be added before
     *
     * @param shellVertex Coordinate of the shell vertex
     * @param holeVertex  Coordinate of the hole vertex
-    * @return the ith shellvertex
+    * @return the shell node
     */
     std::size_t getShellCoordIndex(const Coordinate& shellVertex, const Coordinate& holeVertex);
 
     /**
-    * Find the index of the coordinate in ShellCoords ArrayList,
-    * skipping over some number of matches
+    * Find the node of the coordinate in the shell,
+    * skipping over some number of matches in ring order
     *
     * @param coord
     * @return
@@ -128,7 +165,7 @@ private:
     * @param shellCoord a shell coordinate
     * @return true if the line lies inside the polygon
     */
-    bool isJoinable(const Coordinate& holeCoord, const Coordinate& shellCoord) const;
+    bool isJoinable(const Coordinate& holeCoord, const Coordinate& shellCoord);
 
     /**
     * Tests whether a line segment crosses the polygon boundary.
@@ -137,13 +174,13 @@ private:
     * @param p1 a vertex
     * @return true if the line segment crosses the polygon boundary
     */
-    bool crossesPolygon(const Coordinate& p0, const Coordinate& p1) const;
+    bool crossesPolygon(const Coordinate& p0, const Coordinate& p1);
 
     /**
     * Add hole at proper position in shell coordinate list.
     * Also adds hole points to ordered coordinates.
     *
-    * @param shellVertexIndex
+    * @param shellVertexIndex the node to add the hole before
     * @param holeCoords
     * @param holeVertexIndex
     */
@@ -165,7 +202,7 @@ private:
     */
     static std::vector<std::size_t> findLeftVertices(const LinearRing* ring);
 
-    std::unique_ptr<noding::SegmentSetMutualIntersector> createPolygonIntersector(const Polygon* polygon);
+    void indexPolygonSegments(const Polygon* polygon);
 
 
 public:
@@ -226,6 +226,22 @@ public:
     QuadEdge* locateFromEdge(const Vertex& v,
                              const QuadEdge& startEdge) const;
 
+    /** \brief
+     * Walks from an edge towards a location specified by a Vertex `v`,
+     * returning an edge which either contains v or is an edge of a
+     * triangle containing v.
+     *
+     * Unlike locateFromEdge(), the walk starts at `startEdge`, so locating
+     * a vertex near the start edge takes few steps.
+     *
+     * @param v the location to search for
+     * @param startEdge an edge of the subdivision to start walking from
+     * @return the located edge, or `nullptr` if the walk did not converge
+     *
+     * @note The returned pointer **should not** be freed be the caller.
+     */
+    QuadEdge* walkFromEdge(const Vertex& v, QuadEdge& startEdge) const;
+
     /** \brief
      * Finds a quadedge of a triangle containing a location
      * specified by a [Vertex](@ref triangulate::quadedge::Vertex), if one exists.
@@ -486,6 +502,13 @@ public:
      */
     std::unique_ptr<QuadEdgeSubdivision::QuadEdgeList> getVertexUniqueEdges(bool includeFrame);
 
+    /** \brief
+     * Computes the circumcentre of each triangle of the subdivision.
+     * These are the vertices of the cells returned by
+     * getVoronoiCellPolygon() and getVoronoiCellEdge().
+     */
+    void computeVoronoiVertices();
+
     /** \brief
      * Gets the Voronoi cell around a site specified by the origin of a QuadEdge.
      *
@@ -0,0 +1,55 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/triangulate/quadedge/QuadEdge.h>
+#include <geos/triangulate/quadedge/QuadEdgeLocator.h>
+
+namespace geos {
+namespace triangulate { //geos.triangulate
+namespace quadedge { //geos.triangulate.quadedge
+
+//fwd declarations
+class QuadEdgeSubdivision;
+
+/** \brief
+ * Locates {@link QuadEdge}s in a {@link QuadEdgeSubdivision} by walking
+ * from the last edge found.
+ *
+ * When vertices are located in a spatially coherent order (such as
+ * Hilbert order) each walk takes a small, roughly constant number of steps.
+ * If a walk does not converge (which can happen with nearly coincident
+ * vertices) the vertex is located by walking from the frame of the
+ * subdivision instead.
+ */
+class GEOS_DLL WalkingQuadEdgeLocator : public QuadEdgeLocator {
+private:
+    QuadEdgeSubdivision* subdiv;
+    QuadEdge* lastEdge;
+
+public:
+    WalkingQuadEdgeLocator(QuadEdgeSubdivision* subdiv);
+
+    /**
+     * Locates an edge e, such that either v is on e, or e is an edge of a triangle containing v.
+     * @return The caller _does not_ take ownership of the returned object.
+     */
+    QuadEdge* locate(const Vertex& v) override;
+};
+
+} //namespace geos.triangulate.quadedge
+} //namespace geos.triangulate
+} //namespace geos
@@ -0,0 +1,125 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace geos {
+namespace util {
+
+/// Number of threads used when a caller asks for a thread count of zero.
+inline std::size_t
+hardwareThreadCount()
+{
+    auto n = std::thread::hardware_concurrency();
+    return n == 0 ? 1 : static_cast<std::size_t>(n);
+}
+
+/**
+ * \brief Invokes `func(i)` for every `i` in `[0, n)`, spreading the calls
+ * over up to `numThreads` threads.
+ *
+ * Indices are handed out dynamically in blocks of `grainSize`, so that
+ * tasks of uneven cost are balanced between threads. The calling thread
+ * takes part in the work. A `numThreads` of 0 means hardwareThreadCount();
+ * a `numThreads` of 1 runs every call on the calling thread, in order.
+ *
+ * If an invocation throws, the remaining indices are abandoned and the
+ * first exception is rethrown on the calling thread once all workers have
+ * finished. If a thread cannot be started, the work is shared by the
+ * threads already running and the calling thread.
+ *
+ * `func` is called concurrently and must only touch shared state that is
+ * either read-only or synchronized. Writing to a distinct slot of a
+ * pre-sized vector per index is the usual pattern.
+ */
+template<typename F>
+void
+parallelFor(std::size_t n, std::size_t numThreads, F&& func, std::size_t grainSize = 1)
+{
+    if (numThreads == 0) {
+        numThreads = hardwareThreadCount();
+    }
+    grainSize = std::max<std::size_t>(grainSize, 1);
+
+    std::size_t numBlocks = (n + grainSize - 1) / grainSize;
+    numThreads = std::min(numThreads, numBlocks);
+
+    if (numThreads <= 1) {
+        for (std::size_t i = 0; i < n; i++) {
+            func(i);
+        }
+        return;
+    }
+
+    std::atomic<std::size_t> next(0);
+    std::atomic<bool> failed(false);
+    std::exception_ptr error;
+    std::mutex errorLock;
+
+    auto worker = [&]() {
+        while (!failed.load(std::memory_order_relaxed)) {
+            std::size_t begin = next.fetch_add(grainSize);
+            if (begin >= n) {
+                return;
+            }
+            std::size_t end = std::min(begin + grainSize, n);
+            try {
+                for (std::size_t i = begin; i < end; i++) {
+                    func(i);
+                }
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(errorLock);
+                if (!error) {
+                    error = std::current_exception();
+                }
+                failed = true;
+                return;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads - 1);
+    for (std::size_t t = 1; t < numThreads; t++) {
+        try {
+            threads.emplace_back(worker);
+        }
+        catch (...) {
+            // The started workers must be joined before the vector is
+            // destroyed; the calling thread picks up their share instead.
+            break;
+        }
+    }
+    worker();
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+}
+}
+
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <geos/export.h>
+
 #include <string>
 
 namespace geos {
@@ -25,5 +27,22 @@ bool endsWith(const std::string & s, char suffix);
 bool startsWith(const std::string & s, const std::string & prefix);
 bool startsWith(const std::string & s, char prefix);
 
+/**
+ * \brief
+ * Parses a floating-point number from the characters in [first, last).
+ *
+ * The number is read as by strtod in the "C" locale, but without
+ * allocation and independently of the current locale.
+ * Decimal numbers are correctly rounded using the Clinger fast path or the
+ * Eisel-Lemire algorithm; other forms accepted by strtod
+ * (such as inf, nan or hexadecimal) are handed over to strtod.
+ *
+ * @param first pointer to the first character
+ * @param last pointer past the last character
+ * @param result set to the number parsed, if any
+ * @return true if the whole range is a number, false otherwise
+ */
+GEOS_DLL bool parseDouble(const char* first, const char* last, double& result);
+
 }
 }
\ No newline at end of file
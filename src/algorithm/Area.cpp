@@ -38,6 +38,13 @@ Area::ofRing(const geom::CoordinateSequence* ring)
     return std::abs(ofRingSigned(ring));
 }
 
+/* public static */
+double
+Area::ofRing(const geom::FlatCoordinateSequence& ring)
+{
+    return std::abs(ofRingSigned(ring));
+}
+
 /* public static */
 double
 Area::ofRingSigned(const std::vector<geom::Coordinate>& ring)
@@ -91,6 +98,40 @@ Area::ofRingSigned(const geom::CoordinateSequence* ring)
     return sum / 2.0;
 }
 
+namespace {
+
+/// Signed ring area of a FlatCoordinateView of any layout
+struct SignedRingArea {
+    template<typename View>
+    double operator()(const View& view) const
+    {
+        std::size_t n = view.size();
+        if(n < 3) {
+            return 0.0;
+        }
+        /*
+         * Based on the Shoelace formula.
+         * http://en.wikipedia.org/wiki/Shoelace_formula
+         */
+        double x0 = view.getX(0);
+        double sum = 0.0;
+        for(std::size_t i = 1; i < n - 1; i++) {
+            double x = view.getX(i) - x0;
+            sum += x * (view.getY(i - 1) - view.getY(i + 1));
+        }
+        return sum / 2.0;
+    }
+};
+
+}
+
+/* public static */
+double
+Area::ofRingSigned(const geom::FlatCoordinateSequence& ring)
+{
+    return ring.visit(SignedRingArea());
+}
+
 
 
 } // namespace geos.algorithm
@@ -55,6 +55,32 @@ Length::ofLine(const geom::CoordinateSequence* pts)
     return len;
 }
 
+namespace {
+
+/// Length of a FlatCoordinateView of any layout
+struct LineLength {
+    template<typename View>
+    double operator()(const View& view) const
+    {
+        double len = 0.0;
+        view.forEachSegmentXY([&len](double x0, double y0, double x1, double y1) {
+            double dx = x1 - x0;
+            double dy = y1 - y0;
+            len += std::sqrt(dx * dx + dy * dy);
+        });
+        return len;
+    }
+};
+
+}
+
+/* public static */
+double
+Length::ofLine(const geom::FlatCoordinateSequence& pts)
+{
+    return pts.visit(LineLength());
+}
+
 
 } // namespace geos.algorithm
 } //namespace geos
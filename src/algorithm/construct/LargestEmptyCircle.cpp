@@ -27,11 +27,14 @@
 #include <geos/geom/LineString.h>
 #include <geos/geom/Polygon.h>
 #include <geos/geom/MultiPolygon.h>
+#include <geos/algorithm/InteriorPointArea.h>
 #include <geos/algorithm/locate/IndexedPointInAreaLocator.h>
 #include <geos/operation/distance/IndexedFacetDistance.h>
+#include <geos/util/parallel.h>
 
 #include <typeinfo> // for dynamic_cast
 #include <cassert>
+#include <vector>
 
 using namespace geos::geom;
 
@@ -96,6 +99,32 @@ LargestEmptyCircle::getRadiusLine(const Geometry* p_obstacles, double p_toleranc
     return lec.getRadiusLine();
 }
 
+/* public static */
+std::vector<std::unique_ptr<Point>>
+LargestEmptyCircle::getCenters(const std::vector<const Geometry*>& p_obstacles,
+    double p_tolerance, std::size_t numThreads)
+{
+    std::vector<std::unique_ptr<Point>> centers(p_obstacles.size());
+    util::parallelFor(p_obstacles.size(), numThreads, [&](std::size_t i) {
+        LargestEmptyCircle lec(p_obstacles[i], p_tolerance);
+        centers[i] = lec.getCenter();
+    });
+    return centers;
+}
+
+/* public static */
+std::vector<std::unique_ptr<LineString>>
+LargestEmptyCircle::getRadiusLines(const std::vector<const Geometry*>& p_obstacles,
+    double p_tolerance, std::size_t numThreads)
+{
+    std::vector<std::unique_ptr<LineString>> lines(p_obstacles.size());
+    util::parallelFor(p_obstacles.size(), numThreads, [&](std::size_t i) {
+        LargestEmptyCircle lec(p_obstacles[i], p_tolerance);
+        lines[i] = lec.getRadiusLine();
+    });
+    return lines;
+}
+
 /* public */
 std::unique_ptr<Point>
 LargestEmptyCircle::getCenter()
@@ -183,13 +212,12 @@ double
 LargestEmptyCircle::distanceToConstraints(const Coordinate& c)
 {
     bool isOutside = ptLocator && (Location::EXTERIOR == ptLocator->locate(&c));
-    std::unique_ptr<Point> pt(factory->createPoint(c));
     if (isOutside) {
-        double boundaryDist = boundaryDistance->distance(pt.get());
+        double boundaryDist = boundaryDistance->distance(c);
         return -boundaryDist;
 
     }
-    double dist = obstacleDistance.distance(pt.get());
+    double dist = obstacleDistance.distance(c);
     return dist;
 }
 
@@ -201,13 +229,30 @@ LargestEmptyCircle::distanceToConstraints(double x, double y)
     return distanceToConstraints(coord);
 }
 
+/**
+* Creates a cell for the initial candidate center point.
+* The centroid of the obstacles is used if it lies inside the boundary.
+* Otherwise an interior point of the boundary is used, if it is
+* a better candidate.
+*/
 /* private */
 LargestEmptyCircle::Cell
-LargestEmptyCircle::createCentroidCell(const Geometry* geom)
+LargestEmptyCircle::createInitialCandidateCell(const Geometry* geom)
 {
     Coordinate c;
     geom->getCentroid(c);
     Cell cell(c.x, c.y, 0, distanceToConstraints(c));
+    if (! cell.isOutside()) {
+        return cell;
+    }
+
+    Coordinate interiorPt;
+    if (InteriorPointArea(boundary.get()).getInteriorPoint(interiorPt)) {
+        Cell interiorCell(interiorPt.x, interiorPt.y, 0, distanceToConstraints(interiorPt));
+        if (interiorCell.getDistance() > cell.getDistance()) {
+            return interiorCell;
+        }
+    }
     return cell;
 }
 
@@ -233,7 +278,7 @@ LargestEmptyCircle::compute()
     std::priority_queue<Cell> cellQueue;
     createInitialGrid(obstacles->getEnvelopeInternal(), cellQueue);
 
-    Cell farthestCell = createCentroidCell(obstacles);
+    Cell farthestCell = createInitialCandidateCell(obstacles);
 
     /**
      * Carry out the branch-and-bound search
@@ -27,11 +27,14 @@
 #include <geos/geom/LineString.h>
 #include <geos/geom/Polygon.h>
 #include <geos/geom/MultiPolygon.h>
+#include <geos/algorithm/InteriorPointArea.h>
 #include <geos/algorithm/locate/IndexedPointInAreaLocator.h>
 #include <geos/operation/distance/IndexedFacetDistance.h>
+#include <geos/util/parallel.h>
 
 #include <typeinfo> // for dynamic_cast
 #include <cassert>
+#include <vector>
 
 using namespace geos::geom;
 
@@ -78,6 +81,32 @@ MaximumInscribedCircle::getRadiusLine(const Geometry* polygonal, double toleranc
     return mic.getRadiusLine();
 }
 
+/* public static */
+std::vector<std::unique_ptr<Point>>
+MaximumInscribedCircle::getCenters(const std::vector<const Geometry*>& polygonals,
+    double tolerance, std::size_t numThreads)
+{
+    std::vector<std::unique_ptr<Point>> centers(polygonals.size());
+    util::parallelFor(polygonals.size(), numThreads, [&](std::size_t i) {
+        MaximumInscribedCircle mic(polygonals[i], tolerance);
+        centers[i] = mic.getCenter();
+    });
+    return centers;
+}
+
+/* public static */
+std::vector<std::unique_ptr<LineString>>
+MaximumInscribedCircle::getRadiusLines(const std::vector<const Geometry*>& polygonals,
+    double tolerance, std::size_t numThreads)
+{
+    std::vector<std::unique_ptr<LineString>> lines(polygonals.size());
+    util::parallelFor(polygonals.size(), numThreads, [&](std::size_t i) {
+        MaximumInscribedCircle mic(polygonals[i], tolerance);
+        lines[i] = mic.getRadiusLine();
+    });
+    return lines;
+}
+
 /* public */
 std::unique_ptr<Point>
 MaximumInscribedCircle::getCenter()
@@ -135,9 +164,7 @@ MaximumInscribedCircle::createInitialGrid(const Envelope* env, std::priority_que
 double
 MaximumInscribedCircle::distanceToBoundary(const Coordinate& c)
 {
-    std::unique_ptr<Point> pt(factory->createPoint(c));
-    double dist = indexedDistance.distance(pt.get());
-    // double dist = inputGeomBoundary->distance(pt.get());
+    double dist = indexedDistance.distance(c);
     bool isOutside = (Location::EXTERIOR == ptLocator.locate(&c));
     if (isOutside) return -dist;
     return dist;
@@ -151,13 +178,31 @@ MaximumInscribedCircle::distanceToBoundary(double x, double y)
     return distanceToBoundary(coord);
 }
 
+/**
+* Creates a cell for the initial candidate center point.
+* The area centroid is used if it lies inside the polygon.
+* Otherwise the interior point is used, since it gives a positive
+* lower bound for the circle radius, which allows cells lying
+* outside the polygon to be pruned.
+*/
 /* private */
 MaximumInscribedCircle::Cell
-MaximumInscribedCircle::createCentroidCell(const Geometry* geom)
+MaximumInscribedCircle::createInitialCandidateCell(const Geometry* geom)
 {
     Coordinate c;
     geom->getCentroid(c);
     Cell cell(c.x, c.y, 0, distanceToBoundary(c));
+    if (cell.getDistance() > 0) {
+        return cell;
+    }
+
+    Coordinate interiorPt;
+    if (InteriorPointArea(geom).getInteriorPoint(interiorPt)) {
+        Cell interiorCell(interiorPt.x, interiorPt.y, 0, distanceToBoundary(interiorPt));
+        if (interiorCell.getDistance() > cell.getDistance()) {
+            return interiorCell;
+        }
+    }
     return cell;
 }
 
@@ -174,8 +219,8 @@ MaximumInscribedCircle::compute()
 
     createInitialGrid(inputGeom->getEnvelopeInternal(), cellQueue);
 
-    // use the area centroid as the initial candidate center point
-    Cell farthestCell = createCentroidCell(inputGeom);
+    // use the area centroid or interior point as the initial candidate center point
+    Cell farthestCell = createInitialCandidateCell(inputGeom);
 
     /**
      * Carry out the branch-and-bound search
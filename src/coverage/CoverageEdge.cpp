@@ -0,0 +1,66 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/coverage/CoverageEdge.h>
+
+#include <cassert>
+
+
+namespace geos {     // geos
+namespace coverage { // geos.coverage
+
+
+/* public static */
+LineSegment
+CoverageEdge::key(const std::vector<Coordinate>& pts)
+{
+    assert(pts.size() >= 2);
+    std::size_t n = pts.size();
+    LineSegment start(pts[0], pts[1]);
+    LineSegment end(pts[n - 1], pts[n - 2]);
+    return start.compareTo(end) <= 0 ? start : end;
+}
+
+
+/* public static */
+bool
+CoverageEdge::isForward(const std::vector<Coordinate>& pts, const LineSegment& key)
+{
+    return pts[0].equals2D(key.p0) && pts[1].equals2D(key.p1);
+}
+
+
+/* public */
+void
+CoverageEdge::addCoordinates(bool isForward, std::vector<Coordinate>& ringPts) const
+{
+    if (isForward) {
+        auto it = m_pts.begin();
+        if (! ringPts.empty() && ringPts.back().equals2D(*it)) {
+            ++it;
+        }
+        ringPts.insert(ringPts.end(), it, m_pts.end());
+    }
+    else {
+        auto it = m_pts.rbegin();
+        if (! ringPts.empty() && ringPts.back().equals2D(*it)) {
+            ++it;
+        }
+        ringPts.insert(ringPts.end(), it, m_pts.rend());
+    }
+}
+
+
+} // namespace geos.coverage
+} // namespace geos
@@ -0,0 +1,282 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/coverage/CoverageRingEdges.h>
+
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/MultiPolygon.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/util/PolygonExtracter.h>
+
+#include <algorithm>
+
+using geos::geom::CoordinateSequence;
+using geos::geom::GeometryFactory;
+using geos::geom::LinearRing;
+using geos::geom::Polygon;
+
+
+namespace geos {     // geos
+namespace coverage { // geos.coverage
+
+
+static std::vector<const Polygon*>
+getNonEmptyPolygons(const Geometry* geom)
+{
+    std::vector<const Polygon*> polygons;
+    geom::util::PolygonExtracter::getPolygons(*geom, polygons);
+    polygons.erase(std::remove_if(polygons.begin(), polygons.end(), [](const Polygon* poly) {
+        return poly->isEmpty();
+    }), polygons.end());
+    return polygons;
+}
+
+
+/* public */
+CoverageRingEdges::CoverageRingEdges(std::vector<const Geometry*>& coverage)
+    : m_coverage(coverage)
+{
+    build();
+}
+
+
+/* private */
+void
+CoverageRingEdges::build()
+{
+    for (const Geometry* geom : m_coverage) {
+        std::vector<const Polygon*> polygons = getNonEmptyPolygons(geom);
+        std::vector<CoverageRing*> rings = CoverageRing::createRings(polygons, m_ringStore);
+        m_rings.insert(m_rings.end(), rings.begin(), rings.end());
+    }
+
+    std::unordered_set<Coordinate, Coordinate::HashCode> nodes = findNodes();
+
+    std::unordered_map<LineSegment, std::size_t, LineSegment::HashCode> edgeMap;
+    m_ringEdges.resize(m_rings.size());
+    for (std::size_t i = 0; i < m_rings.size(); i++) {
+        addRingEdges(i, nodes, edgeMap);
+    }
+}
+
+
+/**
+* Nodes are the vertices where three or more distinct segments meet.
+* These are the points where the set of rings on either
+* side of the linework changes.
+*/
+/* private */
+std::unordered_set<Coordinate, Coordinate::HashCode>
+CoverageRingEdges::findNodes() const
+{
+    std::unordered_set<LineSegment, LineSegment::HashCode> segments;
+    std::unordered_map<Coordinate, std::size_t, Coordinate::HashCode> degree;
+
+    for (const CoverageRing* ring : m_rings) {
+        const CoordinateSequence* pts = ring->getCoordinates();
+        for (std::size_t i = 0; i + 1 < pts->size(); i++) {
+            const Coordinate& p0 = pts->getAt(i);
+            const Coordinate& p1 = pts->getAt(i + 1);
+            if (p0.equals2D(p1)) {
+                continue;
+            }
+            LineSegment seg(p0, p1);
+            seg.normalize();
+            if (segments.insert(seg).second) {
+                degree[p0]++;
+                degree[p1]++;
+            }
+        }
+    }
+
+    std::unordered_set<Coordinate, Coordinate::HashCode> nodes;
+    for (const auto& entry : degree) {
+        if (entry.second > 2) {
+            nodes.insert(entry.first);
+        }
+    }
+    return nodes;
+}
+
+
+/* private */
+void
+CoverageRingEdges::addRingEdges(
+    std::size_t ringIndex,
+    const std::unordered_set<Coordinate, Coordinate::HashCode>& nodes,
+    std::unordered_map<LineSegment, std::size_t, LineSegment::HashCode>& edgeMap)
+{
+    //-- ring vertices without repeated points, and without the closing point
+    const CoordinateSequence* seq = m_rings[ringIndex]->getCoordinates();
+    std::vector<Coordinate> pts;
+    for (std::size_t i = 0; i + 1 < seq->size(); i++) {
+        const Coordinate& p = seq->getAt(i);
+        if (pts.empty() || ! pts.back().equals2D(p)) {
+            pts.push_back(p);
+        }
+    }
+    while (pts.size() > 1 && pts.back().equals2D(pts.front())) {
+        pts.pop_back();
+    }
+    std::size_t n = pts.size();
+    if (n < 2) {
+        return;
+    }
+
+    std::vector<std::size_t> nodeIndexes;
+    for (std::size_t i = 0; i < n; i++) {
+        if (nodes.count(pts[i]) > 0) {
+            nodeIndexes.push_back(i);
+        }
+    }
+
+    std::vector<EdgeUse>& ringEdges = m_ringEdges[ringIndex];
+
+    //-- a ring with no nodes is a single edge, starting at its lowest vertex
+    if (nodeIndexes.empty()) {
+        std::size_t start = 0;
+        for (std::size_t i = 1; i < n; i++) {
+            if (pts[i].compareTo(pts[start]) < 0) {
+                start = i;
+            }
+        }
+        std::vector<Coordinate> section;
+        section.reserve(n + 1);
+        for (std::size_t i = 0; i <= n; i++) {
+            section.push_back(pts[(start + i) % n]);
+        }
+        addEdge(std::move(section), true, ringEdges, edgeMap);
+        return;
+    }
+
+    for (std::size_t k = 0; k < nodeIndexes.size(); k++) {
+        std::size_t start = nodeIndexes[k];
+        std::size_t end = k + 1 < nodeIndexes.size() ? nodeIndexes[k + 1] : nodeIndexes[0] + n;
+        std::vector<Coordinate> section;
+        section.reserve(end - start + 1);
+        for (std::size_t i = start; i <= end; i++) {
+            section.push_back(pts[i % n]);
+        }
+        addEdge(std::move(section), false, ringEdges, edgeMap);
+    }
+}
+
+
+/* private */
+void
+CoverageRingEdges::addEdge(
+    std::vector<Coordinate>&& sectionPts,
+    bool isFreeRing,
+    std::vector<EdgeUse>& ringEdges,
+    std::unordered_map<LineSegment, std::size_t, LineSegment::HashCode>& edgeMap)
+{
+    LineSegment key = CoverageEdge::key(sectionPts);
+    bool isForward = CoverageEdge::isForward(sectionPts, key);
+
+    std::size_t edgeIndex;
+    auto it = edgeMap.find(key);
+    if (it == edgeMap.end()) {
+        if (! isForward) {
+            std::reverse(sectionPts.begin(), sectionPts.end());
+        }
+        edgeIndex = m_edges.size();
+        m_edges.emplace_back(std::move(sectionPts), isFreeRing);
+        edgeMap.emplace(key, edgeIndex);
+    }
+    else {
+        edgeIndex = it->second;
+    }
+
+    m_edges[edgeIndex].incRingCount();
+    ringEdges.push_back({edgeIndex, isForward});
+}
+
+
+/* public */
+std::size_t
+CoverageRingEdges::getRingSize(std::size_t ringIndex) const
+{
+    std::size_t size = 0;
+    for (const EdgeUse& use : m_ringEdges[ringIndex]) {
+        size += m_edges[use.edgeIndex].size() - 1;
+    }
+    return size;
+}
+
+
+/* public */
+std::vector<std::unique_ptr<Geometry>>
+CoverageRingEdges::buildCoverage() const
+{
+    std::vector<std::unique_ptr<Geometry>> result;
+    std::size_t ringIndex = 0;
+    for (const Geometry* geom : m_coverage) {
+        result.push_back(buildGeometry(geom, ringIndex));
+    }
+    return result;
+}
+
+
+/* private */
+std::unique_ptr<Geometry>
+CoverageRingEdges::buildGeometry(const Geometry* geom, std::size_t& ringIndex) const
+{
+    if (geom->isEmpty()) {
+        return geom->clone();
+    }
+
+    if (geom->getGeometryTypeId() == geom::GEOS_POLYGON) {
+        return buildPolygon(static_cast<const Polygon*>(geom), ringIndex);
+    }
+
+    std::vector<std::unique_ptr<Polygon>> polygons;
+    for (const Polygon* poly : getNonEmptyPolygons(geom)) {
+        polygons.push_back(buildPolygon(poly, ringIndex));
+    }
+    return geom->getFactory()->createMultiPolygon(std::move(polygons));
+}
+
+
+/* private */
+std::unique_ptr<Polygon>
+CoverageRingEdges::buildPolygon(const Polygon* poly, std::size_t& ringIndex) const
+{
+    const GeometryFactory* factory = poly->getFactory();
+    std::unique_ptr<LinearRing> shell = buildRing(ringIndex++, factory);
+
+    std::vector<std::unique_ptr<LinearRing>> holes;
+    for (std::size_t i = 0; i < poly->getNumInteriorRing(); i++) {
+        holes.push_back(buildRing(ringIndex++, factory));
+    }
+    return factory->createPolygon(std::move(shell), std::move(holes));
+}
+
+
+/* private */
+std::unique_ptr<LinearRing>
+CoverageRingEdges::buildRing(std::size_t ringIndex, const GeometryFactory* factory) const
+{
+    std::vector<Coordinate> pts;
+    for (const EdgeUse& use : m_ringEdges[ringIndex]) {
+        m_edges[use.edgeIndex].addCoordinates(use.isForward, pts);
+    }
+    return factory->createLinearRing(std::move(pts));
+}
+
+
+} // namespace geos.coverage
+} // namespace geos
@@ -0,0 +1,355 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/coverage/CoverageSimplifier.h>
+#include <geos/coverage/CoverageEdge.h>
+#include <geos/coverage/CoverageRingEdges.h>
+
+#include <geos/algorithm/Distance.h>
+#include <geos/algorithm/LineIntersector.h>
+#include <geos/algorithm/PointLocation.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/Location.h>
+#include <geos/util/IllegalArgumentException.h>
+#include <geos/util/parallel.h>
+
+#include <algorithm>
+#include <utility>
+
+using geos::algorithm::Distance;
+using geos::algorithm::LineIntersector;
+using geos::algorithm::PointLocation;
+using geos::geom::Envelope;
+using geos::geom::Location;
+
+
+namespace geos {     // geos
+namespace coverage { // geos.coverage
+
+
+/**
+* Tests whether the intersection of two segments is only
+* a shared endpoint.
+*/
+static bool
+isEndpointTouch(const LineIntersector& li,
+    const Coordinate& p0, const Coordinate& p1,
+    const Coordinate& q0, const Coordinate& q1)
+{
+    if (li.getIntersectionNum() != 1) {
+        return false;
+    }
+    const Coordinate& pt = li.getIntersection(0);
+    return (pt.equals2D(p0) || pt.equals2D(p1))
+        && (pt.equals2D(q0) || pt.equals2D(q1));
+}
+
+
+/* public static */
+std::vector<std::unique_ptr<Geometry>>
+CoverageSimplifier::simplify(std::vector<const Geometry*>& coverage, double tolerance)
+{
+    CoverageSimplifier simplifier(coverage);
+    return simplifier.simplify(tolerance);
+}
+
+
+/* public */
+std::vector<std::unique_ptr<Geometry>>
+CoverageSimplifier::simplify(double tolerance)
+{
+    if (tolerance < 0.0) {
+        throw util::IllegalArgumentException("Tolerance must be non-negative");
+    }
+
+    CoverageRingEdges ringEdges(m_coverage);
+    std::vector<CoverageEdge>& edges = ringEdges.getEdges();
+
+    std::vector<std::vector<Coordinate>> inputPts;
+    inputPts.reserve(edges.size());
+    for (const CoverageEdge& edge : edges) {
+        inputPts.push_back(edge.getCoordinates());
+    }
+    TemplateSTRtree<SegmentRef> inputIndex;
+    indexSegments(inputPts, inputIndex);
+
+    //-- each edge is simplified once, against the read-only input linework
+    std::vector<std::vector<Coordinate>> simplePts(edges.size());
+    util::parallelFor(edges.size(), m_numThreads, [&](std::size_t i) {
+        simplePts[i] = simplifyEdge(i, inputPts[i], tolerance, inputPts, inputIndex);
+    }, 16);
+
+    /**
+    * Simplified edges do not cross input edges, but they may cross other
+    * simplified edges. Restoring every edge involved in a crossing
+    * removes the crossing without introducing new ones.
+    */
+    TemplateSTRtree<SegmentRef> simpleIndex;
+    indexSegments(simplePts, simpleIndex);
+    std::vector<char> isConflict(edges.size(), 0);
+    util::parallelFor(edges.size(), m_numThreads, [&](std::size_t i) {
+        for (std::size_t j = 0; j + 1 < simplePts[i].size(); j++) {
+            if (hasConflict({i, j}, simplePts, simpleIndex)) {
+                isConflict[i] = 1;
+                return;
+            }
+        }
+    }, 16);
+
+    for (std::size_t i = 0; i < edges.size(); i++) {
+        if (isConflict[i]) {
+            edges[i].setCoordinates(std::move(inputPts[i]));
+        }
+        else {
+            edges[i].setCoordinates(std::move(simplePts[i]));
+        }
+    }
+
+    //-- rings must keep at least three vertices
+    for (std::size_t i = 0; i < ringEdges.getNumRings(); i++) {
+        if (ringEdges.getRingSize(i) >= 3) {
+            continue;
+        }
+        for (const CoverageRingEdges::EdgeUse& use : ringEdges.getRingEdges(i)) {
+            if (! isConflict[use.edgeIndex]) {
+                edges[use.edgeIndex].setCoordinates(std::move(inputPts[use.edgeIndex]));
+                isConflict[use.edgeIndex] = 1;
+            }
+        }
+    }
+
+    return ringEdges.buildCoverage();
+}
+
+
+/* private static */
+void
+CoverageSimplifier::indexSegments(
+    const std::vector<std::vector<Coordinate>>& edgePts,
+    TemplateSTRtree<SegmentRef>& index)
+{
+    for (std::size_t i = 0; i < edgePts.size(); i++) {
+        const std::vector<Coordinate>& pts = edgePts[i];
+        for (std::size_t j = 0; j + 1 < pts.size(); j++) {
+            index.insert(Envelope(pts[j], pts[j + 1]), SegmentRef{i, j});
+        }
+    }
+    index.build();
+}
+
+
+/* private static */
+std::vector<Coordinate>
+CoverageSimplifier::simplifyEdge(
+    std::size_t edgeIndex,
+    const std::vector<Coordinate>& pts,
+    double tolerance,
+    const std::vector<std::vector<Coordinate>>& inputPts,
+    TemplateSTRtree<SegmentRef>& inputIndex)
+{
+    std::size_t n = pts.size();
+    bool isClosed = pts.front().equals2D(pts.back());
+    if (n <= 2 || (isClosed && n <= 4)) {
+        return pts;
+    }
+
+    std::vector<bool> isKept(n, false);
+    isKept[0] = true;
+    isKept[n - 1] = true;
+
+    //-- Douglas-Peucker, with an explicit stack to handle long edges
+    std::vector<std::pair<std::size_t, std::size_t>> sections;
+    if (isClosed) {
+        /**
+        * A closed edge keeps a triangle, so that it cannot collapse:
+        * the vertex farthest from its start, and the vertex farthest
+        * from the chord joining them.
+        */
+        std::size_t farIndex = 1;
+        for (std::size_t i = 2; i < n - 1; i++) {
+            if (pts[i].distance(pts[0]) > pts[farIndex].distance(pts[0])) {
+                farIndex = i;
+            }
+        }
+        std::size_t sideIndex = farIndex == 1 ? 2 : 1;
+        double sideDist = -1.0;
+        for (std::size_t i = 1; i < n - 1; i++) {
+            if (i == farIndex) {
+                continue;
+            }
+            double dist = Distance::pointToSegment(pts[i], pts[0], pts[farIndex]);
+            if (dist > sideDist) {
+                sideDist = dist;
+                sideIndex = i;
+            }
+        }
+        std::size_t index1 = std::min(farIndex, sideIndex);
+        std::size_t index2 = std::max(farIndex, sideIndex);
+        isKept[index1] = true;
+        isKept[index2] = true;
+        sections.emplace_back(index2, n - 1);
+        sections.emplace_back(index1, index2);
+        sections.emplace_back(0, index1);
+    }
+    else {
+        sections.emplace_back(0, n - 1);
+    }
+    while (! sections.empty()) {
+        std::size_t start = sections.back().first;
+        std::size_t end = sections.back().second;
+        sections.pop_back();
+
+        if (end <= start + 1) {
+            continue;
+        }
+
+        double maxDist = -1.0;
+        std::size_t maxIndex = start + 1;
+        for (std::size_t i = start + 1; i < end; i++) {
+            double dist = Distance::pointToSegment(pts[i], pts[start], pts[end]);
+            if (dist > maxDist) {
+                maxDist = dist;
+                maxIndex = i;
+            }
+        }
+
+        if (maxDist <= tolerance
+            && isFlatteningValid(edgeIndex, pts, start, end, inputPts, inputIndex)) {
+            continue;
+        }
+
+        isKept[maxIndex] = true;
+        sections.emplace_back(maxIndex, end);
+        sections.emplace_back(start, maxIndex);
+    }
+
+    std::vector<Coordinate> result;
+    for (std::size_t i = 0; i < n; i++) {
+        if (isKept[i]) {
+            result.push_back(pts[i]);
+        }
+    }
+    return result;
+}
+
+
+/**
+* Tests whether a section of an edge can be replaced by the segment
+* joining its endpoints. The segment must not cross any input segment
+* other than those it replaces, and no input vertex may lie in the
+* area between the section and the segment.
+*/
+/* private static */
+bool
+CoverageSimplifier::isFlatteningValid(
+    std::size_t edgeIndex,
+    const std::vector<Coordinate>& pts,
+    std::size_t start, std::size_t end,
+    const std::vector<std::vector<Coordinate>>& inputPts,
+    TemplateSTRtree<SegmentRef>& inputIndex)
+{
+    const Coordinate& p0 = pts[start];
+    const Coordinate& p1 = pts[end];
+
+    Envelope sectionEnv;
+    std::vector<const Coordinate*> sectionRing;
+    for (std::size_t i = start; i <= end; i++) {
+        sectionEnv.expandToInclude(pts[i]);
+        sectionRing.push_back(&pts[i]);
+    }
+    sectionRing.push_back(&p0);
+
+    LineIntersector li;
+    bool isValid = true;
+    inputIndex.query(sectionEnv, [&](const SegmentRef& seg) {
+        if (seg.edgeIndex == edgeIndex && seg.segIndex >= start && seg.segIndex < end) {
+            return true;
+        }
+
+        const Coordinate& q0 = inputPts[seg.edgeIndex][seg.segIndex];
+        const Coordinate& q1 = inputPts[seg.edgeIndex][seg.segIndex + 1];
+
+        li.computeIntersection(p0, p1, q0, q1);
+        if (li.hasIntersection() && ! isEndpointTouch(li, p0, p1, q0, q1)) {
+            isValid = false;
+            return false;
+        }
+
+        if (sectionEnv.contains(q0)
+            && PointLocation::locateInRing(q0, sectionRing) == Location::INTERIOR) {
+            isValid = false;
+            return false;
+        }
+        return true;
+    });
+    return isValid;
+}
+
+
+/**
+* Tests whether a simplified segment crosses or overlaps another
+* simplified segment, or touches a segment of the same edge which
+* does not precede or follow it.
+*/
+/* private static */
+bool
+CoverageSimplifier::hasConflict(
+    const SegmentRef& seg,
+    const std::vector<std::vector<Coordinate>>& edgePts,
+    TemplateSTRtree<SegmentRef>& index)
+{
+    const std::vector<Coordinate>& pts = edgePts[seg.edgeIndex];
+    const Coordinate& p0 = pts[seg.segIndex];
+    const Coordinate& p1 = pts[seg.segIndex + 1];
+    std::size_t lastSegIndex = pts.size() - 2;
+    bool isClosed = pts.front().equals2D(pts.back());
+
+    LineIntersector li;
+    bool isConflict = false;
+    index.query(Envelope(p0, p1), [&](const SegmentRef& other) {
+        if (other.edgeIndex == seg.edgeIndex && other.segIndex == seg.segIndex) {
+            return true;
+        }
+
+        const Coordinate& q0 = edgePts[other.edgeIndex][other.segIndex];
+        const Coordinate& q1 = edgePts[other.edgeIndex][other.segIndex + 1];
+
+        li.computeIntersection(p0, p1, q0, q1);
+        if (! li.hasIntersection()) {
+            return true;
+        }
+
+        if (isEndpointTouch(li, p0, p1, q0, q1)) {
+            if (other.edgeIndex != seg.edgeIndex) {
+                return true;
+            }
+            std::size_t i = std::min(seg.segIndex, other.segIndex);
+            std::size_t j = std::max(seg.segIndex, other.segIndex);
+            bool isAdjacent = j == i + 1
+                || (isClosed && i == 0 && j == lastSegIndex);
+            if (isAdjacent) {
+                return true;
+            }
+        }
+
+        isConflict = true;
+        return false;
+    });
+    return isConflict;
+}
+
+
+} // namespace geos.coverage
+} // namespace geos
@@ -17,12 +17,18 @@
 
 #include <geos/geom/Envelope.h>
 #include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryComponentFilter.h>
 #include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LineString.h>
+#include <geos/util/parallel.h>
+
+#include <mutex>
 
 
 using geos::geom::Envelope;
 using geos::geom::Geometry;
 using geos::geom::GeometryFactory;
+using geos::geom::LineString;
 
 
 namespace geos {     // geos
@@ -72,18 +78,62 @@ std::vector<std::unique_ptr<Geometry>>
 CoverageValidator::validate()
 {
     TemplateSTRtree<const Geometry*> index;
-    std::vector<std::unique_ptr<Geometry>> invalidLines;
+    buildIndex(index);
+
+    std::vector<std::unique_ptr<Geometry>> invalidLines(m_coverage.size());
+    util::parallelFor(m_coverage.size(), m_numThreads, [this, &index, &invalidLines](std::size_t i) {
+        invalidLines[i] = validate(m_coverage[i], index);
+    });
+    return invalidLines;
+}
+
+/* public */
+void
+CoverageValidator::validate(const std::function<void(std::size_t, std::unique_ptr<Geometry>)>& visitor)
+{
+    TemplateSTRtree<const Geometry*> index;
+    buildIndex(index);
+
+    std::mutex visitorLock;
+    util::parallelFor(m_coverage.size(), m_numThreads, [this, &index, &visitor, &visitorLock](std::size_t i) {
+        std::unique_ptr<Geometry> result = validate(m_coverage[i], index);
+        if (result != nullptr) {
+            std::lock_guard<std::mutex> lock(visitorLock);
+            visitor(i, std::move(result));
+        }
+    });
+}
+
+/* private */
+void
+CoverageValidator::buildIndex(TemplateSTRtree<const Geometry*>& index)
+{
     for (auto* geom : m_coverage) {
         index.insert(geom);
-        invalidLines.emplace_back(nullptr);
     }
+    index.build();
 
-    for (std::size_t i = 0; i < m_coverage.size(); i++) {
-        const Geometry* geom = m_coverage[i];
-        std::unique_ptr<Geometry> result = validate(geom, index);
-        invalidLines[i].reset(result.release());
+    if (m_numThreads == 1) {
+        return;
+    }
+
+    /**
+    * Envelopes and coordinate dimensions are computed on first use and
+    * cached. Compute them now, so that the coverage geometries are only
+    * read while polygons are validated concurrently.
+    */
+    struct CacheFilter : public geom::GeometryComponentFilter {
+        void filter_ro(const Geometry* geom) override {
+            geom->getEnvelopeInternal();
+            if (const auto* line = dynamic_cast<const LineString*>(geom)) {
+                line->getCoordinatesRO()->getDimension();
+            }
+        }
+    };
+    CacheFilter filter;
+    for (auto* geom : m_coverage) {
+        geom->apply_ro(&filter);
     }
-    return invalidLines;
 }
 
 /* private */
@@ -30,41 +30,43 @@ namespace geos {
 namespace geom { // geos::geom
 
 CoordinateArraySequence::CoordinateArraySequence():
+    vect(std::make_shared<std::vector<Coordinate>>()),
     dimension(0)
 {
 }
 
 CoordinateArraySequence::CoordinateArraySequence(std::size_t n,
         std::size_t dimension_in):
-    vect(n),
+    vect(std::make_shared<std::vector<Coordinate>>(n)),
     dimension(dimension_in)
 {
 }
 
 CoordinateArraySequence::CoordinateArraySequence(std::vector<Coordinate> && coords, std::size_t dimension_in):
-        vect(std::move(coords)),
+        vect(std::make_shared<std::vector<Coordinate>>(std::move(coords))),
         dimension(dimension_in)
 {
 }
 
 CoordinateArraySequence::CoordinateArraySequence(std::vector<CoordinateXY> && coords, std::size_t dimension_in):
-        vect(coords.size()),
+        vect(std::make_shared<std::vector<Coordinate>>(coords.size())),
         dimension(dimension_in)
 {
     // FIXME remove copy
     for (size_t i = 0; i < coords.size(); i++) {
-        vect[i] = Coordinate(coords[i]);
+        (*vect)[i] = Coordinate(coords[i]);
     }
 }
 
 CoordinateArraySequence::CoordinateArraySequence(
     std::vector<Coordinate>* coords, std::size_t dimension_in)
-    : dimension(dimension_in)
+    : vect(std::make_shared<std::vector<Coordinate>>())
+    , dimension(dimension_in)
 {
     std::unique_ptr<std::vector<Coordinate>> coordp(coords);
 
     if(coordp) {
-        vect = std::move(*coords);
+        *vect = std::move(*coords);
     }
 }
 
@@ -81,11 +83,17 @@ CoordinateArraySequence::CoordinateArraySequence(
     const CoordinateSequence& c)
     :
     CoordinateSequence(c),
-    vect(c.size()),
     dimension(c.getDimension())
 {
-    for(std::size_t i = 0, n = vect.size(); i < n; ++i) {
-        vect[i] = c.getAt(i);
+    const CoordinateArraySequence* cas = dynamic_cast<const CoordinateArraySequence*>(&c);
+    if(cas) {
+        vect = cas->vect;
+        return;
+    }
+
+    vect = std::make_shared<std::vector<Coordinate>>(c.size());
+    for(std::size_t i = 0, n = vect->size(); i < n; ++i) {
+        (*vect)[i] = c.getAt(i);
     }
 }
 
@@ -98,7 +106,30 @@ CoordinateArraySequence::clone() const
 void
 CoordinateArraySequence::setPoints(const std::vector<Coordinate>& v)
 {
-    vect.assign(v.begin(), v.end());
+    if(isShared()) {
+        vect = std::make_shared<std::vector<Coordinate>>(v);
+    }
+    else {
+        vect->assign(v.begin(), v.end());
+    }
+}
+
+void
+CoordinateArraySequence::clear()
+{
+    if(isShared()) {
+        vect = std::make_shared<std::vector<Coordinate>>();
+    }
+    else {
+        vect->clear();
+    }
+}
+
+/*private*/
+void
+CoordinateArraySequence::detach()
+{
+    vect = std::make_shared<std::vector<Coordinate>>(*vect);
 }
 
 std::size_t
@@ -108,11 +139,11 @@ CoordinateArraySequence::getDimension() const
         return dimension;
     }
 
-    if(vect.empty()) {
+    if(vect->empty()) {
         return 3;
     }
 
-    if(std::isnan(vect[0].z)) {
+    if(std::isnan((*vect)[0].z)) {
         dimension = 2;
     }
     else {
@@ -125,13 +156,13 @@ CoordinateArraySequence::getDimension() const
 void
 CoordinateArraySequence::toVector(std::vector<Coordinate>& out) const
 {
-    out.insert(out.end(), vect.begin(), vect.end());
+    out.insert(out.end(), vect->begin(), vect->end());
 }
 
 void
 CoordinateArraySequence::toVector(std::vector<CoordinateXY>& out) const
 {
-    for (const auto& pt : vect) {
+    for (const auto& pt : *vect) {
         out.push_back(pt);
     }
 }
@@ -139,19 +170,19 @@ CoordinateArraySequence::toVector(std::vector<CoordinateXY>& out) const
 void
 CoordinateArraySequence::add(const Coordinate& c)
 {
-    vect.push_back(c);
+    mutableCoords().push_back(c);
 }
 
 void
 CoordinateArraySequence::add(const Coordinate& c, bool allowRepeated)
 {
-    if(!allowRepeated && ! vect.empty()) {
-        const Coordinate& last = vect.back();
+    if(!allowRepeated && ! vect->empty()) {
+        const Coordinate& last = vect->back();
         if(last.equals2D(c)) {
             return;
         }
     }
-    vect.push_back(c);
+    mutableCoords().push_back(c);
 }
 
 void
@@ -196,43 +227,44 @@ CoordinateArraySequence::add(std::size_t i, const Coordinate& coord,
         }
     }
 
-    vect.insert(std::next(vect.begin(), static_cast<std::ptrdiff_t>(i)), coord);
+    std::vector<Coordinate>& coords = mutableCoords();
+    coords.insert(std::next(coords.begin(), static_cast<std::ptrdiff_t>(i)), coord);
 }
 
 size_t
 CoordinateArraySequence::getSize() const
 {
-    return vect.size();
+    return vect->size();
 }
 
 const Coordinate&
 CoordinateArraySequence::getAt(std::size_t pos) const
 {
-    return vect[pos];
+    return (*vect)[pos];
 }
 
 Coordinate&
 CoordinateArraySequence::getAt(std::size_t pos)
 {
-    return vect[pos];
+    return (*vect)[pos];
 }
 
 void
 CoordinateArraySequence::getAt(std::size_t pos, Coordinate& c) const
 {
-    c = vect[pos];
+    c = (*vect)[pos];
 }
 
 void
 CoordinateArraySequence::setAt(const Coordinate& c, std::size_t pos)
 {
-    vect[pos] = c;
+    mutableCoords()[pos] = c;
 }
 
 void
 CoordinateArraySequence::expandEnvelope(Envelope& env) const
 {
-    for(const auto& coord : vect) {
+    for(const auto& coord : *vect) {
         env.expandToInclude(coord);
     }
 }
@@ -243,13 +275,13 @@ CoordinateArraySequence::setOrdinate(std::size_t index, std::size_t ordinateInde
 {
     switch(ordinateIndex) {
     case CoordinateSequence::X:
-        vect[index].x = value;
+        mutableCoords()[index].x = value;
         break;
     case CoordinateSequence::Y:
-        vect[index].y = value;
+        mutableCoords()[index].y = value;
         break;
     case CoordinateSequence::Z:
-        vect[index].z = value;
+        mutableCoords()[index].z = value;
         break;
     default: {
         std::stringstream ss;
@@ -263,14 +295,16 @@ void
 CoordinateArraySequence::closeRing()
 {
     if(!isEmpty() && front() != back()) {
-        add(front());
+        // copy first: front() may refer to coordinates released by add()
+        Coordinate first = front();
+        add(first);
     }
 }
 
 void
 CoordinateArraySequence::apply_rw(const CoordinateFilter* filter)
 {
-    for(auto& coord : vect) {
+    for(auto& coord : mutableCoords()) {
         filter->filter_rw(&coord);
     }
     dimension = 0; // re-check (see http://trac.osgeo.org/geos/ticket/435)
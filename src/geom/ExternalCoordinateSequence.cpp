@@ -0,0 +1,125 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/geom/ExternalCoordinateSequence.h>
+#include <geos/geom/Envelope.h>
+#include <geos/util/IllegalArgumentException.h>
+#include <geos/util.h>
+
+#include <sstream>
+
+namespace geos {
+namespace geom { // geos::geom
+
+ExternalCoordinateSequence::ExternalCoordinateSequence(const Coordinate* coords, std::size_t p_size,
+        std::shared_ptr<const void> owner, std::size_t dimension)
+    : m_coords(coords)
+    , m_size(p_size)
+    , m_owner(std::move(owner))
+    , m_dimension(dimension)
+    , m_owned(false)
+{
+}
+
+std::unique_ptr<CoordinateSequence>
+ExternalCoordinateSequence::clone() const
+{
+    return detail::make_unique<ExternalCoordinateSequence>(*this);
+}
+
+void
+ExternalCoordinateSequence::toVector(std::vector<Coordinate>& coords) const
+{
+    coords.insert(coords.end(), m_coords, m_coords + m_size);
+}
+
+void
+ExternalCoordinateSequence::toVector(std::vector<CoordinateXY>& coords) const
+{
+    for(std::size_t i = 0; i < m_size; i++) {
+        coords.push_back(m_coords[i]);
+    }
+}
+
+void
+ExternalCoordinateSequence::setAt(const Coordinate& c, std::size_t pos)
+{
+    mutableCoords()[pos] = c;
+}
+
+void
+ExternalCoordinateSequence::setPoints(const std::vector<Coordinate>& v)
+{
+    own(std::vector<Coordinate>(v));
+}
+
+void
+ExternalCoordinateSequence::setOrdinate(std::size_t index, std::size_t ordinateIndex, double value)
+{
+    switch(ordinateIndex) {
+    case CoordinateSequence::X:
+        mutableCoords()[index].x = value;
+        break;
+    case CoordinateSequence::Y:
+        mutableCoords()[index].y = value;
+        break;
+    case CoordinateSequence::Z:
+        mutableCoords()[index].z = value;
+        break;
+    default: {
+        std::stringstream ss;
+        ss << "Unknown ordinate index " << ordinateIndex;
+        throw util::IllegalArgumentException(ss.str());
+    }
+    }
+}
+
+void
+ExternalCoordinateSequence::expandEnvelope(Envelope& env) const
+{
+    for(std::size_t i = 0; i < m_size; i++) {
+        env.expandToInclude(m_coords[i]);
+    }
+}
+
+void
+ExternalCoordinateSequence::apply_rw(const CoordinateFilter* filter)
+{
+    Coordinate* coords = mutableCoords();
+    for(std::size_t i = 0; i < m_size; i++) {
+        filter->filter_rw(&coords[i]);
+    }
+}
+
+void
+ExternalCoordinateSequence::apply_ro(CoordinateFilter* filter) const
+{
+    for(std::size_t i = 0; i < m_size; i++) {
+        filter->filter_ro(&m_coords[i]);
+    }
+}
+
+/*private*/
+void
+ExternalCoordinateSequence::own(std::vector<Coordinate>&& coords)
+{
+    auto owned = std::make_shared<std::vector<Coordinate>>(std::move(coords));
+    m_coords = owned->data();
+    m_size = owned->size();
+    m_owner = std::move(owned);
+    m_owned = true;
+}
+
+} // namespace geos::geom
+} // namespace geos
@@ -0,0 +1,235 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/geom/FlatCoordinateSequence.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/util/IllegalArgumentException.h>
+#include <geos/util.h>
+
+#include <algorithm>
+#include <sstream>
+
+namespace geos {
+namespace geom { // geos::geom
+
+namespace {
+
+std::size_t
+strideOf(CoordinateLayout layout)
+{
+    switch (layout) {
+        case CoordinateLayout::XYZ:
+        case CoordinateLayout::XYM:
+            return 3;
+        case CoordinateLayout::XYZM:
+            return 4;
+        default:
+            return 2;
+    }
+}
+
+const char*
+nameOf(CoordinateLayout layout)
+{
+    switch (layout) {
+        case CoordinateLayout::XYZ: return "XYZ";
+        case CoordinateLayout::XYM: return "XYM";
+        case CoordinateLayout::XYZM: return "XYZM";
+        default: return "XY";
+    }
+}
+
+} // anonymous namespace
+
+FlatCoordinateSequence::FlatCoordinateSequence(CoordinateLayout layout)
+    : m_layout(layout)
+    , m_stride(strideOf(layout))
+{
+}
+
+FlatCoordinateSequence::FlatCoordinateSequence(std::size_t p_size, CoordinateLayout layout)
+    : m_data(p_size * strideOf(layout), 0.0)
+    , m_layout(layout)
+    , m_stride(strideOf(layout))
+{
+}
+
+FlatCoordinateSequence::FlatCoordinateSequence(const double* buf, std::size_t p_size, CoordinateLayout layout)
+    : m_data(buf, buf + p_size * strideOf(layout))
+    , m_layout(layout)
+    , m_stride(strideOf(layout))
+{
+}
+
+FlatCoordinateSequence::FlatCoordinateSequence(const CoordinateSequence& seq)
+    : m_layout(seq.getDimension() > 2 ? CoordinateLayout::XYZ : CoordinateLayout::XY)
+    , m_stride(strideOf(m_layout))
+{
+    std::size_t n = seq.size();
+    m_data.resize(n * m_stride);
+    double* p = m_data.data();
+    for (std::size_t i = 0; i < n; i++) {
+        const Coordinate& c = seq.getAt(i);
+        *p++ = c.x;
+        *p++ = c.y;
+        if (m_stride == 3) {
+            *p++ = c.z;
+        }
+    }
+}
+
+/*public static*/
+CoordinateLayout
+FlatCoordinateSequence::layoutFor(bool p_hasZ, bool p_hasM)
+{
+    if (p_hasZ) {
+        return p_hasM ? CoordinateLayout::XYZM : CoordinateLayout::XYZ;
+    }
+    return p_hasM ? CoordinateLayout::XYM : CoordinateLayout::XY;
+}
+
+double
+FlatCoordinateSequence::getOrdinate(std::size_t index, std::size_t ordinateIndex) const
+{
+    switch (ordinateIndex) {
+        case CoordinateSequence::X:
+            return getX(index);
+        case CoordinateSequence::Y:
+            return getY(index);
+        case CoordinateSequence::Z:
+            return getZ(index);
+        case CoordinateSequence::M:
+            return getM(index);
+        default:
+            return DoubleNotANumber;
+    }
+}
+
+void
+FlatCoordinateSequence::setOrdinate(std::size_t index, std::size_t ordinateIndex, double value)
+{
+    double* p = &m_data[index * m_stride];
+    if (ordinateIndex == CoordinateSequence::X) {
+        p[0] = value;
+    }
+    else if (ordinateIndex == CoordinateSequence::Y) {
+        p[1] = value;
+    }
+    else if (ordinateIndex == CoordinateSequence::Z && hasZ()) {
+        p[2] = value;
+    }
+    else if (ordinateIndex == CoordinateSequence::M && hasM()) {
+        p[m_stride - 1] = value;
+    }
+    else {
+        std::ostringstream ss;
+        ss << "Ordinate index " << ordinateIndex << " is not stored in "
+           << nameOf(m_layout) << " coordinates";
+        throw util::IllegalArgumentException(ss.str());
+    }
+}
+
+void
+FlatCoordinateSequence::setAt(const Coordinate& c, std::size_t i)
+{
+    double* p = &m_data[i * m_stride];
+    p[0] = c.x;
+    p[1] = c.y;
+    if (hasZ()) {
+        p[2] = c.z;
+    }
+}
+
+void
+FlatCoordinateSequence::add(double x, double y, double z, double m)
+{
+    m_data.push_back(x);
+    m_data.push_back(y);
+    if (hasZ()) {
+        m_data.push_back(z);
+    }
+    if (hasM()) {
+        m_data.push_back(m);
+    }
+}
+
+namespace {
+
+/// Bounding box of a non-empty FlatCoordinateView of any layout
+struct ViewEnvelope {
+    template<typename View>
+    Envelope operator()(const View& view) const
+    {
+        double minx = view.getX(0);
+        double maxx = minx;
+        double miny = view.getY(0);
+        double maxy = miny;
+        view.forEachXY([&](double x, double y) {
+            minx = std::min(minx, x);
+            maxx = std::max(maxx, x);
+            miny = std::min(miny, y);
+            maxy = std::max(maxy, y);
+        });
+        return Envelope(minx, maxx, miny, maxy);
+    }
+};
+
+/// Copies a FlatCoordinateView of any layout into a sequence of the same size
+struct CopyToSequence {
+    CoordinateArraySequence& seq;
+
+    template<typename View>
+    int operator()(const View& view) const
+    {
+        for (std::size_t i = 0; i < view.size(); i++) {
+            seq.setAt(view.getAt(i), i);
+        }
+        return 0;
+    }
+};
+
+}
+
+Envelope
+FlatCoordinateSequence::getEnvelope() const
+{
+    if (isEmpty()) {
+        return Envelope();
+    }
+    return visit(ViewEnvelope());
+}
+
+std::unique_ptr<CoordinateSequence>
+FlatCoordinateSequence::toCoordinateSequence() const
+{
+    std::size_t n = size();
+    auto seq = detail::make_unique<CoordinateArraySequence>(n, hasZ() ? 3u : 2u);
+    visit(CopyToSequence{*seq});
+    return seq;
+}
+
+void
+FlatCoordinateSequence::checkLayout(CoordinateLayout layout) const
+{
+    if (layout != m_layout) {
+        std::ostringstream ss;
+        ss << "Requested a view of " << nameOf(layout) << " coordinates on a "
+           << nameOf(m_layout) << " sequence";
+        throw util::IllegalArgumentException(ss.str());
+    }
+}
+
+} // namespace geos::geom
+} // namespace geos
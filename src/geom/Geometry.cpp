@@ -106,7 +106,7 @@ Geometry::GeometryChangedFilter Geometry::geometryChangedFilter;
 
 Geometry::Geometry(const GeometryFactory* newFactory)
     :
-    envelope(nullptr),
+    envelopeComputed(false),
     _factory(newFactory),
     _userData(nullptr)
 {
@@ -119,15 +119,13 @@ Geometry::Geometry(const GeometryFactory* newFactory)
 
 Geometry::Geometry(const Geometry& geom)
     :
+    envelope(geom.envelope),
     SRID(geom.getSRID()),
+    envelopeComputed(geom.envelopeComputed),
     _factory(geom._factory),
     _userData(nullptr)
 {
-    if(geom.envelope.get()) {
-        envelope.reset(new Envelope(*(geom.envelope)));
-    }
     //factory=geom.factory;
-    //envelope(new Envelope(*(geom.envelope.get())));
     //SRID=geom.getSRID();
     //_userData=NULL;
     _factory->addRef();
@@ -233,10 +231,11 @@ Geometry::getEnvelope() const
 const Envelope*
 Geometry::getEnvelopeInternal() const
 {
-    if(!envelope.get()) {
+    if(!envelopeComputed) {
         envelope = computeEnvelopeInternal();
+        envelopeComputed = true;
     }
-    return envelope.get();
+    return &envelope;
 }
 
 bool
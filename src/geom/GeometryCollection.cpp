@@ -264,13 +264,13 @@ GeometryCollection::normalize()
     });
 }
 
-Envelope::Ptr
+Envelope
 GeometryCollection::computeEnvelopeInternal() const
 {
-    Envelope::Ptr p_envelope(new Envelope());
+    Envelope p_envelope;
     for(const auto& g : geometries) {
         const Envelope* env = g->getEnvelopeInternal();
-        p_envelope->expandToInclude(env);
+        p_envelope.expandToInclude(env);
     }
     return p_envelope;
 }
@@ -144,7 +144,7 @@ const Coordinate&
 LineString::getCoordinateN(std::size_t n) const
 {
     assert(points.get());
-    return points->getAt(n);
+    return getCoordinatesRO()->getAt(n);
 }
 
 Dimension::DimensionType
@@ -187,7 +187,7 @@ LineString::getPointN(std::size_t n) const
 {
     assert(getFactory());
     assert(points.get());
-    return std::unique_ptr<Point>(getFactory()->createPoint(points->getAt(n)));
+    return std::unique_ptr<Point>(getFactory()->createPoint(getCoordinatesRO()->getAt(n)));
 }
 
 std::unique_ptr<Point>
@@ -242,9 +242,10 @@ bool
 LineString::isCoordinate(Coordinate& pt) const
 {
     assert(points.get());
-    std::size_t npts = points->getSize();
+    const CoordinateSequence& pts = *getCoordinatesRO();
+    std::size_t npts = pts.getSize();
     for(std::size_t i = 0; i < npts; i++) {
-        if(points->getAt(i) == pt) {
+        if(pts.getAt(i) == pt) {
             return true;
         }
     }
@@ -252,18 +253,14 @@ LineString::isCoordinate(Coordinate& pt) const
 }
 
 /*protected*/
-Envelope::Ptr
+Envelope
 LineString::computeEnvelopeInternal() const
 {
     if(isEmpty()) {
-        // We don't return NULL here
-        // as it would indicate "unknown"
-        // envelope. In this case we
-        // *know* the envelope is EMPTY.
-        return Envelope::Ptr(new Envelope());
+        return Envelope();
     }
 
-    return detail::make_unique<Envelope>(points->getEnvelope());
+    return points->getEnvelope();
 }
 
 bool
@@ -274,12 +271,14 @@ LineString::equalsExact(const Geometry* other, double tolerance) const
     }
 
     const LineString* otherLineString = detail::down_cast<const LineString*>(other);
-    std::size_t npts = points->getSize();
-    if(npts != otherLineString->points->getSize()) {
+    const CoordinateSequence& pts = *getCoordinatesRO();
+    const CoordinateSequence& otherPts = *otherLineString->getCoordinatesRO();
+    std::size_t npts = pts.getSize();
+    if(npts != otherPts.getSize()) {
         return false;
     }
     for(std::size_t i = 0; i < npts; ++i) {
-        if(!equal(points->getAt(i), otherLineString->points->getAt(i), tolerance)) {
+        if(!equal(pts.getAt(i), otherPts.getAt(i), tolerance)) {
             return false;
         }
     }
@@ -346,12 +345,14 @@ LineString::normalize()
         normalizeClosed();
         return;
     }
-    std::size_t npts = points->getSize();
+    // read through the const sequence, which a shared sequence does not copy
+    const CoordinateSequence& pts = *getCoordinatesRO();
+    std::size_t npts = pts.getSize();
     std::size_t n = npts / 2;
     for(std::size_t i = 0; i < n; i++) {
         std::size_t j = npts - 1 - i;
-        if(!(points->getAt(i) == points->getAt(j))) {
-            if(points->getAt(i).compareTo(points->getAt(j)) > 0) {
+        if(!(pts.getAt(i) == pts.getAt(j))) {
+            if(pts.getAt(i).compareTo(pts.getAt(j)) > 0) {
                 CoordinateSequence::reverse(points.get());
             }
             return;
@@ -373,8 +374,10 @@ LineString::compareToSameClass(const Geometry* ls) const
     if(mynpts < othnpts) {
         return -1;
     }
+    const CoordinateSequence& pts = *getCoordinatesRO();
+    const CoordinateSequence& otherPts = *line->getCoordinatesRO();
     for(std::size_t i = 0; i < mynpts; i++) {
-        int cmp = points->getAt(i).compareTo(line->points->getAt(i));
+        int cmp = pts.getAt(i).compareTo(otherPts.getAt(i));
         if(cmp) {
             return cmp;
         }
@@ -388,7 +391,7 @@ LineString::getCoordinate() const
     if(isEmpty()) {
         return nullptr;
     }
-    return &(points->getAt(0));
+    return &(getCoordinatesRO()->getAt(0));
 }
 
 double
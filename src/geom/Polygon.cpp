@@ -194,7 +194,7 @@ Polygon::getExteriorRing() const
 std::unique_ptr<LinearRing>
 Polygon::releaseExteriorRing()
 {
-    envelope.reset();
+    geometryChangedAction();
     return std::move(shell);
 }
 
@@ -255,10 +255,10 @@ Polygon::getBoundary() const
     return getFactory()->createMultiLineString(std::move(rings));
 }
 
-Envelope::Ptr
+Envelope
 Polygon::computeEnvelopeInternal() const
 {
-    return detail::make_unique<Envelope>(*(shell->getEnvelopeInternal()));
+    return *(shell->getEnvelopeInternal());
 }
 
 bool
@@ -14,11 +14,14 @@
 
 
 
+#include <geos/algorithm/Orientation.h>
 #include <geos/geom/Coordinate.h>
 #include <geos/geom/Envelope.h>
+#include <geos/geom/Triangle.h>
 #include <geos/index/VertexSequencePackedRtree.h>
 
 #include <algorithm>
+#include <array>
 
 namespace geos {
 namespace index {
@@ -253,63 +256,141 @@ VertexSequencePackedRtree::queryItemRange(const Envelope& queryEnv,
     }
 }
 
-//-- Index Modify --------------------------------------------------------------
-
-/**
-* Removes the input item at the given index from the spatial index.
-*
-* @param index the index of the item in the input
-*/
 /* public */
 void
-VertexSequencePackedRtree::remove(std::size_t index)
+VertexSequencePackedRtree::query(const geom::Triangle& queryTri, std::vector<std::size_t>& result) const
 {
-    removedItems[index] = true;
+    Envelope queryEnv(queryTri.p0, queryTri.p1);
+    queryEnv.expandToInclude(queryTri.p2);
+    std::size_t level = levelOffset.size() - 1;
+    queryNode(queryTri, queryEnv, level, 0, result);
+}
 
-    //--- prune the item parent node if all its items are removed
-    std::size_t nodeIndex = index / nodeCapacity;
-    if (! isItemsNodeEmpty(nodeIndex))
-        return;
 
-    bounds[nodeIndex].setToNull();
+/* private */
+void
+VertexSequencePackedRtree::queryNode(const geom::Triangle& queryTri, const Envelope& queryEnv,
+    std::size_t level, std::size_t nodeIndex,
+    std::vector<std::size_t>& result) const
+{
+    std::size_t boundsIndex = levelOffset[level] + nodeIndex;
+    const Envelope& nodeEnv = bounds[boundsIndex];
 
-    if (levelOffset.size() <= 2)
+    //--- node is empty
+    if (nodeEnv.isNull())
         return;
-
-    //-- prune the node parent if all children removed
-    std::size_t nodeLevelIndex = nodeIndex / nodeCapacity;
-    if (! isNodeEmpty(1, nodeLevelIndex))
+    if (! queryEnv.intersects(nodeEnv))
+        return;
+    if (isExterior(queryTri, nodeEnv))
         return;
 
-    std::size_t nodeIndex1 = levelOffset[1] + nodeLevelIndex;
-    bounds[nodeIndex1].setToNull();
-
-    // TODO: propagate removal up the tree nodes?
+    std::size_t childNodeIndex = nodeIndex * nodeCapacity;
+    if (level == 0) {
+        queryItemRange(queryTri, queryEnv, childNodeIndex, result);
+    }
+    else {
+        queryNodeRange(queryTri, queryEnv, level - 1, childNodeIndex, result);
+    }
 }
 
+
 /* private */
-bool
-VertexSequencePackedRtree::isNodeEmpty(std::size_t level, std::size_t index)
+void
+VertexSequencePackedRtree::queryNodeRange(const geom::Triangle& queryTri, const Envelope& queryEnv,
+    std::size_t level, std::size_t nodeStartIndex,
+    std::vector<std::size_t>& result) const
 {
-    std::size_t start = index * nodeCapacity;
-    std::size_t end = clampMax(start + nodeCapacity, levelOffset[level]);
-    for (std::size_t i = start; i < end; i++) {
-        if (!bounds[i].isNull())
-            return false;
+    std::size_t levelMax = levelSize(level);
+    for (std::size_t i = 0; i < nodeCapacity; i++) {
+        std::size_t index = nodeStartIndex + i;
+        if (index >= levelMax)
+            return;
+        queryNode(queryTri, queryEnv, level, index, result);
     }
-    return true;
 }
 
+
 /* private */
+void
+VertexSequencePackedRtree::queryItemRange(const geom::Triangle& queryTri, const Envelope& queryEnv,
+    std::size_t itemIndex, std::vector<std::size_t>& result) const
+{
+    for (std::size_t i = 0; i < nodeCapacity; i++) {
+        std::size_t index = itemIndex + i;
+        if (index >= items.size())
+            return;
+        const Coordinate& p = items[index];
+        bool removed = removedItems[index];
+        if ( (!removed) && queryEnv.contains(p)
+            && geom::Triangle::intersects(queryTri.p0, queryTri.p1, queryTri.p2, p))
+            result.push_back(index);
+    }
+}
+
+
+/**
+* Tests whether an envelope lies strictly outside a triangle,
+* which is the case if all its corners lie on the exterior side
+* of the line through one of the triangle edges.
+*/
+/* private static */
 bool
-VertexSequencePackedRtree::isItemsNodeEmpty(std::size_t nodeIndex)
+VertexSequencePackedRtree::isExterior(const geom::Triangle& tri, const Envelope& env)
 {
+    int exteriorIndex = geom::Triangle::isCCW(tri.p0, tri.p1, tri.p2) ?
+        algorithm::Orientation::CLOCKWISE : algorithm::Orientation::COUNTERCLOCKWISE;
+    std::array<geom::CoordinateXY, 4> corners{{
+        {env.getMinX(), env.getMinY()},
+        {env.getMinX(), env.getMaxY()},
+        {env.getMaxX(), env.getMaxY()},
+        {env.getMaxX(), env.getMinY()}
+    }};
+    std::array<const geom::CoordinateXY*, 3> pts{{ &tri.p0, &tri.p1, &tri.p2 }};
+    for (std::size_t i = 0; i < 3; i++) {
+        const geom::CoordinateXY& e0 = *pts[i];
+        const geom::CoordinateXY& e1 = *pts[(i + 1) % 3];
+        bool isEdgeSeparating = std::all_of(corners.begin(), corners.end(),
+            [&](const geom::CoordinateXY& p) {
+                return algorithm::Orientation::index(e0, e1, p) == exteriorIndex;
+            });
+        if (isEdgeSeparating)
+            return true;
+    }
+    return false;
+}
+
+//-- Index Modify --------------------------------------------------------------
+
+/**
+* Removes the input item at the given index from the spatial index.
+*
+* @param index the index of the item in the input
+*/
+/* public */
+void
+VertexSequencePackedRtree::remove(std::size_t index)
+{
+    removedItems[index] = true;
+
+    //--- shrink the item parent node to its remaining items
+    std::size_t nodeIndex = index / nodeCapacity;
     std::size_t start = nodeIndex * nodeCapacity;
     std::size_t end = clampMax(start + nodeCapacity, items.size());
+    Envelope nodeEnv;
     for (std::size_t i = start; i < end; i++) {
-        if (!removedItems[i]) return false;
+        if (!removedItems[i])
+            nodeEnv.expandToInclude(items[i]);
+    }
+    bounds[nodeIndex] = nodeEnv;
+
+    //--- shrink the ancestor nodes (they are pruned when all their items are removed)
+    for (std::size_t lvl = 1; lvl < levelOffset.size(); lvl++) {
+        std::size_t parentIndex = nodeIndex / nodeCapacity;
+        std::size_t childStart = levelOffset[lvl - 1] + parentIndex * nodeCapacity;
+        std::size_t childEnd = clampMax(childStart + nodeCapacity, levelOffset[lvl]);
+        bounds[levelOffset[lvl] + parentIndex] = computeNodeEnvelope(bounds, childStart, childEnd);
+        nodeIndex = parentIndex;
     }
-    return true;
 }
 
 /* private static */
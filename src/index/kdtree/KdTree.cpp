@@ -14,9 +14,12 @@
 
 #include <geos/index/kdtree/KdTree.h>
 #include <geos/geom/Envelope.h>
+#include <geos/util/IllegalArgumentException.h>
+#include <geos/util/parallel.h>
 
 #include <vector>
 #include <algorithm>
+#include <numeric>
 #include <stack>
 
 using namespace geos::geom;
@@ -91,6 +94,88 @@ KdTree::insert(const Coordinate& p, void* data)
     return insertExact(p, data);
 }
 
+/*public*/
+void
+KdTree::insert(const std::vector<Coordinate>& pts, const std::vector<void*>& data)
+{
+    if (!data.empty() && data.size() != pts.size()) {
+        throw util::IllegalArgumentException("KdTree::insert: number of data items does not match number of points");
+    }
+
+    if (root != nullptr || tolerance > 0) {
+        for (std::size_t i = 0; i < pts.size(); i++) {
+            insert(pts[i], data.empty() ? nullptr : data[i]);
+        }
+        return;
+    }
+
+    if (pts.empty()) {
+        return;
+    }
+
+    /**
+    * Merge repeated points. A stable sort keeps the first
+    * occurrence of each point at the front of its run.
+    */
+    std::vector<std::size_t> order(pts.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&pts](std::size_t a, std::size_t b) {
+        return pts[a].compareTo(pts[b]) < 0;
+    });
+
+    std::vector<BuildItem> items;
+    for (std::size_t i : order) {
+        if (!items.empty() && pts[items.back().index].equals2D(pts[i])) {
+            items.back().count++;
+        } else {
+            items.push_back({i, 1});
+        }
+    }
+
+    root = buildBalanced(pts, data, items.begin(), items.end(), true);
+}
+
+/*private*/
+KdNode*
+KdTree::buildBalanced(const std::vector<Coordinate>& pts, const std::vector<void*>& data,
+                      std::vector<BuildItem>::iterator begin, std::vector<BuildItem>::iterator end, bool odd)
+{
+    if (begin == end) {
+        return nullptr;
+    }
+
+    auto ord = [&pts, odd](const BuildItem& item) {
+        return odd ? pts[item.index].x : pts[item.index].y;
+    };
+
+    auto mid = begin + (end - begin) / 2;
+    std::nth_element(begin, mid, end, [&ord](const BuildItem& a, const BuildItem& b) {
+        return ord(a) < ord(b);
+    });
+
+    /**
+    * Points equal to the discriminant must go in the right subtree,
+    * as they do in insertExact(), so the node is the first of the
+    * points which share the median ordinate.
+    */
+    double discriminant = ord(*mid);
+    auto split = std::partition(begin, mid, [&ord, discriminant](const BuildItem& item) {
+        return ord(item) < discriminant;
+    });
+    std::iter_swap(split, mid);
+
+    const BuildItem& item = *split;
+    KdNode* node = createNode(pts[item.index], data.empty() ? nullptr : data[item.index]);
+    for (std::size_t i = 1; i < item.count; i++) {
+        node->increment();
+    }
+    numberOfNodes++;
+
+    node->setLeft(buildBalanced(pts, data, begin, split, !odd));
+    node->setRight(buildBalanced(pts, data, split + 1, end, !odd));
+    return node;
+}
+
 /*private*/
 KdNode*
 KdTree::findBestMatchNode(const Coordinate& p) {
@@ -283,6 +368,18 @@ KdTree::query(const geom::Envelope& queryEnv, std::vector<KdNode*>& result)
     queryNode(root, queryEnv, true, visitor);
 }
 
+/*public*/
+void
+KdTree::query(const std::vector<Envelope>& queryEnvs, std::vector<std::vector<KdNode*>>& result, std::size_t numThreads)
+{
+    result.clear();
+    result.resize(queryEnvs.size());
+    util::parallelFor(queryEnvs.size(), numThreads, [this, &queryEnvs, &result](std::size_t i) {
+        AccumulatingVisitor visitor(result[i]);
+        queryNode(root, queryEnvs[i], true, visitor);
+    }, 16);
+}
+
 /*public*/
 KdNode*
 KdTree::query(const geom::Coordinate& queryPt) {
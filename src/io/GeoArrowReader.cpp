@@ -0,0 +1,287 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/io/GeoArrowReader.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/ExternalCoordinateSequence.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/MultiLineString.h>
+#include <geos/geom/MultiPoint.h>
+#include <geos/geom/MultiPolygon.h>
+#include <geos/geom/Point.h>
+#include <geos/geom/Polygon.h>
+#include <geos/util/IllegalArgumentException.h>
+#include <geos/util.h>
+
+#include <cmath>
+#include <limits>
+#include <utility>
+
+using namespace geos::geom;
+
+namespace geos {
+namespace io { // geos.io
+
+static_assert(sizeof(Coordinate) == 3 * sizeof(double),
+              "GeoArrow XYZ coordinates are read as Coordinate");
+
+namespace {
+
+class GeoArrowArrayReader {
+public:
+    GeoArrowArrayReader(const GeometryFactory& gf, const double* coords, std::size_t numCoords,
+                        bool hasZ, std::shared_ptr<const void> owner)
+        : factory(gf)
+        , coordinates(coords)
+        , numCoordinates(numCoords)
+        , dimension(hasZ ? 3u : 2u)
+        , coordinateOwner(std::move(owner))
+    {}
+
+    std::unique_ptr<Geometry>
+    readPoint(std::size_t i) const
+    {
+        if (i >= numCoordinates) {
+            throw util::IllegalArgumentException("GeoArrowReader: more points than coordinates");
+        }
+        Coordinate c = readCoordinate(i);
+        if (std::isnan(c.x) && std::isnan(c.y)) {
+            return factory.createPoint(dimension);
+        }
+        return std::unique_ptr<Geometry>(factory.createPoint(c));
+    }
+
+    std::unique_ptr<LineString>
+    readLineString(const std::int32_t* offsets, std::size_t i) const
+    {
+        auto r = range(offsets, i, numCoordinates);
+        return factory.createLineString(readSequence(r.first, r.second));
+    }
+
+    std::unique_ptr<MultiPoint>
+    readMultiPoint(const std::int32_t* offsets, std::size_t i) const
+    {
+        auto r = range(offsets, i, numCoordinates);
+        std::vector<Coordinate> points;
+        points.reserve(r.second - r.first);
+        for (std::size_t j = r.first; j < r.second; j++) {
+            points.push_back(readCoordinate(j));
+        }
+        return factory.createMultiPoint(std::move(points));
+    }
+
+    std::unique_ptr<Polygon>
+    readPolygon(const std::int32_t* polygonOffsets, const std::int32_t* ringOffsets, std::size_t i) const
+    {
+        auto r = range(polygonOffsets, i);
+        if (r.first == r.second) {
+            return factory.createPolygon(dimension);
+        }
+        auto shell = readRing(ringOffsets, r.first);
+        std::vector<std::unique_ptr<LinearRing>> holes;
+        holes.reserve(r.second - r.first - 1);
+        for (std::size_t j = r.first + 1; j < r.second; j++) {
+            holes.push_back(readRing(ringOffsets, j));
+        }
+        return factory.createPolygon(std::move(shell), std::move(holes));
+    }
+
+    std::unique_ptr<MultiLineString>
+    readMultiLineString(const std::int32_t* geomOffsets, const std::int32_t* partOffsets, std::size_t i) const
+    {
+        auto r = range(geomOffsets, i);
+        std::vector<std::unique_ptr<LineString>> lines;
+        lines.reserve(r.second - r.first);
+        for (std::size_t j = r.first; j < r.second; j++) {
+            lines.push_back(readLineString(partOffsets, j));
+        }
+        return factory.createMultiLineString(std::move(lines));
+    }
+
+    std::unique_ptr<MultiPolygon>
+    readMultiPolygon(const std::int32_t* geomOffsets, const std::int32_t* polygonOffsets,
+                     const std::int32_t* ringOffsets, std::size_t i) const
+    {
+        auto r = range(geomOffsets, i);
+        std::vector<std::unique_ptr<Polygon>> polys;
+        polys.reserve(r.second - r.first);
+        for (std::size_t j = r.first; j < r.second; j++) {
+            polys.push_back(readPolygon(polygonOffsets, ringOffsets, j));
+        }
+        return factory.createMultiPolygon(std::move(polys));
+    }
+
+private:
+    const GeometryFactory& factory;
+    const double* coordinates;
+    std::size_t numCoordinates;
+    std::size_t dimension;
+    std::shared_ptr<const void> coordinateOwner;
+
+    static std::pair<std::size_t, std::size_t>
+    range(const std::int32_t* offsets, std::size_t i,
+          std::size_t limit = std::numeric_limits<std::size_t>::max())
+    {
+        std::int32_t start = offsets[i];
+        std::int32_t end = offsets[i + 1];
+        if (start < 0 || end < start || static_cast<std::size_t>(end) > limit) {
+            throw util::IllegalArgumentException("GeoArrowReader: offset out of range");
+        }
+        return std::make_pair(static_cast<std::size_t>(start), static_cast<std::size_t>(end));
+    }
+
+    Coordinate
+    readCoordinate(std::size_t i) const
+    {
+        const double* p = coordinates + i * dimension;
+        if (dimension == 3) {
+            return Coordinate(p[0], p[1], p[2]);
+        }
+        return Coordinate(p[0], p[1]);
+    }
+
+    std::unique_ptr<CoordinateSequence>
+    readSequence(std::size_t start, std::size_t end) const
+    {
+        if (dimension == 3) {
+            const Coordinate* coords = reinterpret_cast<const Coordinate*>(coordinates) + start;
+            return detail::make_unique<ExternalCoordinateSequence>(coords, end - start, coordinateOwner);
+        }
+
+        std::vector<Coordinate> coords;
+        coords.reserve(end - start);
+        for (const double* p = coordinates + 2 * start; p < coordinates + 2 * end; p += 2) {
+            coords.emplace_back(p[0], p[1]);
+        }
+        return detail::make_unique<CoordinateArraySequence>(std::move(coords), 2u);
+    }
+
+    std::unique_ptr<LinearRing>
+    readRing(const std::int32_t* offsets, std::size_t i) const
+    {
+        auto r = range(offsets, i, numCoordinates);
+        return factory.createLinearRing(readSequence(r.first, r.second));
+    }
+};
+
+/// Number of offset buffers of an array of the given type
+std::size_t
+numOffsetBuffers(GeometryTypeId type)
+{
+    switch (type) {
+        case GEOS_POINT:
+            return 0;
+        case GEOS_LINESTRING:
+        case GEOS_MULTIPOINT:
+            return 1;
+        case GEOS_POLYGON:
+        case GEOS_MULTILINESTRING:
+            return 2;
+        case GEOS_MULTIPOLYGON:
+            return 3;
+        default:
+            throw util::IllegalArgumentException("GeoArrowReader: unsupported geometry type");
+    }
+}
+
+/**
+ * Checks that the buffers are present and that each offset buffer is
+ * non-decreasing and stays within the next buffer, so that the offsets
+ * can then be followed without bounds checks on the buffer sizes.
+ */
+void
+checkBuffers(GeometryTypeId type, const double* coords, std::size_t numCoords,
+             const std::int32_t* const* offsets, std::size_t numGeoms)
+{
+    std::size_t numBuffers = numOffsetBuffers(type);
+    if (numGeoms == 0) {
+        return;
+    }
+    if (coords == nullptr && numCoords > 0) {
+        throw util::IllegalArgumentException("GeoArrowReader: null coordinate buffer");
+    }
+    if (numBuffers > 0 && offsets == nullptr) {
+        throw util::IllegalArgumentException("GeoArrowReader: null offset buffers");
+    }
+
+    // number of elements indexed by the current buffer, which has n + 1 entries
+    std::size_t n = numGeoms;
+    for (std::size_t k = 0; k < numBuffers; k++) {
+        const std::int32_t* o = offsets[k];
+        if (o == nullptr) {
+            throw util::IllegalArgumentException("GeoArrowReader: null offset buffer");
+        }
+        if (o[0] < 0) {
+            throw util::IllegalArgumentException("GeoArrowReader: offset out of range");
+        }
+        for (std::size_t i = 0; i < n; i++) {
+            if (o[i + 1] < o[i]) {
+                throw util::IllegalArgumentException("GeoArrowReader: offsets are not increasing");
+            }
+        }
+        n = static_cast<std::size_t>(o[n]);
+    }
+
+    if (n > numCoords) {
+        throw util::IllegalArgumentException("GeoArrowReader: offset out of range");
+    }
+}
+
+} // anonymous namespace
+
+GeoArrowReader::GeoArrowReader() : GeoArrowReader(*(GeometryFactory::getDefaultInstance())) {}
+
+GeoArrowReader::GeoArrowReader(const geom::GeometryFactory& gf) : geometryFactory(gf) {}
+
+std::vector<std::unique_ptr<geom::Geometry>>
+GeoArrowReader::read(geom::GeometryTypeId type, const double* coords, std::size_t numCoords, bool hasZ,
+                     const std::int32_t* const* offsets, std::size_t numGeoms,
+                     std::shared_ptr<const void> owner) const
+{
+    checkBuffers(type, coords, numCoords, offsets, numGeoms);
+
+    GeoArrowArrayReader reader(geometryFactory, coords, numCoords, hasZ, std::move(owner));
+
+    std::vector<std::unique_ptr<Geometry>> geoms;
+    geoms.reserve(numGeoms);
+    for (std::size_t i = 0; i < numGeoms; i++) {
+        switch (type) {
+            case GEOS_POINT:
+                geoms.push_back(reader.readPoint(i));
+                break;
+            case GEOS_LINESTRING:
+                geoms.push_back(reader.readLineString(offsets[0], i));
+                break;
+            case GEOS_POLYGON:
+                geoms.push_back(reader.readPolygon(offsets[0], offsets[1], i));
+                break;
+            case GEOS_MULTIPOINT:
+                geoms.push_back(reader.readMultiPoint(offsets[0], i));
+                break;
+            case GEOS_MULTILINESTRING:
+                geoms.push_back(reader.readMultiLineString(offsets[0], offsets[1], i));
+                break;
+            case GEOS_MULTIPOLYGON:
+                geoms.push_back(reader.readMultiPolygon(offsets[0], offsets[1], offsets[2], i));
+                break;
+            default:
+                throw util::IllegalArgumentException("GeoArrowReader: unsupported geometry type");
+        }
+    }
+    return geoms;
+}
+
+} // namespace geos.io
+} // namespace geos
@@ -0,0 +1,301 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/io/GeoArrowWriter.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/Point.h>
+#include <geos/geom/Polygon.h>
+#include <geos/util/IllegalArgumentException.h>
+
+#include <limits>
+
+using namespace geos::geom;
+
+namespace geos {
+namespace io { // geos.io
+
+namespace {
+
+/*
+ * Writes geometries into GeoArrow buffers, or only counts the entries
+ * when measuring.
+ *
+ * items[k] is the number of items written at nesting level k: geometries
+ * at level 0, then parts and rings, and coordinates at the innermost
+ * level. Offset buffer k holds the number of items of level k + 1 at the
+ * start and after each item of level k.
+ */
+class GeoArrowArrayWriter {
+public:
+    GeoArrowArrayWriter(GeometryTypeId type, bool hasZ, std::size_t numBuffers,
+                        bool measureOnly, double* coordBuffer, std::int32_t* const* offsetBuffers,
+                        const GeoArrowWriter::Sizes& p_capacity)
+        : geometryType(type)
+        , dimension(hasZ ? 3u : 2u)
+        , numOffsetBuffers(numBuffers)
+        , measuring(measureOnly)
+        , coords(coordBuffer)
+        , offsets(offsetBuffers)
+        , capacity(p_capacity)
+        , items{0, 0, 0, 0}
+    {
+        for (std::size_t k = 0; k < numOffsetBuffers; k++) {
+            addOffset(k, 0);
+        }
+    }
+
+    void
+    write(const Geometry* g)
+    {
+        switch (geometryType) {
+            case GEOS_POINT:
+                writePoint(g);
+                break;
+            case GEOS_LINESTRING:
+                if (g) {
+                    writeSequence(*checkType<LineString>(g, GEOS_LINESTRING)->getCoordinatesRO());
+                }
+                endItem(0);
+                break;
+            case GEOS_POLYGON:
+                if (g) {
+                    writeRings(*checkType<Polygon>(g, GEOS_POLYGON), 1);
+                }
+                endItem(0);
+                break;
+            case GEOS_MULTIPOINT:
+                forEachPart(g, GEOS_POINT, GEOS_MULTIPOINT, [this](const Geometry* part) {
+                    writePoint(part);
+                });
+                endItem(0);
+                break;
+            case GEOS_MULTILINESTRING:
+                forEachPart(g, GEOS_LINESTRING, GEOS_MULTILINESTRING, [this](const Geometry* part) {
+                    writeSequence(*static_cast<const LineString*>(part)->getCoordinatesRO());
+                    endItem(1);
+                });
+                endItem(0);
+                break;
+            case GEOS_MULTIPOLYGON:
+                forEachPart(g, GEOS_POLYGON, GEOS_MULTIPOLYGON, [this](const Geometry* part) {
+                    writeRings(*static_cast<const Polygon*>(part), 2);
+                    endItem(1);
+                });
+                endItem(0);
+                break;
+            default:
+                throw util::IllegalArgumentException("GeoArrowWriter: unsupported geometry type");
+        }
+    }
+
+    GeoArrowWriter::Sizes
+    getSizes() const
+    {
+        GeoArrowWriter::Sizes sizes;
+        sizes.numCoords = items[numOffsetBuffers];
+        for (std::size_t k = 0; k < numOffsetBuffers; k++) {
+            sizes.numOffsets[k] = items[k] + 1;
+        }
+        return sizes;
+    }
+
+private:
+    GeometryTypeId geometryType;
+    std::size_t dimension;
+    std::size_t numOffsetBuffers;
+    bool measuring;
+    double* coords;
+    std::int32_t* const* offsets;
+    GeoArrowWriter::Sizes capacity;
+    std::size_t items[4];
+
+    static bool
+    isType(const Geometry* g, GeometryTypeId type)
+    {
+        GeometryTypeId id = g->getGeometryTypeId();
+        return id == type || (id == GEOS_LINEARRING && type == GEOS_LINESTRING);
+    }
+
+    template<typename T>
+    static const T*
+    checkType(const Geometry* g, GeometryTypeId type)
+    {
+        if (!isType(g, type)) {
+            throw util::IllegalArgumentException("GeoArrowWriter: cannot write " + g->getGeometryType()
+                                                 + " in this array");
+        }
+        return static_cast<const T*>(g);
+    }
+
+    // Visits the parts of a multi-geometry, or a non-empty single part geometry
+    template<typename F>
+    void
+    forEachPart(const Geometry* g, GeometryTypeId partType, GeometryTypeId multiType, F&& f)
+    {
+        if (!g) {
+            return;
+        }
+        if (isType(g, partType)) {
+            if (!g->isEmpty()) {
+                f(g);
+            }
+            return;
+        }
+        checkType<Geometry>(g, multiType);
+        for (std::size_t i = 0; i < g->getNumGeometries(); i++) {
+            f(checkType<Geometry>(g->getGeometryN(i), partType));
+        }
+    }
+
+    void
+    writePoint(const Geometry* g)
+    {
+        const Coordinate* c = g ? checkType<Point>(g, GEOS_POINT)->getCoordinate() : nullptr;
+        if (c) {
+            writeCoordinate(*c);
+        }
+        else {
+            const double nan = std::numeric_limits<double>::quiet_NaN();
+            writeCoordinate(Coordinate(nan, nan, nan));
+        }
+    }
+
+    void
+    writeRings(const Polygon& poly, std::size_t level)
+    {
+        if (poly.isEmpty()) {
+            return;
+        }
+        writeSequence(*poly.getExteriorRing()->getCoordinatesRO());
+        endItem(level);
+        for (std::size_t i = 0; i < poly.getNumInteriorRing(); i++) {
+            writeSequence(*poly.getInteriorRingN(i)->getCoordinatesRO());
+            endItem(level);
+        }
+    }
+
+    void
+    writeSequence(const CoordinateSequence& seq)
+    {
+        std::size_t n = seq.size();
+        std::size_t& numCoords = items[numOffsetBuffers];
+        if (!measuring) {
+            if (capacity.numCoords - numCoords < n) {
+                throw util::IllegalArgumentException("GeoArrowWriter: coordinate buffer too small");
+            }
+            double* p = coords + numCoords * dimension;
+            for (std::size_t i = 0; i < n; i++) {
+                const Coordinate& c = seq.getAt(i);
+                *p++ = c.x;
+                *p++ = c.y;
+                if (dimension == 3) {
+                    *p++ = c.z;
+                }
+            }
+        }
+        numCoords += n;
+    }
+
+    void
+    writeCoordinate(const Coordinate& c)
+    {
+        std::size_t& numCoords = items[numOffsetBuffers];
+        if (!measuring) {
+            if (numCoords == capacity.numCoords) {
+                throw util::IllegalArgumentException("GeoArrowWriter: coordinate buffer too small");
+            }
+            double* p = coords + numCoords * dimension;
+            p[0] = c.x;
+            p[1] = c.y;
+            if (dimension == 3) {
+                p[2] = c.z;
+            }
+        }
+        numCoords++;
+    }
+
+    void
+    endItem(std::size_t level)
+    {
+        items[level]++;
+        addOffset(level, items[level + 1]);
+    }
+
+    void
+    addOffset(std::size_t level, std::size_t value)
+    {
+        if (value > static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max())) {
+            throw util::IllegalArgumentException("GeoArrowWriter: offset exceeds 32 bits");
+        }
+        if (!measuring) {
+            std::size_t i = items[level];
+            if (i >= capacity.numOffsets[level]) {
+                throw util::IllegalArgumentException("GeoArrowWriter: offset buffer too small");
+            }
+            offsets[level][i] = static_cast<std::int32_t>(value);
+        }
+    }
+};
+
+} // anonymous namespace
+
+GeoArrowWriter::GeoArrowWriter(geom::GeometryTypeId type, bool p_includeZ)
+    : geometryType(type)
+    , includeZ(p_includeZ)
+{
+    switch (type) {
+        case GEOS_POINT:
+            numOffsetBuffers = 0;
+            break;
+        case GEOS_LINESTRING:
+        case GEOS_MULTIPOINT:
+            numOffsetBuffers = 1;
+            break;
+        case GEOS_POLYGON:
+        case GEOS_MULTILINESTRING:
+            numOffsetBuffers = 2;
+            break;
+        case GEOS_MULTIPOLYGON:
+            numOffsetBuffers = 3;
+            break;
+        default:
+            throw util::IllegalArgumentException("GeoArrowWriter: unsupported geometry type");
+    }
+}
+
+GeoArrowWriter::Sizes
+GeoArrowWriter::measure(const geom::Geometry* const* geoms, std::size_t numGeoms) const
+{
+    GeoArrowArrayWriter writer(geometryType, includeZ, numOffsetBuffers, true, nullptr, nullptr, Sizes());
+    for (std::size_t i = 0; i < numGeoms; i++) {
+        writer.write(geoms[i]);
+    }
+    return writer.getSizes();
+}
+
+GeoArrowWriter::Sizes
+GeoArrowWriter::write(const geom::Geometry* const* geoms, std::size_t numGeoms,
+                      double* coords, std::int32_t* const* offsets, const Sizes& capacity) const
+{
+    GeoArrowArrayWriter writer(geometryType, includeZ, numOffsetBuffers, false, coords, offsets, capacity);
+    for (std::size_t i = 0; i < numGeoms; i++) {
+        writer.write(geoms[i]);
+    }
+    return writer.getSizes();
+}
+
+} // namespace geos.io
+} // namespace geos
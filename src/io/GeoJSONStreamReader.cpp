@@ -0,0 +1,980 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/io/GeoJSONStreamReader.h>
+#include <geos/io/ParseException.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/CoordinateSequenceFactory.h>
+#include <geos/geom/GeometryCollection.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/MultiLineString.h>
+#include <geos/geom/MultiPoint.h>
+#include <geos/geom/MultiPolygon.h>
+#include <geos/geom/Point.h>
+#include <geos/geom/Polygon.h>
+#include "geos/vend/include_nlohmann_json.hpp"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace geos::geom;
+using json = geos_nlohmann::json;
+
+namespace geos {
+namespace io { // geos.io
+
+/**
+ * SAX handler building a feature from the parse events of a Feature
+ * or geometry object.
+ *
+ * Each object of the Feature or geometry structure (the top-level
+ * object, the geometry of a feature, the members of a GeometryCollection)
+ * gets a Frame. The members of a JSON object may come in any order, so
+ * coordinates are collected before the geometry type is known: positions
+ * are appended to a single array, and for each level of nested arrays
+ * the end offsets of the arrays into the next level are recorded. The
+ * geometry is created when its object is closed.
+ */
+class GeoJSONStreamReader::FeatureBuilder : public geos_nlohmann::json_sax<json> {
+public:
+
+    explicit FeatureBuilder(const GeometryFactory& gf)
+        : geometryFactory(gf)
+        , numFrames(0)
+        , level(0)
+        , skipDepth(0)
+        , complete(false)
+    {}
+
+    bool null() override;
+    bool boolean(bool val) override;
+    bool number_integer(std::int64_t val) override;
+    bool number_unsigned(std::uint64_t val) override;
+    bool number_float(double val, const std::string& s) override;
+    bool string(std::string& val) override;
+    bool binary(json::binary_t& val) override;
+    bool start_object(std::size_t elements) override;
+    bool key(std::string& val) override;
+    bool end_object() override;
+    bool start_array(std::size_t elements) override;
+    bool end_array() override;
+    bool parse_error(std::size_t position, const std::string& last_token,
+                     const geos_nlohmann::detail::exception& ex) override;
+
+    /// Whether the top-level object has been closed
+    bool isComplete() const
+    {
+        return complete;
+    }
+
+    /// The type member of the top-level object
+    const std::string& getType() const
+    {
+        return frames.front().type;
+    }
+
+    /**
+     * Take the feature read. If asFeature is false, the top-level object
+     * is read as a Feature or as a geometry depending on its type.
+     */
+    std::unique_ptr<GeoJSONFeature> takeFeature(bool asFeature);
+
+private:
+
+    enum class Context { OBJECT, COORDINATES, GEOMETRIES, PROPERTIES, SKIP };
+
+    enum class Member { OTHER, TYPE, COORDINATES, GEOMETRIES, GEOMETRY, PROPERTIES };
+
+    struct Frame {
+        std::string type;
+        Member member;
+        bool hasCoordinates;
+        bool hasGeometries;
+        int positionLevel;
+        std::vector<Coordinate> positions;
+        // ends[l][i]: number of arrays of level l + 1 up to the end of
+        // the i-th array of level l
+        std::vector<std::vector<std::size_t>> ends;
+        // closed[l]: number of arrays of level l closed so far
+        std::vector<std::size_t> closed;
+        std::vector<std::unique_ptr<Geometry>> geometries;
+        std::unique_ptr<Geometry> geometry;
+        std::map<std::string, GeoJSONValue> properties;
+
+        void reset();
+    };
+
+    struct PropertyContainer {
+        bool isObject;
+        std::string key;
+        std::map<std::string, GeoJSONValue> object;
+        std::vector<GeoJSONValue> array;
+    };
+
+    const GeometryFactory& geometryFactory;
+
+    std::vector<Context> contexts;
+    std::vector<Frame> frames;
+    std::size_t numFrames;
+
+    // coordinates being read
+    std::size_t level;
+    std::vector<bool> hasArrays;
+    std::vector<double> ordinates;
+
+    std::vector<PropertyContainer> propertyStack;
+    std::size_t skipDepth;
+    bool complete;
+
+    Frame& frame()
+    {
+        return frames[numFrames - 1];
+    }
+
+    Context context() const
+    {
+        if (contexts.empty()) {
+            throw ParseException("Expected a JSON object");
+        }
+        return contexts.back();
+    }
+
+    void pushFrame();
+    void popFrame();
+    void openCoordinateArray();
+    void closeCoordinateArray();
+    void addOrdinate(double d);
+    void addProperty(const GeoJSONValue& value);
+    void closePropertyContainer();
+    bool number(double d);
+    void skipValue();
+
+    static void unexpected(const char* what);
+
+    std::unique_ptr<Geometry> createGeometry(Frame& f) const;
+    std::unique_ptr<Point> createPoint(Frame& f) const;
+    std::unique_ptr<CoordinateSequence> createSequence(Frame& f, std::size_t from, std::size_t to) const;
+    std::unique_ptr<Polygon> createPolygon(Frame& f, std::size_t ringLevel,
+                                           std::size_t fromRing, std::size_t toRing) const;
+
+    static void checkCoordinates(const Frame& f, int positionLevel);
+    static std::size_t numArrays(const Frame& f, std::size_t lvl);
+    static std::size_t arrayEnd(const Frame& f, std::size_t lvl, std::size_t i);
+};
+
+void
+GeoJSONStreamReader::FeatureBuilder::Frame::reset()
+{
+    type.clear();
+    member = Member::OTHER;
+    hasCoordinates = false;
+    hasGeometries = false;
+    positionLevel = -1;
+    positions.clear();
+    ends.clear();
+    closed.clear();
+    geometries.clear();
+    geometry.reset();
+    properties.clear();
+}
+
+/* SAX events */
+
+bool
+GeoJSONStreamReader::FeatureBuilder::null()
+{
+    switch (context()) {
+    case Context::PROPERTIES:
+        addProperty(GeoJSONValue());
+        break;
+    case Context::OBJECT:
+        if (frame().member == Member::GEOMETRY) {
+            throw ParseException("Null feature geometries are not supported");
+        }
+        if (frame().member != Member::PROPERTIES && frame().member != Member::OTHER) {
+            unexpected("null");
+        }
+        break;
+    case Context::SKIP:
+        break;
+    default:
+        unexpected("null");
+    }
+    return true;
+}
+
+bool
+GeoJSONStreamReader::FeatureBuilder::boolean(bool val)
+{
+    switch (context()) {
+    case Context::PROPERTIES:
+        addProperty(GeoJSONValue(val));
+        break;
+    case Context::OBJECT:
+        if (frame().member != Member::OTHER) {
+            unexpected("boolean");
+        }
+        break;
+    case Context::SKIP:
+        break;
+    default:
+        unexpected("boolean");
+    }
+    return true;
+}
+
+bool
+GeoJSONStreamReader::FeatureBuilder::number_integer(std::int64_t val)
+{
+    return number(static_cast<double>(val));
+}
+
+bool
+GeoJSONStreamReader::FeatureBuilder::number_unsigned(std::uint64_t val)
+{
+    return number(static_cast<double>(val));
+}
+
+bool
+GeoJSONStreamReader::FeatureBuilder::number_float(double val, const std::string&)
+{
+    return number(val);
+}
+
+bool
+GeoJSONStreamReader::FeatureBuilder::number(double d)
+{
+    switch (context()) {
+    case Context::COORDINATES:
+        addOrdinate(d);
+        break;
+    case Context::PROPERTIES:
+        addProperty(GeoJSONValue(d));
+        break;
+    case Context::OBJECT:
+        if (frame().member != Member::OTHER) {
+            unexpected("number");
+        }
+        break;
+    case Context::SKIP:
+        break;
+    default:
+        unexpected("number");
+    }
+    return true;
+}
+
+bool
+GeoJSONStreamReader::FeatureBuilder::string(std::string& val)
+{
+    switch (context()) {
+    case Context::PROPERTIES:
+        addProperty(GeoJSONValue(val));
+        break;
+    case Context::OBJECT:
+        if (frame().member == Member::TYPE) {
+            frame().type = val;
+        }
+        else if (frame().member != Member::OTHER) {
+            unexpected("string");
+        }
+        break;
+    case Context::SKIP:
+        break;
+    default:
+        unexpected("string");
+    }
+    return true;
+}
+
+bool
+GeoJSONStreamReader::FeatureBuilder::binary(json::binary_t&)
+{
+    // not produced by the JSON parser
+    unexpected("binary value");
+    return false;
+}
+
+bool
+GeoJSONStreamReader::FeatureBuilder::start_object(std::size_t)
+{
+    if (contexts.empty()) {
+        numFrames = 0;
+        complete = false;
+        pushFrame();
+        return true;
+    }
+
+    switch (contexts.back()) {
+    case Context::OBJECT:
+        switch (frame().member) {
+        case Member::GEOMETRY:
+            pushFrame();
+            break;
+        case Member::PROPERTIES:
+            contexts.push_back(Context::PROPERTIES);
+            propertyStack.assign(1, PropertyContainer{true, {}, {}, {}});
+            break;
+        case Member::OTHER:
+            skipValue();
+            break;
+        default:
+            unexpected("object");
+        }
+        break;
+    case Context::GEOMETRIES:
+        pushFrame();
+        break;
+    case Context::PROPERTIES:
+        propertyStack.push_back(PropertyContainer{true, {}, {}, {}});
+        break;
+    case Context::SKIP:
+        skipDepth++;
+        break;
+    default:
+        unexpected("object");
+    }
+    return true;
+}
+
+bool
+GeoJSONStreamReader::FeatureBuilder::key(std::string& val)
+{
+    switch (context()) {
+    case Context::OBJECT: {
+        Member& m = frame().member;
+        if (val == "type") {
+            m = Member::TYPE;
+        }
+        else if (val == "coordinates") {
+            m = Member::COORDINATES;
+        }
+        else if (val == "geometries") {
+            m = Member::GEOMETRIES;
+        }
+        else if (val == "geometry") {
+            m = Member::GEOMETRY;
+        }
+        else if (val == "properties") {
+            m = Member::PROPERTIES;
+        }
+        else {
+            m = Member::OTHER;
+        }
+        break;
+    }
+    case Context::PROPERTIES:
+        propertyStack.back().key = val;
+        break;
+    default:
+        break;
+    }
+    return true;
+}
+
+bool
+GeoJSONStreamReader::FeatureBuilder::end_object()
+{
+    switch (context()) {
+    case Context::OBJECT:
+        popFrame();
+        break;
+    case Context::PROPERTIES:
+        closePropertyContainer();
+        break;
+    case Context::SKIP:
+        if (--skipDepth == 0) {
+            contexts.pop_back();
+        }
+        break;
+    default:
+        unexpected("end of object");
+    }
+    return true;
+}
+
+bool
+GeoJSONStreamReader::FeatureBuilder::start_array(std::size_t)
+{
+    switch (context()) {
+    case Context::OBJECT: {
+        Frame& f = frame();
+        switch (f.member) {
+        case Member::COORDINATES:
+            f.hasCoordinates = true;
+            f.positionLevel = -1;
+            f.positions.clear();
+            f.ends.clear();
+            f.closed.clear();
+            contexts.push_back(Context::COORDINATES);
+            openCoordinateArray();
+            break;
+        case Member::GEOMETRIES:
+            f.hasGeometries = true;
+            f.geometries.clear();
+            contexts.push_back(Context::GEOMETRIES);
+            break;
+        case Member::OTHER:
+            skipValue();
+            break;
+        default:
+            unexpected("array");
+        }
+        break;
+    }
+    case Context::COORDINATES:
+        openCoordinateArray();
+        break;
+    case Context::PROPERTIES:
+        propertyStack.push_back(PropertyContainer{false, {}, {}, {}});
+        break;
+    case Context::SKIP:
+        skipDepth++;
+        break;
+    default:
+        unexpected("array");
+    }
+    return true;
+}
+
+bool
+GeoJSONStreamReader::FeatureBuilder::end_array()
+{
+    switch (context()) {
+    case Context::COORDINATES:
+        closeCoordinateArray();
+        break;
+    case Context::GEOMETRIES:
+        contexts.pop_back();
+        break;
+    case Context::PROPERTIES:
+        closePropertyContainer();
+        break;
+    case Context::SKIP:
+        if (--skipDepth == 0) {
+            contexts.pop_back();
+        }
+        break;
+    default:
+        unexpected("end of array");
+    }
+    return true;
+}
+
+bool
+GeoJSONStreamReader::FeatureBuilder::parse_error(std::size_t, const std::string&,
+        const geos_nlohmann::detail::exception& ex)
+{
+    throw ParseException("Error parsing JSON", ex.what());
+}
+
+void
+GeoJSONStreamReader::FeatureBuilder::unexpected(const char* what)
+{
+    throw ParseException(std::string("Unexpected ") + what + " in GeoJSON object");
+}
+
+/* Objects */
+
+void
+GeoJSONStreamReader::FeatureBuilder::pushFrame()
+{
+    if (frames.size() == numFrames) {
+        frames.emplace_back();
+    }
+    frames[numFrames].reset();
+    numFrames++;
+    contexts.push_back(Context::OBJECT);
+}
+
+void
+GeoJSONStreamReader::FeatureBuilder::popFrame()
+{
+    contexts.pop_back();
+    if (numFrames == 1) {
+        // the top-level object is read by takeFeature()
+        complete = true;
+        return;
+    }
+
+    auto g = createGeometry(frame());
+    numFrames--;
+    if (contexts.back() == Context::GEOMETRIES) {
+        frame().geometries.push_back(std::move(g));
+    }
+    else {
+        frame().geometry = std::move(g);
+    }
+}
+
+void
+GeoJSONStreamReader::FeatureBuilder::skipValue()
+{
+    contexts.push_back(Context::SKIP);
+    skipDepth = 1;
+}
+
+std::unique_ptr<GeoJSONFeature>
+GeoJSONStreamReader::FeatureBuilder::takeFeature(bool asFeature)
+{
+    Frame& f = frames.front();
+    if (asFeature || f.type == "Feature") {
+        if (!f.geometry) {
+            throw ParseException("Missing feature geometry");
+        }
+        return std::unique_ptr<GeoJSONFeature>(new GeoJSONFeature(std::move(f.geometry), std::move(f.properties)));
+    }
+    return std::unique_ptr<GeoJSONFeature>(new GeoJSONFeature(createGeometry(f), std::map<std::string, GeoJSONValue>{}));
+}
+
+/* Properties */
+
+void
+GeoJSONStreamReader::FeatureBuilder::addProperty(const GeoJSONValue& value)
+{
+    PropertyContainer& c = propertyStack.back();
+    if (c.isObject) {
+        c.object[c.key] = value;
+    }
+    else {
+        c.array.push_back(value);
+    }
+}
+
+void
+GeoJSONStreamReader::FeatureBuilder::closePropertyContainer()
+{
+    PropertyContainer c = std::move(propertyStack.back());
+    propertyStack.pop_back();
+    if (propertyStack.empty()) {
+        frame().properties = std::move(c.object);
+        contexts.pop_back();
+    }
+    else if (c.isObject) {
+        addProperty(GeoJSONValue(c.object));
+    }
+    else {
+        addProperty(GeoJSONValue(c.array));
+    }
+}
+
+/* Coordinates */
+
+void
+GeoJSONStreamReader::FeatureBuilder::openCoordinateArray()
+{
+    if (!ordinates.empty()) {
+        throw ParseException("Expected a position, found an array");
+    }
+    if (level > 0) {
+        hasArrays[level - 1] = true;
+    }
+    if (hasArrays.size() <= level) {
+        hasArrays.resize(level + 1);
+    }
+    hasArrays[level] = false;
+    level++;
+}
+
+void
+GeoJSONStreamReader::FeatureBuilder::addOrdinate(double d)
+{
+    if (hasArrays[level - 1]) {
+        throw ParseException("Expected an array, found a number");
+    }
+    ordinates.push_back(d);
+}
+
+void
+GeoJSONStreamReader::FeatureBuilder::closeCoordinateArray()
+{
+    Frame& f = frame();
+    std::size_t lvl = level - 1;
+    if (f.closed.size() < lvl + 2) {
+        f.closed.resize(lvl + 2, 0);
+    }
+
+    if (!ordinates.empty()) {
+        if (f.positionLevel == -1) {
+            f.positionLevel = static_cast<int>(lvl);
+        }
+        else if (f.positionLevel != static_cast<int>(lvl)) {
+            throw ParseException("Inconsistent nesting of coordinates");
+        }
+        if (ordinates.size() == 1) {
+            throw ParseException("Expected two coordinates found one");
+        }
+        else if (ordinates.size() > 2) {
+            throw ParseException("Expected two coordinates found more than two");
+        }
+        f.positions.emplace_back(ordinates[0], ordinates[1]);
+        ordinates.clear();
+    }
+    else {
+        if (f.ends.size() <= lvl) {
+            f.ends.resize(lvl + 1);
+        }
+        f.ends[lvl].push_back(f.closed[lvl + 1]);
+    }
+    f.closed[lvl]++;
+
+    level--;
+    if (level == 0) {
+        contexts.pop_back();
+    }
+}
+
+void
+GeoJSONStreamReader::FeatureBuilder::checkCoordinates(const Frame& f, int positionLevel)
+{
+    if (!f.hasCoordinates) {
+        throw ParseException("Missing coordinates");
+    }
+    if ((f.positionLevel != -1 && f.positionLevel != positionLevel) ||
+            f.ends.size() > static_cast<std::size_t>(positionLevel)) {
+        throw ParseException("Unexpected nesting of coordinates for " + f.type);
+    }
+}
+
+std::size_t
+GeoJSONStreamReader::FeatureBuilder::numArrays(const Frame& f, std::size_t lvl)
+{
+    return lvl < f.closed.size() ? f.closed[lvl] : 0;
+}
+
+std::size_t
+GeoJSONStreamReader::FeatureBuilder::arrayEnd(const Frame& f, std::size_t lvl, std::size_t i)
+{
+    return f.ends[lvl][i];
+}
+
+/* Geometries */
+
+std::unique_ptr<Geometry>
+GeoJSONStreamReader::FeatureBuilder::createGeometry(Frame& f) const
+{
+    const std::string& type = f.type;
+    if (type == "Point") {
+        return createPoint(f);
+    }
+    else if (type == "LineString") {
+        checkCoordinates(f, 1);
+        return geometryFactory.createLineString(createSequence(f, 0, f.positions.size()));
+    }
+    else if (type == "Polygon") {
+        checkCoordinates(f, 2);
+        return createPolygon(f, 1, 0, numArrays(f, 1));
+    }
+    else if (type == "MultiPoint") {
+        checkCoordinates(f, 1);
+        std::vector<std::unique_ptr<Point>> points;
+        points.reserve(f.positions.size());
+        for (const auto& c : f.positions) {
+            points.emplace_back(geometryFactory.createPoint(c));
+        }
+        return geometryFactory.createMultiPoint(std::move(points));
+    }
+    else if (type == "MultiLineString") {
+        checkCoordinates(f, 2);
+        std::size_t numLines = numArrays(f, 1);
+        std::vector<std::unique_ptr<LineString>> lines;
+        lines.reserve(numLines);
+        for (std::size_t i = 0; i < numLines; i++) {
+            std::size_t from = i == 0 ? 0 : arrayEnd(f, 1, i - 1);
+            lines.push_back(geometryFactory.createLineString(createSequence(f, from, arrayEnd(f, 1, i))));
+        }
+        return geometryFactory.createMultiLineString(std::move(lines));
+    }
+    else if (type == "MultiPolygon") {
+        checkCoordinates(f, 3);
+        std::size_t numPolygons = numArrays(f, 1);
+        std::vector<std::unique_ptr<Polygon>> polygons;
+        polygons.reserve(numPolygons);
+        for (std::size_t i = 0; i < numPolygons; i++) {
+            std::size_t from = i == 0 ? 0 : arrayEnd(f, 1, i - 1);
+            polygons.push_back(createPolygon(f, 2, from, arrayEnd(f, 1, i)));
+        }
+        return geometryFactory.createMultiPolygon(std::move(polygons));
+    }
+    else if (type == "GeometryCollection") {
+        if (!f.hasGeometries) {
+            throw ParseException("Missing geometries");
+        }
+        return geometryFactory.createGeometryCollection(std::move(f.geometries));
+    }
+    else {
+        throw ParseException{"Unknown geometry type!"};
+    }
+}
+
+std::unique_ptr<Point>
+GeoJSONStreamReader::FeatureBuilder::createPoint(Frame& f) const
+{
+    if (!f.hasCoordinates) {
+        throw ParseException("Missing coordinates");
+    }
+    if (f.positionLevel == 0) {
+        return std::unique_ptr<Point>(geometryFactory.createPoint(f.positions.front()));
+    }
+    // an empty array
+    if (f.positionLevel == -1 && numArrays(f, 1) == 0) {
+        return geometryFactory.createPoint(2);
+    }
+    throw ParseException("Unexpected nesting of coordinates for Point");
+}
+
+std::unique_ptr<CoordinateSequence>
+GeoJSONStreamReader::FeatureBuilder::createSequence(Frame& f, std::size_t from, std::size_t to) const
+{
+    const auto& csf = geometryFactory.getCoordinateSequenceFactory();
+    if (from == 0 && to == f.positions.size()) {
+        return csf->create(std::move(f.positions));
+    }
+    std::vector<Coordinate> coordinates(f.positions.begin() + static_cast<std::ptrdiff_t>(from),
+                                        f.positions.begin() + static_cast<std::ptrdiff_t>(to));
+    return csf->create(std::move(coordinates));
+}
+
+std::unique_ptr<Polygon>
+GeoJSONStreamReader::FeatureBuilder::createPolygon(Frame& f, std::size_t ringLevel,
+        std::size_t fromRing, std::size_t toRing) const
+{
+    if (fromRing == toRing) {
+        return geometryFactory.createPolygon(2);
+    }
+
+    std::unique_ptr<LinearRing> shell;
+    std::vector<std::unique_ptr<LinearRing>> holes;
+    holes.reserve(toRing - fromRing - 1);
+    for (std::size_t i = fromRing; i < toRing; i++) {
+        std::size_t from = i == 0 ? 0 : arrayEnd(f, ringLevel, i - 1);
+        auto ring = geometryFactory.createLinearRing(createSequence(f, from, arrayEnd(f, ringLevel, i)));
+        if (!shell) {
+            shell = std::move(ring);
+        }
+        else {
+            holes.push_back(std::move(ring));
+        }
+    }
+    if (holes.empty()) {
+        return geometryFactory.createPolygon(std::move(shell));
+    }
+    return geometryFactory.createPolygon(std::move(shell), std::move(holes));
+}
+
+/* GeoJSONStreamReader */
+
+GeoJSONStreamReader::GeoJSONStreamReader(std::istream& p_instr)
+    : GeoJSONStreamReader(p_instr, *(GeometryFactory::getDefaultInstance()))
+{}
+
+GeoJSONStreamReader::GeoJSONStreamReader(std::istream& p_instr, const GeometryFactory& gf)
+    : instr(p_instr)
+    , rootBuilder(new FeatureBuilder(gf))
+    , featureBuilder(new FeatureBuilder(gf))
+    , state(State::START)
+    , firstItem(true)
+    , hasFeatures(false)
+{}
+
+GeoJSONStreamReader::~GeoJSONStreamReader() = default;
+
+std::unique_ptr<GeoJSONFeature>
+GeoJSONStreamReader::next()
+{
+    try {
+        if (state == State::START) {
+            readStart();
+        }
+        while (state != State::END) {
+            if (state == State::FEATURES) {
+                if (!readSeparator(']')) {
+                    return readFeature();
+                }
+                state = State::MEMBERS;
+            }
+            else if (readSeparator('}')) {
+                return readEnd();
+            }
+            else {
+                readMember();
+            }
+        }
+        return nullptr;
+    }
+    catch (json::exception& ex) {
+        state = State::END;
+        throw ParseException("Error parsing JSON", ex.what());
+    }
+    catch (...) {
+        state = State::END;
+        throw;
+    }
+}
+
+void
+GeoJSONStreamReader::readStart()
+{
+    // UTF-8 byte order mark
+    if (skipWhitespace() == 0xEF) {
+        for (int i = 0; i < 3; i++) {
+            instr.get();
+        }
+    }
+    expect('{');
+    std::size_t elements = 0;
+    rootBuilder->start_object(elements);
+    state = State::MEMBERS;
+    firstItem = true;
+}
+
+bool
+GeoJSONStreamReader::readSeparator(char closer)
+{
+    if (skipWhitespace() == closer) {
+        instr.get();
+        firstItem = false;
+        return true;
+    }
+    if (!firstItem) {
+        expect(',');
+    }
+    firstItem = false;
+    return false;
+}
+
+void
+GeoJSONStreamReader::readMember()
+{
+    std::string key = readKey();
+    expect(':');
+    if (key == "features") {
+        expect('[');
+        state = State::FEATURES;
+        firstItem = true;
+        hasFeatures = true;
+        return;
+    }
+
+    rootBuilder->key(key);
+    int c = skipWhitespace();
+    if (c == '-' || (c >= '0' && c <= '9')) {
+        // the parser would consume the character after the number
+        skipNumber();
+        rootBuilder->number_float(0, std::string());
+    }
+    else {
+        json::sax_parse(instr, rootBuilder.get(), json::input_format_t::json, false);
+    }
+}
+
+std::unique_ptr<GeoJSONFeature>
+GeoJSONStreamReader::readFeature()
+{
+    int c = skipWhitespace();
+    if (c != '{') {
+        throw ParseException("Expected a Feature object");
+    }
+    json::sax_parse(instr, featureBuilder.get(), json::input_format_t::json, false);
+    return featureBuilder->takeFeature(true);
+}
+
+std::unique_ptr<GeoJSONFeature>
+GeoJSONStreamReader::readEnd()
+{
+    state = State::END;
+    rootBuilder->end_object();
+    if (skipWhitespace() != std::char_traits<char>::eof()) {
+        throw ParseException("Unexpected text after GeoJSON object");
+    }
+    if (hasFeatures) {
+        return nullptr;
+    }
+    if (rootBuilder->getType() == "FeatureCollection") {
+        throw ParseException("Missing features");
+    }
+    return rootBuilder->takeFeature(false);
+}
+
+int
+GeoJSONStreamReader::skipWhitespace()
+{
+    int c = instr.peek();
+    while (c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+        instr.get();
+        c = instr.peek();
+    }
+    return c;
+}
+
+void
+GeoJSONStreamReader::expect(char c)
+{
+    if (skipWhitespace() != c) {
+        throw ParseException(std::string("Expected '") + c + "' in GeoJSON text");
+    }
+    instr.get();
+}
+
+std::string
+GeoJSONStreamReader::readKey()
+{
+    if (skipWhitespace() != '"') {
+        throw ParseException("Expected a member name in GeoJSON text");
+    }
+    instr.get();
+
+    std::string key;
+    bool escaped = false;
+    for (;;) {
+        int c = instr.get();
+        if (c == '\\') {
+            escaped = true;
+            key.push_back(static_cast<char>(c));
+            c = instr.get();
+        }
+        else if (c == '"') {
+            break;
+        }
+        if (c == std::char_traits<char>::eof()) {
+            throw ParseException("Unterminated member name in GeoJSON text");
+        }
+        key.push_back(static_cast<char>(c));
+    }
+    if (escaped) {
+        key = json::parse("\"" + key + "\"").get<std::string>();
+    }
+    return key;
+}
+
+void
+GeoJSONStreamReader::skipNumber()
+{
+    for (;;) {
+        int c = instr.peek();
+        if ((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E') {
+            instr.get();
+        }
+        else {
+            return;
+        }
+    }
+}
+
+} // namespace geos.io
+} // namespace geos
@@ -0,0 +1,89 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/io/GeoJSONStreamWriter.h>
+#include <geos/util/GEOSException.h>
+
+#include <string>
+
+namespace geos {
+namespace io { // geos.io
+
+GeoJSONStreamWriter::GeoJSONStreamWriter(std::ostream& p_os, const GeoJSONWriter& writer)
+    : os(p_os)
+    , featureWriter(writer)
+    , numFeatures(0)
+    , finished(false)
+{
+    buffer.reserve(FLUSH_SIZE * 2);
+    buffer.write("{\"type\":\"FeatureCollection\",\"features\":[");
+}
+
+void
+GeoJSONStreamWriter::write(const GeoJSONFeature& feature)
+{
+    beginFeature();
+    featureWriter.write(feature, &buffer);
+    endFeature();
+}
+
+void
+GeoJSONStreamWriter::write(const geom::Geometry* geometry)
+{
+    beginFeature();
+    featureWriter.write(geometry, &buffer, GeoJSONType::FEATURE);
+    endFeature();
+}
+
+void
+GeoJSONStreamWriter::finish()
+{
+    if (finished) {
+        return;
+    }
+    buffer.write("]}");
+    flush();
+    finished = true;
+}
+
+void
+GeoJSONStreamWriter::beginFeature()
+{
+    if (finished) {
+        throw util::GEOSException("GeoJSONStreamWriter: feature written after finish()");
+    }
+    if (numFeatures > 0) {
+        buffer.write(',');
+    }
+}
+
+void
+GeoJSONStreamWriter::endFeature()
+{
+    numFeatures++;
+    if (buffer.getLength() >= FLUSH_SIZE) {
+        flush();
+    }
+}
+
+void
+GeoJSONStreamWriter::flush()
+{
+    const std::string& text = buffer.toString();
+    os.write(text.data(), static_cast<std::streamsize>(text.size()));
+    buffer.clear();
+}
+
+} // namespace geos.io
+} // namespace geos
@@ -13,6 +13,7 @@
  **********************************************************************/
 
 #include <geos/io/GeoJSONWriter.h>
+#include <geos/io/Writer.h>
 #include <geos/util/IllegalArgumentException.h>
 #include <geos/geom/Coordinate.h>
 #include <geos/geom/Point.h>
@@ -23,282 +24,463 @@
 #include <geos/geom/MultiLineString.h>
 #include <geos/geom/MultiPolygon.h>
 #include <geos/geom/CoordinateSequence.h>
-#include <geos/geom/CoordinateArraySequence.h>
-#include <geos/geom/PrecisionModel.h>
+#include "geos/vend/include_nlohmann_json.hpp"
 
-#include <algorithm>
-#include <ostream>
-#include <sstream>
-#include <cassert>
+#include <ryu/ryu.h>
 
-#define GEOS_COMPILATION
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
 
 using namespace geos::geom;
-using json = geos_nlohmann::ordered_json;
 
 namespace geos {
 namespace io { // geos.io
 
-std::string GeoJSONWriter::write(const geom::Geometry* geometry, GeoJSONType type)
-{
-    json j;
-    encode(geometry, type, j);
-    return j.dump();
-}
+namespace {
 
-std::string GeoJSONWriter::writeFormatted(const geom::Geometry* geometry, GeoJSONType type, int indent)
-{
-    json j;
-    encode(geometry, type, j);
-    return j.dump(indent);
-}
+/*
+ * Writes JSON text into a Writer. Follows the layout of the
+ * nlohmann json dump(), which GeoJSONWriter used to serialize with,
+ * so that the output is unchanged.
+ */
+class JsonEncoder {
+public:
+    // A negative indent writes compact text
+    JsonEncoder(Writer& p_writer, int p_indent, int p_decimalPlaces)
+        : writer(p_writer)
+        , indent(p_indent)
+        , decimalPlaces(p_decimalPlaces)
+    {}
 
-std::string GeoJSONWriter::write(const GeoJSONFeature& feature)
-{
-    json j;
-    encodeFeature(feature, j);
-    return j.dump();
-}
+    void beginObject()
+    {
+        writer.write('{');
+        first.push_back(true);
+    }
 
-void GeoJSONWriter::encodeGeoJSONValue(const std::string& key, const GeoJSONValue& value,
-                                       geos_nlohmann::ordered_json& j)
-{
-    if (value.isNumber()) {
-        if (j.is_object()) {
-            j[key] = value.getNumber();
-        }
-        else {
-            j.push_back(value.getNumber());
-        }
+    void endObject()
+    {
+        endContainer();
+        writer.write('}');
     }
-    else if (value.isString()) {
-        if (j.is_object()) {
-            j[key] = value.getString();
-        }
-        else {
-            j.push_back(value.getString());
+
+    void beginArray()
+    {
+        writer.write('[');
+        first.push_back(true);
+    }
+
+    void endArray()
+    {
+        endContainer();
+        writer.write(']');
+    }
+
+    /// Starts an object member, to be followed by its value
+    void key(const std::string& name)
+    {
+        element();
+        string(name);
+        writer.write(':');
+        if (indent >= 0) {
+            writer.write(' ');
         }
     }
-    else if (value.isBoolean()) {
-        if (j.is_object()) {
-            j[key] = value.getBoolean();
+
+    /// Starts an array element
+    void element()
+    {
+        if (!first.back()) {
+            writer.write(',');
         }
-        else {
-            j.push_back(value.getBoolean());
+        first.back() = false;
+        if (indent >= 0) {
+            newLine(first.size());
         }
     }
-    else if (value.isNull()) {
-        if (j.is_object()) {
-            j[key] = nullptr;
+
+    void string(const std::string& s);
+
+    void number(double d);
+
+    void literal(const char* s)
+    {
+        writer.write(s);
+    }
+
+    void coordinate(const Coordinate& c)
+    {
+        if (indent >= 0) {
+            beginArray();
+            element();
+            coordinateNumber(c.x);
+            element();
+            coordinateNumber(c.y);
+            endArray();
         }
         else {
-            j.push_back(nullptr);
+            writer.write('[');
+            coordinateNumber(c.x);
+            writer.write(',');
+            coordinateNumber(c.y);
+            writer.write(']');
         }
     }
-    else if (value.isArray()) {
-        j[key] = json::array();
-        for (const GeoJSONValue& v : value.getArray()) {
-            encodeGeoJSONValue("", v, j[key]);
+
+    void coordinates(const CoordinateSequence& seq)
+    {
+        beginArray();
+        for (std::size_t i = 0; i < seq.size(); i++) {
+            element();
+            coordinate(seq.getAt(i));
         }
+        endArray();
     }
-    else if (value.isObject()) {
-        j[key] = json::object();
-        for (const auto& entry : value.getObject()) {
-            encodeGeoJSONValue(entry.first, entry.second, j[key]);
+
+private:
+    Writer& writer;
+    int indent;
+    int decimalPlaces;
+    // whether the containers being written have no element yet
+    std::vector<bool> first;
+
+    void endContainer()
+    {
+        if (indent >= 0 && !first.back()) {
+            newLine(first.size() - 1);
         }
+        first.pop_back();
     }
-}
 
-std::string GeoJSONWriter::write(const GeoJSONFeatureCollection& features)
+    void newLine(std::size_t level)
+    {
+        std::size_t n = level * static_cast<std::size_t>(indent);
+        char* buf = writer.prepare(n + 1);
+        buf[0] = '\n';
+        std::memset(buf + 1, ' ', n);
+        writer.commit(n + 1);
+    }
+
+    void coordinateNumber(double d);
+};
+
+void
+JsonEncoder::string(const std::string& s)
 {
-    json j;
-    j["type"] = "FeatureCollection";
-    json featuresJson = json::array();
-    for (auto const& feature : features.getFeatures()) {
-        json featureJson;
-        encodeFeature(feature, featureJson);
-        featuresJson.push_back(featureJson);
+    static const char* hex = "0123456789abcdef";
+
+    writer.write('"');
+    const char* p = s.data();
+    const char* end = p + s.size();
+    const char* run = p;
+    for (; p != end; ++p) {
+        unsigned char c = static_cast<unsigned char>(*p);
+        if (c >= 0x20 && c != '"' && c != '\\') {
+            continue;
+        }
+        writer.write(run, static_cast<std::size_t>(p - run));
+        run = p + 1;
+        switch (c) {
+        case '"':  writer.write("\\\"", 2); break;
+        case '\\': writer.write("\\\\", 2); break;
+        case '\b': writer.write("\\b", 2); break;
+        case '\f': writer.write("\\f", 2); break;
+        case '\n': writer.write("\\n", 2); break;
+        case '\r': writer.write("\\r", 2); break;
+        case '\t': writer.write("\\t", 2); break;
+        default: {
+            char esc[6] = { '\\', 'u', '0', '0', hex[c >> 4], hex[c & 0xF] };
+            writer.write(esc, 6);
+        }
+        }
     }
-    j["features"] = featuresJson;
-    return j.dump();
+    writer.write(run, static_cast<std::size_t>(end - run));
+    writer.write('"');
 }
 
-void GeoJSONWriter::encodeFeature(const GeoJSONFeature& feature, geos_nlohmann::ordered_json& j)
+void
+JsonEncoder::number(double d)
 {
-    j["type"] = "Feature";
-    json geometryJson;
-    encodeGeometry(feature.getGeometry(), geometryJson);
-    j["geometry"] = geometryJson;
-    json propertiesJson = json::object();
-    for (auto const& property : feature.getProperties()) {
-        std::string key = property.first;
-        GeoJSONValue value = property.second;
-        encodeGeoJSONValue(key, value, propertiesJson);
+    if (!std::isfinite(d)) {
+        writer.write("null", 4);
+        return;
     }
-    j["properties"] = propertiesJson;
+    // shortest representation that round trips, as written by nlohmann json
+    char* buf = writer.prepare(32);
+    char* end = geos_nlohmann::detail::to_chars(buf, buf + 32, d);
+    writer.commit(static_cast<std::size_t>(end - buf));
 }
 
-void GeoJSONWriter::encode(const geom::Geometry* geometry, GeoJSONType geojsonType, geos_nlohmann::ordered_json& j)
+void
+JsonEncoder::coordinateNumber(double d)
 {
-    if (geojsonType == GeoJSONType::GEOMETRY) {
-        encodeGeometry(geometry, j);
-    }
-    else if (geojsonType == GeoJSONType::FEATURE) {
-        encodeFeature(geometry, j);
+    // ryu fixed notation is limited to numbers below 1e17
+    if (decimalPlaces < 0 || !(std::fabs(d) < 1e17)) {
+        number(d);
+        return;
     }
-    else if (geojsonType == GeoJSONType::FEATURE_COLLECTION) {
-        encodeFeatureCollection(geometry, j);
+    std::uint32_t precision = static_cast<std::uint32_t>(decimalPlaces);
+    // sign, 17 integer digits, point and decimals, or ".0"
+    char* buf = writer.prepare(21 + precision);
+    std::size_t len = static_cast<std::size_t>(geos_d2sfixed_buffered_n(d, precision, buf));
+    // integral values keep a decimal part, as in number()
+    if (std::memchr(buf, '.', len) == nullptr) {
+        buf[len++] = '.';
+        buf[len++] = '0';
     }
+    writer.commit(len);
 }
 
-void GeoJSONWriter::encodeFeature(const geom::Geometry* g, geos_nlohmann::ordered_json& j)
+void encodeGeometry(const Geometry* geometry, JsonEncoder& out);
+
+void
+encodePolygonRings(const Polygon* poly, JsonEncoder& out)
 {
-    json geometryJson;
-    encodeGeometry(g, geometryJson);
-    j["type"] = "Feature";
-    j["geometry"] = geometryJson;
+    out.beginArray();
+    out.element();
+    out.coordinates(*poly->getExteriorRing()->getCoordinatesRO());
+    for (std::size_t i = 0; i < poly->getNumInteriorRing(); i++) {
+        out.element();
+        out.coordinates(*poly->getInteriorRingN(i)->getCoordinatesRO());
+    }
+    out.endArray();
 }
 
-void GeoJSONWriter::encodeFeatureCollection(const geom::Geometry* g, geos_nlohmann::ordered_json& j)
+void
+encodeGeometry(const Geometry* geometry, JsonEncoder& out)
 {
-    json featureJson;
-    encodeFeature(g, featureJson);
-    std::vector<json> features;
-    features.push_back(featureJson);
-    j["type"] = "FeatureCollection";
-    j["features"] = features;
+    if (geometry == nullptr) {
+        out.literal("null");
+        return;
+    }
+
+    out.beginObject();
+    out.key("type");
+    switch (geometry->getGeometryTypeId()) {
+    case GEOS_POINT: {
+        auto point = static_cast<const Point*>(geometry);
+        out.string("Point");
+        out.key("coordinates");
+        if (point->isEmpty()) {
+            out.beginArray();
+            out.endArray();
+        }
+        else {
+            out.coordinate(*point->getCoordinate());
+        }
+        break;
+    }
+    case GEOS_LINESTRING:
+    case GEOS_LINEARRING:
+        out.string("LineString");
+        out.key("coordinates");
+        out.coordinates(*static_cast<const LineString*>(geometry)->getCoordinatesRO());
+        break;
+    case GEOS_POLYGON:
+        out.string("Polygon");
+        out.key("coordinates");
+        encodePolygonRings(static_cast<const Polygon*>(geometry), out);
+        break;
+    case GEOS_MULTIPOINT:
+        out.string("MultiPoint");
+        out.key("coordinates");
+        out.beginArray();
+        for (std::size_t i = 0; i < geometry->getNumGeometries(); i++) {
+            auto point = static_cast<const Point*>(geometry->getGeometryN(i));
+            if (!point->isEmpty()) {
+                out.element();
+                out.coordinate(*point->getCoordinate());
+            }
+        }
+        out.endArray();
+        break;
+    case GEOS_MULTILINESTRING:
+        out.string("MultiLineString");
+        out.key("coordinates");
+        out.beginArray();
+        for (std::size_t i = 0; i < geometry->getNumGeometries(); i++) {
+            out.element();
+            out.coordinates(*static_cast<const LineString*>(geometry->getGeometryN(i))->getCoordinatesRO());
+        }
+        out.endArray();
+        break;
+    case GEOS_MULTIPOLYGON:
+        out.string("MultiPolygon");
+        out.key("coordinates");
+        out.beginArray();
+        for (std::size_t i = 0; i < geometry->getNumGeometries(); i++) {
+            out.element();
+            encodePolygonRings(static_cast<const Polygon*>(geometry->getGeometryN(i)), out);
+        }
+        out.endArray();
+        break;
+    case GEOS_GEOMETRYCOLLECTION:
+        out.string("GeometryCollection");
+        out.key("geometries");
+        out.beginArray();
+        for (std::size_t i = 0; i < geometry->getNumGeometries(); i++) {
+            out.element();
+            encodeGeometry(geometry->getGeometryN(i), out);
+        }
+        out.endArray();
+        break;
+    }
+    out.endObject();
 }
 
-void GeoJSONWriter::encodeGeometry(const geom::Geometry* geometry, geos_nlohmann::ordered_json& j)
+void
+encodeGeoJSONValue(const GeoJSONValue& value, JsonEncoder& out)
 {
-    auto type = geometry->getGeometryTypeId();
-    if (type == GEOS_POINT) {
-        auto point = static_cast<const geom::Point*>(geometry);
-        encodePoint(point, j);
-    }
-    else if (type == GEOS_LINESTRING) {
-        auto line = static_cast<const geom::LineString*>(geometry);
-        encodeLineString(line, j);
+    if (value.isNumber()) {
+        out.number(value.getNumber());
     }
-    else if (type == GEOS_LINEARRING) {
-        auto line = static_cast<const geom::LineString*>(geometry);
-        encodeLineString(line, j);
+    else if (value.isString()) {
+        out.string(value.getString());
     }
-    else if (type == GEOS_POLYGON) {
-        auto poly = static_cast<const geom::Polygon*>(geometry);
-        encodePolygon(poly, j);
+    else if (value.isBoolean()) {
+        out.literal(value.getBoolean() ? "true" : "false");
     }
-    else if (type == GEOS_MULTIPOINT) {
-        auto multiPoint = static_cast<const geom::MultiPoint*>(geometry);
-        encodeMultiPoint(multiPoint, j);
+    else if (value.isNull()) {
+        out.literal("null");
     }
-    else if (type == GEOS_MULTILINESTRING) {
-        auto multiLineString = static_cast<const geom::MultiLineString*>(geometry);
-        encodeMultiLineString(multiLineString, j);
+    else if (value.isArray()) {
+        out.beginArray();
+        for (const GeoJSONValue& v : value.getArray()) {
+            out.element();
+            encodeGeoJSONValue(v, out);
+        }
+        out.endArray();
     }
-    else if (type == GEOS_MULTIPOLYGON) {
-        auto multiPolygon = static_cast<const geom::MultiPolygon*>(geometry);
-        encodeMultiPolygon(multiPolygon, j);
+    else if (value.isObject()) {
+        out.beginObject();
+        for (const auto& entry : value.getObject()) {
+            out.key(entry.first);
+            encodeGeoJSONValue(entry.second, out);
+        }
+        out.endObject();
     }
-    else if (type == GEOS_GEOMETRYCOLLECTION) {
-        auto geometryCollection = static_cast<const geom::GeometryCollection*>(geometry);
-        encodeGeometryCollection(geometryCollection, j);
+}
+
+void
+encodeFeature(const GeoJSONFeature& feature, JsonEncoder& out)
+{
+    out.beginObject();
+    out.key("type");
+    out.string("Feature");
+    out.key("geometry");
+    encodeGeometry(feature.getGeometry(), out);
+    out.key("properties");
+    out.beginObject();
+    for (const auto& property : feature.getProperties()) {
+        out.key(property.first);
+        encodeGeoJSONValue(property.second, out);
     }
+    out.endObject();
+    out.endObject();
 }
 
-void GeoJSONWriter::encodePoint(const geom::Point* point, geos_nlohmann::ordered_json& j)
+void
+encodeFeature(const Geometry* geometry, JsonEncoder& out)
 {
-    j["type"] = "Point";
-    if (!point->isEmpty()) {
-        j["coordinates"] = convertCoordinate(point->getCoordinate());
+    out.beginObject();
+    out.key("type");
+    out.string("Feature");
+    out.key("geometry");
+    encodeGeometry(geometry, out);
+    out.endObject();
+}
+
+void
+encode(const Geometry* geometry, GeoJSONType type, JsonEncoder& out)
+{
+    if (type == GeoJSONType::GEOMETRY) {
+        encodeGeometry(geometry, out);
+    }
+    else if (type == GeoJSONType::FEATURE) {
+        encodeFeature(geometry, out);
     }
-    else {
-        j["coordinates"] = j.array();
+    else if (type == GeoJSONType::FEATURE_COLLECTION) {
+        out.beginObject();
+        out.key("type");
+        out.string("FeatureCollection");
+        out.key("features");
+        out.beginArray();
+        out.element();
+        encodeFeature(geometry, out);
+        out.endArray();
+        out.endObject();
     }
 }
 
-void GeoJSONWriter::encodeLineString(const geom::LineString* line, geos_nlohmann::ordered_json& j)
+} // anonymous namespace
+
+GeoJSONWriter::GeoJSONWriter()
+    : decimalPlaces(-1)
+{}
+
+void
+GeoJSONWriter::setRoundingPrecision(int decimals)
 {
-    j["type"] = "LineString";
-    j["coordinates"] = convertCoordinateSequence(line->getCoordinates().get());
+    decimalPlaces = decimals < 0 ? -1 : decimals;
 }
 
-void GeoJSONWriter::encodePolygon(const geom::Polygon* poly, geos_nlohmann::ordered_json& j)
+std::string GeoJSONWriter::write(const geom::Geometry* geometry, GeoJSONType type)
 {
-    j["type"] = "Polygon";
-    std::vector<std::vector<std::pair<double, double>>> rings;
-    auto ring = poly->getExteriorRing();
-    rings.reserve(poly->getNumInteriorRing()+1);
-    rings.push_back(convertCoordinateSequence(ring->getCoordinates().get()));
-    for (size_t i = 0; i < poly->getNumInteriorRing(); i++) {
-        rings.push_back(convertCoordinateSequence(poly->getInteriorRingN(i)->getCoordinates().get()));
-    }
-    j["coordinates"] = rings;
+    Writer writer;
+    write(geometry, &writer, type);
+    return writer.toString();
 }
 
-void GeoJSONWriter::encodeMultiPoint(const geom::MultiPoint* multiPoint, geos_nlohmann::ordered_json& j)
+std::string GeoJSONWriter::writeFormatted(const geom::Geometry* geometry, GeoJSONType type, int indent)
 {
-    j["type"] = "MultiPoint";
-    j["coordinates"] = convertCoordinateSequence(multiPoint->getCoordinates().get());
+    Writer writer;
+    JsonEncoder out(writer, indent, decimalPlaces);
+    encode(geometry, type, out);
+    return writer.toString();
 }
 
-void GeoJSONWriter::encodeMultiLineString(const geom::MultiLineString* multiLineString, geos_nlohmann::ordered_json& j)
+std::string GeoJSONWriter::write(const GeoJSONFeature& feature)
 {
-    j["type"] = "MultiLineString";
-    std::vector<std::vector<std::pair<double, double>>> lines;
-    lines.reserve(multiLineString->getNumGeometries());
-    for (size_t i = 0; i < multiLineString->getNumGeometries(); i++) {
-        lines.push_back(convertCoordinateSequence(multiLineString->getGeometryN(i)->getCoordinates().get()));
-    }
-    j["coordinates"] = lines;
+    Writer writer;
+    write(feature, &writer);
+    return writer.toString();
 }
 
-void GeoJSONWriter::encodeMultiPolygon(const geom::MultiPolygon* multiPolygon, geos_nlohmann::ordered_json& json)
+std::string GeoJSONWriter::write(const GeoJSONFeatureCollection& features)
 {
-    json["type"] = "MultiPolygon";
-    std::vector<std::vector<std::vector<std::pair<double, double>>>> polygons;
-    polygons.reserve(multiPolygon->getNumGeometries());
-    for (size_t i = 0; i < multiPolygon->getNumGeometries(); i++) {
-        const Polygon* polygon = multiPolygon->getGeometryN(i);
-        std::vector<std::vector<std::pair<double, double>>> rings;
-        auto ring = polygon->getExteriorRing();
-        rings.reserve(polygon->getNumInteriorRing() + 1);
-        rings.push_back(convertCoordinateSequence(ring->getCoordinates().get()));
-        for (size_t j = 0; j < polygon->getNumInteriorRing(); j++) {
-            rings.push_back(convertCoordinateSequence(polygon->getInteriorRingN(j)->getCoordinates().get()));
-        }
-        polygons.push_back(rings);
-    }
-    json["coordinates"] = polygons;
+    Writer writer;
+    write(features, &writer);
+    return writer.toString();
 }
 
-void GeoJSONWriter::encodeGeometryCollection(const geom::GeometryCollection* g, geos_nlohmann::ordered_json& j)
+void GeoJSONWriter::write(const geom::Geometry* geometry, Writer* writer, GeoJSONType type)
 {
-    j["type"] = "GeometryCollection";
-    auto geometryArray = j.array();
-    for (size_t i = 0; i < g->getNumGeometries(); i++) {
-        auto geometryObj = j.object();
-        encodeGeometry(g->getGeometryN(i), geometryObj);
-        geometryArray.push_back(geometryObj);
-    }
-    j["geometries"] = geometryArray;
+    JsonEncoder out(*writer, -1, decimalPlaces);
+    encode(geometry, type, out);
 }
 
-std::pair<double, double> GeoJSONWriter::convertCoordinate(const Coordinate* c)
+void GeoJSONWriter::write(const GeoJSONFeature& feature, Writer* writer)
 {
-    return std::make_pair(c->x, c->y);
+    JsonEncoder out(*writer, -1, decimalPlaces);
+    encodeFeature(feature, out);
 }
 
-std::vector<std::pair<double, double>> GeoJSONWriter::convertCoordinateSequence(const CoordinateSequence*
-                                    coordinateSequence)
+void GeoJSONWriter::write(const GeoJSONFeatureCollection& features, Writer* writer)
 {
-    std::vector<std::pair<double, double>> coordinates;
-    coordinates.reserve(coordinateSequence->size());
-    for (size_t i = 0; i<coordinateSequence->size(); i++) {
-        const geom::Coordinate& c = coordinateSequence->getAt(i);
-        coordinates.push_back(convertCoordinate(&c));
+    JsonEncoder out(*writer, -1, decimalPlaces);
+    out.beginObject();
+    out.key("type");
+    out.string("FeatureCollection");
+    out.key("features");
+    out.beginArray();
+    for (const auto& feature : features.getFeatures()) {
+        out.element();
+        encodeFeature(feature, out);
     }
-    return coordinates;
+    out.endArray();
+    out.endObject();
 }
 
 } // namespace geos.io
@@ -0,0 +1,396 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/io/TWKBReader.h>
+#include <geos/io/TWKBConstants.h>
+#include <geos/io/WKBConstants.h>
+#include <geos/io/ParseException.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/GeometryCollection.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/MultiLineString.h>
+#include <geos/geom/MultiPoint.h>
+#include <geos/geom/MultiPolygon.h>
+#include <geos/geom/Point.h>
+#include <geos/geom/Polygon.h>
+#include <geos/util.h>
+
+#include <cmath>
+#include <istream>
+#include <limits>
+#include <vector>
+
+using namespace geos::geom;
+
+namespace geos {
+namespace io { // geos.io
+
+namespace {
+
+// Deepest nesting of geometry collections accepted
+const int maxCollectionDepth = 64;
+
+/*
+ * The sources tell the bytes left to read when they know it. Element
+ * counts are checked against it, and the room for the elements is only
+ * reserved ahead when the count is bounded by the input size.
+ */
+class BufferSource {
+public:
+    static constexpr bool bounded = true;
+
+
+    BufferSource(const unsigned char* buf, std::size_t size)
+        : start(buf)
+        , pos(buf)
+        , end(buf + size)
+    {}
+
+    unsigned char
+    readByte()
+    {
+        if (pos == end) {
+            throw ParseException("Unexpected EOF parsing TWKB");
+        }
+        return *pos++;
+    }
+
+    std::size_t
+    remaining() const
+    {
+        return static_cast<std::size_t>(end - pos);
+    }
+
+    std::size_t
+    bytesRead() const
+    {
+        return static_cast<std::size_t>(pos - start);
+    }
+
+private:
+    const unsigned char* start;
+    const unsigned char* pos;
+    const unsigned char* end;
+};
+
+class StreamSource {
+public:
+    static constexpr bool bounded = false;
+
+    explicit StreamSource(std::istream& is)
+        : in(is)
+    {}
+
+    unsigned char
+    readByte()
+    {
+        auto c = in.get();
+        if (c == std::char_traits<char>::eof()) {
+            throw ParseException("Unexpected EOF parsing TWKB");
+        }
+        return static_cast<unsigned char>(c);
+    }
+
+    std::size_t
+    remaining() const
+    {
+        return std::numeric_limits<std::size_t>::max();
+    }
+
+private:
+    std::istream& in;
+};
+
+int
+unZigZag(uint64_t value)
+{
+    return static_cast<int>(static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1));
+}
+
+/*
+ * Reads TWKB geometries from a source of bytes. The coordinates of a
+ * geometry are stored as differences to the previous vertex, through
+ * all its parts and rings; each member of a collection has its own
+ * header and starts over from zero.
+ */
+template<typename Source>
+class TWKBParser {
+public:
+    TWKBParser(Source& src, const GeometryFactory& gf)
+        : source(src)
+        , factory(gf)
+        , depth(0)
+    {}
+
+    std::unique_ptr<Geometry>
+    readGeometry()
+    {
+        unsigned char header = source.readByte();
+        int type = header & 0x0F;
+        unsigned char metadata = source.readByte();
+
+        Layout layout;
+        layout.xyScale = std::pow(10.0, unZigZag(header >> 4));
+        if (metadata & TWKBConstants::twkbExtendedDims) {
+            unsigned char dims = source.readByte();
+            layout.hasZ = (dims & TWKBConstants::twkbHasZ) != 0;
+            layout.hasM = (dims & TWKBConstants::twkbHasM) != 0;
+            layout.zScale = std::pow(10.0, (dims >> 2) & 0x07);
+        }
+        std::size_t numOrdinates = 2u + layout.hasZ + layout.hasM;
+        std::size_t coordDim = layout.hasZ ? 3u : 2u;
+
+        if (metadata & TWKBConstants::twkbSize) {
+            readUnsignedVarInt();
+        }
+        if (metadata & TWKBConstants::twkbBBox) {
+            for (std::size_t i = 0; i < 2 * numOrdinates; i++) {
+                readVarInt();
+            }
+        }
+
+        if (metadata & TWKBConstants::twkbEmpty) {
+            switch (type) {
+                case WKBConstants::wkbPoint: return factory.createPoint(coordDim);
+                case WKBConstants::wkbLineString:
+                    return factory.createLineString(detail::make_unique<CoordinateArraySequence>(0u, coordDim));
+                case WKBConstants::wkbPolygon: return factory.createPolygon(coordDim);
+                case WKBConstants::wkbMultiPoint: return factory.createMultiPoint();
+                case WKBConstants::wkbMultiLineString: return factory.createMultiLineString();
+                case WKBConstants::wkbMultiPolygon: return factory.createMultiPolygon();
+                case WKBConstants::wkbGeometryCollection: return factory.createGeometryCollection();
+            }
+            throw ParseException("Unknown TWKB geometry type", type);
+        }
+
+        bool hasIdList = (metadata & TWKBConstants::twkbIdList) != 0;
+        switch (type) {
+            case WKBConstants::wkbPoint:
+                return readPoint(layout);
+            case WKBConstants::wkbLineString:
+                return factory.createLineString(readSequence(layout));
+            case WKBConstants::wkbPolygon:
+                return readPolygon(layout);
+            case WKBConstants::wkbMultiPoint: {
+                std::size_t n = readCount(numOrdinates, hasIdList);
+                std::vector<std::unique_ptr<Point>> points;
+                reserve(points, n);
+                for (std::size_t i = 0; i < n; i++) {
+                    points.push_back(readPoint(layout));
+                }
+                return factory.createMultiPoint(std::move(points));
+            }
+            case WKBConstants::wkbMultiLineString: {
+                std::size_t n = readCount(1, hasIdList);
+                std::vector<std::unique_ptr<LineString>> lines;
+                reserve(lines, n);
+                for (std::size_t i = 0; i < n; i++) {
+                    lines.push_back(factory.createLineString(readSequence(layout)));
+                }
+                return factory.createMultiLineString(std::move(lines));
+            }
+            case WKBConstants::wkbMultiPolygon: {
+                std::size_t n = readCount(1, hasIdList);
+                std::vector<std::unique_ptr<Polygon>> polys;
+                reserve(polys, n);
+                for (std::size_t i = 0; i < n; i++) {
+                    polys.push_back(readPolygon(layout));
+                }
+                return factory.createMultiPolygon(std::move(polys));
+            }
+            case WKBConstants::wkbGeometryCollection: {
+                if (depth == maxCollectionDepth) {
+                    throw ParseException("TWKB geometry collections nested too deeply");
+                }
+                std::size_t n = readCount(2, hasIdList);
+                std::vector<std::unique_ptr<Geometry>> geoms;
+                reserve(geoms, n);
+                depth++;
+                for (std::size_t i = 0; i < n; i++) {
+                    geoms.push_back(readGeometry());
+                }
+                depth--;
+                return factory.createGeometryCollection(std::move(geoms));
+            }
+        }
+        throw ParseException("Unknown TWKB geometry type", type);
+    }
+
+private:
+    // The dimensions and scales of a geometry, and its previous vertex
+    struct Layout {
+        bool hasZ = false;
+        bool hasM = false;
+        double xyScale = 1;
+        double zScale = 1;
+        int64_t prev[4] = {0, 0, 0, 0};
+    };
+
+    Source& source;
+    const GeometryFactory& factory;
+    int depth;
+
+    template<typename T>
+    static void
+    reserve(std::vector<T>& v, std::size_t n)
+    {
+        if (Source::bounded) {
+            v.reserve(n);
+        }
+    }
+
+    uint64_t
+    readUnsignedVarInt()
+    {
+        uint64_t value = 0;
+        for (unsigned int shift = 0; shift < 64; shift += 7) {
+            unsigned char b = source.readByte();
+            value |= static_cast<uint64_t>(b & 0x7F) << shift;
+            if (!(b & 0x80)) {
+                return value;
+            }
+        }
+        throw ParseException("Invalid varint in TWKB");
+    }
+
+    int64_t
+    readVarInt()
+    {
+        uint64_t value = readUnsignedVarInt();
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    // Reads a number of items taking at least minBytes each, and skips the id list if any
+    std::size_t
+    readCount(std::size_t minBytes, bool hasIdList)
+    {
+        uint64_t n = readUnsignedVarInt();
+        if (n > source.remaining() / minBytes) {
+            throw ParseException("Invalid TWKB element count", static_cast<double>(n));
+        }
+        if (hasIdList) {
+            for (uint64_t i = 0; i < n; i++) {
+                readVarInt();
+            }
+        }
+        return static_cast<std::size_t>(n);
+    }
+
+    // Adds the next delta to an ordinate, which must stay in range
+    void
+    readOrdinate(int64_t& ordinate)
+    {
+        int64_t delta = readVarInt();
+        if ((delta > 0 && ordinate > std::numeric_limits<int64_t>::max() - delta) ||
+            (delta < 0 && ordinate < std::numeric_limits<int64_t>::min() - delta)) {
+            throw ParseException("TWKB coordinate out of range");
+        }
+        ordinate += delta;
+    }
+
+    Coordinate
+    readCoordinate(Layout& layout)
+    {
+        Coordinate c;
+        readOrdinate(layout.prev[0]);
+        readOrdinate(layout.prev[1]);
+        c.x = static_cast<double>(layout.prev[0]) / layout.xyScale;
+        c.y = static_cast<double>(layout.prev[1]) / layout.xyScale;
+        std::size_t d = 2;
+        if (layout.hasZ) {
+            readOrdinate(layout.prev[d]);
+            c.z = static_cast<double>(layout.prev[d]) / layout.zScale;
+            d++;
+        }
+        if (layout.hasM) {
+            // M values are not held by GEOS geometries
+            readOrdinate(layout.prev[d]);
+        }
+        return c;
+    }
+
+    std::unique_ptr<Point>
+    readPoint(Layout& layout)
+    {
+        Coordinate c = readCoordinate(layout);
+        if (layout.hasZ) {
+            return std::unique_ptr<Point>(factory.createPoint(c));
+        }
+        return factory.createPoint(static_cast<const CoordinateXY&>(c));
+    }
+
+    std::unique_ptr<CoordinateSequence>
+    readSequence(Layout& layout)
+    {
+        std::size_t n = readCount(2u + layout.hasZ + layout.hasM, false);
+        std::vector<Coordinate> coords;
+        reserve(coords, n);
+        for (std::size_t i = 0; i < n; i++) {
+            coords.push_back(readCoordinate(layout));
+        }
+        return detail::make_unique<CoordinateArraySequence>(std::move(coords), layout.hasZ ? 3u : 2u);
+    }
+
+    std::unique_ptr<Polygon>
+    readPolygon(Layout& layout)
+    {
+        std::size_t numRings = readCount(1, false);
+        if (numRings == 0) {
+            return factory.createPolygon(layout.hasZ ? 3u : 2u);
+        }
+        auto shell = factory.createLinearRing(readSequence(layout));
+        std::vector<std::unique_ptr<LinearRing>> holes;
+        reserve(holes, numRings - 1);
+        for (std::size_t i = 1; i < numRings; i++) {
+            holes.push_back(factory.createLinearRing(readSequence(layout)));
+        }
+        return factory.createPolygon(std::move(shell), std::move(holes));
+    }
+};
+
+} // anonymous namespace
+
+TWKBReader::TWKBReader(const GeometryFactory& f)
+    : factory(f)
+{}
+
+TWKBReader::TWKBReader()
+    : TWKBReader(*(GeometryFactory::getDefaultInstance()))
+{}
+
+std::unique_ptr<Geometry>
+TWKBReader::read(const unsigned char* buf, std::size_t size, std::size_t* bytesRead) const
+{
+    BufferSource source(buf, size);
+    auto geom = TWKBParser<BufferSource>(source, factory).readGeometry();
+    if (bytesRead) {
+        *bytesRead = source.bytesRead();
+    }
+    return geom;
+}
+
+std::unique_ptr<Geometry>
+TWKBReader::read(std::istream& is) const
+{
+    if (is.peek() == std::char_traits<char>::eof()) {
+        return nullptr;
+    }
+    StreamSource source(is);
+    return TWKBParser<StreamSource>(source, factory).readGeometry();
+}
+
+} // namespace geos.io
+} // namespace geos
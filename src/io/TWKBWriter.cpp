@@ -0,0 +1,345 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/io/TWKBWriter.h>
+#include <geos/io/TWKBConstants.h>
+#include <geos/io/WKBConstants.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/Point.h>
+#include <geos/geom/Polygon.h>
+#include <geos/util/IllegalArgumentException.h>
+
+#include <algorithm>
+#include <cmath>
+#include <ostream>
+
+using namespace geos::geom;
+
+namespace geos {
+namespace io { // geos.io
+
+namespace {
+
+void
+writeUnsignedVarInt(std::vector<unsigned char>& buf, uint64_t value)
+{
+    while (value >= 0x80) {
+        buf.push_back(static_cast<unsigned char>(value | 0x80));
+        value >>= 7;
+    }
+    buf.push_back(static_cast<unsigned char>(value));
+}
+
+uint64_t
+zigZag(int64_t value)
+{
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+void
+writeVarInt(std::vector<unsigned char>& buf, int64_t value)
+{
+    writeUnsignedVarInt(buf, zigZag(value));
+}
+
+/*
+ * Writes the TWKB of one geometry, with a header. When the size or the
+ * bounding box of the rounded ordinates is included, the body is written
+ * first into a separate buffer, so that they can be written before it.
+ */
+class TWKBGeometryWriter {
+public:
+    TWKBGeometryWriter(int p_xyPrecision, int p_zPrecision, bool p_allowZ, bool p_includeSize, bool p_includeBBox)
+        : xyPrecision(p_xyPrecision)
+        , zPrecision(p_zPrecision)
+        , xyScale(std::pow(10.0, p_xyPrecision))
+        , zScale(std::pow(10.0, p_zPrecision))
+        , allowZ(p_allowZ)
+        , includeSize(p_includeSize)
+        , includeBBox(p_includeBBox)
+    {}
+
+    // Writes g to out, extending the given ordinate ranges by those of g
+    void
+    write(const Geometry& g, std::vector<unsigned char>& out, int64_t* parentMin, int64_t* parentMax)
+    {
+        bool hasZ = allowZ && g.getCoordinateDimension() > 2;
+        std::size_t dims = hasZ ? 3 : 2;
+        bool empty = g.isEmpty();
+
+        uint8_t type = typeOf(g);
+        out.push_back(static_cast<unsigned char>((zigZag(xyPrecision) << 4) | type));
+
+        uint8_t metadata = 0;
+        if (empty) {
+            metadata |= TWKBConstants::twkbEmpty;
+        }
+        else {
+            if (includeBBox) {
+                metadata |= TWKBConstants::twkbBBox;
+            }
+            if (includeSize) {
+                metadata |= TWKBConstants::twkbSize;
+            }
+        }
+        if (hasZ) {
+            metadata |= TWKBConstants::twkbExtendedDims;
+        }
+        out.push_back(metadata);
+        if (hasZ) {
+            out.push_back(static_cast<unsigned char>(TWKBConstants::twkbHasZ | (zPrecision << 2)));
+        }
+        if (empty) {
+            return;
+        }
+
+        State state(dims);
+        if (!includeSize && !includeBBox) {
+            writeBody(g, out, state);
+        }
+        else {
+            std::vector<unsigned char> body;
+            writeBody(g, body, state);
+            writeMetadata(state, body, out);
+        }
+
+        if (parentMin) {
+            for (std::size_t d = 0; d < dims; d++) {
+                parentMin[d] = std::min(parentMin[d], state.min[d]);
+                parentMax[d] = std::max(parentMax[d], state.max[d]);
+            }
+        }
+    }
+
+private:
+    // The previous vertex of the geometry, and the ranges of its ordinates
+    struct State {
+        explicit State(std::size_t p_dims)
+            : dims(p_dims)
+            , prev{0, 0, 0}
+            , min{INT64_MAX, INT64_MAX, INT64_MAX}
+            , max{INT64_MIN, INT64_MIN, INT64_MIN}
+        {}
+
+        std::size_t dims;
+        int64_t prev[3];
+        int64_t min[3];
+        int64_t max[3];
+    };
+
+    int xyPrecision;
+    int zPrecision;
+    double xyScale;
+    double zScale;
+    bool allowZ;
+    bool includeSize;
+    bool includeBBox;
+
+    // Writes the size and bounding box of a geometry, followed by its body
+    void
+    writeMetadata(const State& state, const std::vector<unsigned char>& body, std::vector<unsigned char>& out) const
+    {
+        if (includeSize) {
+            std::vector<unsigned char> bbox;
+            if (includeBBox) {
+                writeBBox(state, bbox);
+            }
+            writeUnsignedVarInt(out, bbox.size() + body.size());
+            out.insert(out.end(), bbox.begin(), bbox.end());
+        }
+        else if (includeBBox) {
+            writeBBox(state, out);
+        }
+        out.insert(out.end(), body.begin(), body.end());
+    }
+
+    static uint8_t
+    typeOf(const Geometry& g)
+    {
+        switch (g.getGeometryTypeId()) {
+            case GEOS_POINT: return WKBConstants::wkbPoint;
+            case GEOS_LINESTRING:
+            case GEOS_LINEARRING: return WKBConstants::wkbLineString;
+            case GEOS_POLYGON: return WKBConstants::wkbPolygon;
+            case GEOS_MULTIPOINT: return WKBConstants::wkbMultiPoint;
+            case GEOS_MULTILINESTRING: return WKBConstants::wkbMultiLineString;
+            case GEOS_MULTIPOLYGON: return WKBConstants::wkbMultiPolygon;
+            case GEOS_GEOMETRYCOLLECTION: return WKBConstants::wkbGeometryCollection;
+        }
+        throw util::IllegalArgumentException("TWKBWriter: unsupported geometry type");
+    }
+
+    void
+    writeBody(const Geometry& g, std::vector<unsigned char>& body, State& state)
+    {
+        switch (g.getGeometryTypeId()) {
+            case GEOS_POINT:
+                writeCoordinate(*static_cast<const Point&>(g).getCoordinate(), body, state);
+                break;
+            case GEOS_LINESTRING:
+            case GEOS_LINEARRING:
+                writeSequence(*static_cast<const LineString&>(g).getCoordinatesRO(), body, state);
+                break;
+            case GEOS_POLYGON:
+                writeRings(static_cast<const Polygon&>(g), body, state);
+                break;
+            case GEOS_MULTIPOINT:
+            case GEOS_MULTILINESTRING:
+            case GEOS_MULTIPOLYGON: {
+                std::size_t n = g.getNumGeometries();
+                writeUnsignedVarInt(body, n);
+                for (std::size_t i = 0; i < n; i++) {
+                    const Geometry* part = g.getGeometryN(i);
+                    if (part->getGeometryTypeId() == GEOS_POINT) {
+                        if (part->isEmpty()) {
+                            throw util::IllegalArgumentException("TWKBWriter: empty points in a multipoint are not supported");
+                        }
+                        writeCoordinate(*static_cast<const Point*>(part)->getCoordinate(), body, state);
+                    }
+                    else {
+                        writeBody(*part, body, state);
+                    }
+                }
+                break;
+            }
+            case GEOS_GEOMETRYCOLLECTION: {
+                std::size_t n = g.getNumGeometries();
+                writeUnsignedVarInt(body, n);
+                for (std::size_t i = 0; i < n; i++) {
+                    write(*g.getGeometryN(i), body, state.min, state.max);
+                }
+                break;
+            }
+        }
+    }
+
+    void
+    writeRings(const Polygon& poly, std::vector<unsigned char>& body, State& state)
+    {
+        if (poly.isEmpty()) {
+            writeUnsignedVarInt(body, 0);
+            return;
+        }
+        std::size_t numHoles = poly.getNumInteriorRing();
+        writeUnsignedVarInt(body, numHoles + 1);
+        writeSequence(*poly.getExteriorRing()->getCoordinatesRO(), body, state);
+        for (std::size_t i = 0; i < numHoles; i++) {
+            writeSequence(*poly.getInteriorRingN(i)->getCoordinatesRO(), body, state);
+        }
+    }
+
+    void
+    writeSequence(const CoordinateSequence& seq, std::vector<unsigned char>& body, State& state)
+    {
+        std::size_t n = seq.size();
+        writeUnsignedVarInt(body, n);
+        for (std::size_t i = 0; i < n; i++) {
+            writeCoordinate(seq.getAt(i), body, state);
+        }
+    }
+
+    void
+    writeCoordinate(const Coordinate& c, std::vector<unsigned char>& body, State& state)
+    {
+        writeOrdinate(c.x, xyScale, 0, body, state);
+        writeOrdinate(c.y, xyScale, 1, body, state);
+        if (state.dims == 3) {
+            // a 2D vertex of a 3D geometry is written with z = 0
+            writeOrdinate(std::isnan(c.z) ? 0.0 : c.z, zScale, 2, body, state);
+        }
+    }
+
+    static void
+    writeOrdinate(double value, double scale, std::size_t d, std::vector<unsigned char>& body, State& state)
+    {
+        double scaled = std::round(value * scale);
+        // the delta to the previous vertex must fit in 64 bits
+        if (!(std::fabs(scaled) < 4e18)) {
+            throw util::IllegalArgumentException("TWKBWriter: ordinate cannot be represented");
+        }
+        int64_t v = static_cast<int64_t>(scaled);
+        writeVarInt(body, v - state.prev[d]);
+        state.prev[d] = v;
+        state.min[d] = std::min(state.min[d], v);
+        state.max[d] = std::max(state.max[d], v);
+    }
+
+    static void
+    writeBBox(const State& state, std::vector<unsigned char>& out)
+    {
+        for (std::size_t d = 0; d < state.dims; d++) {
+            writeVarInt(out, state.min[d]);
+            writeVarInt(out, state.max[d] - state.min[d]);
+        }
+    }
+};
+
+} // anonymous namespace
+
+TWKBWriter::TWKBWriter(int p_xyPrecision, uint8_t dims)
+    : zPrecision(0)
+    , includeSize(false)
+    , includeBBox(false)
+{
+    setXYPrecision(p_xyPrecision);
+    setOutputDimension(dims);
+}
+
+void
+TWKBWriter::setXYPrecision(int newPrecision)
+{
+    if (newPrecision < -7 || newPrecision > 7) {
+        throw util::IllegalArgumentException("TWKB x and y precision must be between -7 and 7");
+    }
+    xyPrecision = newPrecision;
+}
+
+void
+TWKBWriter::setZPrecision(int newPrecision)
+{
+    if (newPrecision < 0 || newPrecision > 7) {
+        throw util::IllegalArgumentException("TWKB z precision must be between 0 and 7");
+    }
+    zPrecision = newPrecision;
+}
+
+void
+TWKBWriter::setOutputDimension(uint8_t newOutputDimension)
+{
+    if (newOutputDimension < 2 || newOutputDimension > 3) {
+        throw util::IllegalArgumentException("TWKB output dimension must be 2 or 3");
+    }
+    outputDimension = newOutputDimension;
+}
+
+void
+TWKBWriter::write(const Geometry& g, std::vector<unsigned char>& buf) const
+{
+    TWKBGeometryWriter writer(xyPrecision, zPrecision, outputDimension == 3, includeSize, includeBBox);
+    writer.write(g, buf, nullptr, nullptr);
+}
+
+void
+TWKBWriter::write(const Geometry& g, std::ostream& os) const
+{
+    std::vector<unsigned char> buf;
+    write(g, buf);
+    os.write(reinterpret_cast<const char*>(buf.data()), static_cast<std::streamsize>(buf.size()));
+}
+
+} // namespace geos.io
+} // namespace geos
@@ -0,0 +1,605 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/io/WKTBufferReader.h>
+#include <geos/io/ParseException.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/Point.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/MultiPoint.h>
+#include <geos/geom/MultiLineString.h>
+#include <geos/geom/MultiPolygon.h>
+#include <geos/geom/CoordinateSequenceFactory.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/util.h>
+#include <geos/util/string.h>
+
+#include <cctype>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace geos::geom;
+
+namespace geos {
+namespace io { // geos.io
+
+/// A word of the text, referenced in place
+struct WKTBufferReader::Word {
+    const char* data;
+    std::size_t size;
+
+    Word() : data(nullptr), size(0) {}
+
+    Word(const char* p_data, std::size_t p_size) : data(p_data), size(p_size) {}
+
+    Word(const char* s) : data(s), size(std::strlen(s)) {}
+
+    bool
+    equalsIgnoreCase(const char* upper) const
+    {
+        std::size_t n = std::strlen(upper);
+        return size == n && matchesIgnoreCase(0, upper, n);
+    }
+
+    bool
+    startsWithIgnoreCase(const char* upper) const
+    {
+        std::size_t n = std::strlen(upper);
+        return size >= n && matchesIgnoreCase(0, upper, n);
+    }
+
+    bool
+    endsWithIgnoreCase(const char* upper) const
+    {
+        std::size_t n = std::strlen(upper);
+        return size >= n && matchesIgnoreCase(size - n, upper, n);
+    }
+
+    std::string
+    str() const
+    {
+        return std::string(data, size);
+    }
+
+    std::string
+    toUpper() const
+    {
+        std::string upper = str();
+        for (char& c : upper) {
+            c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+        }
+        return upper;
+    }
+
+private:
+    /// Whether the n characters from offset match the upper-case ones
+    bool
+    matchesIgnoreCase(std::size_t offset, const char* upper, std::size_t n) const
+    {
+        for (std::size_t i = 0; i < n; i++) {
+            if (std::toupper(static_cast<unsigned char>(data[offset + i])) != upper[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+/**
+ * Splits the text into the tokens '(', ')', ',', numbers and words,
+ * without copying it. The next token can be peeked at without being
+ * consumed.
+ */
+class WKTBufferReader::Tokenizer {
+public:
+    enum Type {
+        TT_EOF = -1,
+        TT_NUMBER = -2,
+        TT_WORD = -3
+    };
+
+    Tokenizer(const char* p_begin, const char* p_end)
+        : begin(p_begin)
+        , cur(p_begin)
+        , end(p_end)
+        , peeked(false)
+        , type(TT_EOF)
+        , number(0.0)
+    {}
+
+    int
+    peekNextToken()
+    {
+        if (!peeked) {
+            type = scan();
+            peeked = true;
+        }
+        return type;
+    }
+
+    int
+    nextToken()
+    {
+        int t = peekNextToken();
+        peeked = false;
+        return t;
+    }
+
+    double
+    getNVal() const
+    {
+        return number;
+    }
+
+    Word
+    getSVal() const
+    {
+        return word;
+    }
+
+    /// Text of a token, for error messages
+    std::string
+    getText(int tokenType) const
+    {
+        switch(tokenType) {
+        case TT_EOF:
+            return "end of stream";
+        case '(':
+            return "(";
+        case ')':
+            return ")";
+        case ',':
+            return ",";
+        default:
+            return word.toUpper();
+        }
+    }
+
+    /// Offset past the last token read
+    std::size_t
+    getPosition() const
+    {
+        return static_cast<std::size_t>((peeked ? tokenStart : cur) - begin);
+    }
+
+private:
+    const char* begin;
+    const char* cur;
+    const char* end;
+    const char* tokenStart = nullptr;
+    bool peeked;
+    int type;
+    double number;
+    Word word;
+
+    static bool
+    isWhiteSpace(char c)
+    {
+        return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+    }
+
+    static bool
+    isDelimiter(char c)
+    {
+        return isWhiteSpace(c) || c == '(' || c == ')' || c == ',';
+    }
+
+    int
+    scan()
+    {
+        while (cur != end && isWhiteSpace(*cur)) {
+            ++cur;
+        }
+        tokenStart = cur;
+        if (cur == end) {
+            return TT_EOF;
+        }
+        char c = *cur;
+        if (c == '(' || c == ')' || c == ',') {
+            ++cur;
+            return c;
+        }
+        const char* start = cur;
+        while (cur != end && !isDelimiter(*cur)) {
+            ++cur;
+        }
+        word = Word(start, static_cast<std::size_t>(cur - start));
+        if (util::parseDouble(start, cur, number)) {
+            return TT_NUMBER;
+        }
+        return TT_WORD;
+    }
+};
+
+std::unique_ptr<Geometry>
+WKTBufferReader::read(const char* text, std::size_t length) const
+{
+    Tokenizer tokenizer(text, text + length);
+    OrdinateSet ordinateFlags = OrdinateSet::createXY();
+    auto ret = readGeometryTaggedText(tokenizer, ordinateFlags);
+
+    if (tokenizer.peekNextToken() != Tokenizer::TT_EOF) {
+        throw ParseException("Unexpected text after end of geometry");
+    }
+
+    return ret;
+}
+
+std::unique_ptr<Geometry>
+WKTBufferReader::readNext(const char* text, std::size_t length, std::size_t& pos) const
+{
+    if (pos >= length) {
+        return nullptr;
+    }
+    Tokenizer tokenizer(text + pos, text + length);
+    if (tokenizer.peekNextToken() == Tokenizer::TT_EOF) {
+        pos = length;
+        return nullptr;
+    }
+
+    OrdinateSet ordinateFlags = OrdinateSet::createXY();
+    auto ret = readGeometryTaggedText(tokenizer, ordinateFlags);
+    pos += tokenizer.getPosition();
+    return ret;
+}
+
+std::unique_ptr<CoordinateSequence>
+WKTBufferReader::getCoordinates(Tokenizer& tokenizer, OrdinateSet& ordinateFlags, bool closeRing) const
+{
+    if (getNextEmptyOrOpener(tokenizer, ordinateFlags)) {
+        return geometryFactory->getCoordinateSequenceFactory()->create(std::size_t(0), ordinateFlags.hasZ() ? 3 : 2);
+    }
+
+    std::vector<Coordinate> coords;
+    Coordinate coord;
+    do {
+        getPreciseCoordinate(tokenizer, ordinateFlags, coord);
+        coords.push_back(coord);
+    } while (getNextCloserOrComma(tokenizer));
+
+    if (closeRing && coords.front() != coords.back()) {
+        coords.push_back(coords.front());
+    }
+
+    // Check dim after reading first coord, because we may have picked up an implicit Z dimension
+    std::size_t dim = ordinateFlags.hasZ() ? 3 : 2;
+    return detail::make_unique<CoordinateArraySequence>(std::move(coords), dim);
+}
+
+void
+WKTBufferReader::getPreciseCoordinate(Tokenizer& tokenizer,
+                                      OrdinateSet& ordinateFlags,
+                                      Coordinate& coord) const
+{
+    coord.x = getNextNumber(tokenizer);
+    coord.y = getNextNumber(tokenizer);
+
+    // Check for undeclared Z dimension
+    if (ordinateFlags.changesAllowed() && tokenizer.peekNextToken() == Tokenizer::TT_NUMBER) {
+        ordinateFlags.setZ(true);
+    }
+
+    if (ordinateFlags.hasZ()) {
+        coord.z = getNextNumber(tokenizer);
+    }
+
+    // Check for undeclared M dimension
+    if (ordinateFlags.changesAllowed() && ordinateFlags.hasZ() && tokenizer.peekNextToken() == Tokenizer::TT_NUMBER) {
+        ordinateFlags.setM(true);
+    }
+
+    if (ordinateFlags.hasM()) {
+        // discard M ordinate
+        getNextNumber(tokenizer);
+    }
+
+    ordinateFlags.setChangesAllowed(false); // First coordinate read; future coordinates must be consistent
+
+    precisionModel->makePrecise(coord);
+}
+
+double
+WKTBufferReader::getNextNumber(Tokenizer& tokenizer)
+{
+    switch(tokenizer.nextToken()) {
+    case Tokenizer::TT_NUMBER:
+        return tokenizer.getNVal();
+    case Tokenizer::TT_EOF:
+        throw ParseException("Expected number but encountered end of stream");
+    case Tokenizer::TT_WORD:
+        throw ParseException("Expected number but encountered word", tokenizer.getSVal().str());
+    case '(':
+        throw ParseException("Expected number but encountered '('");
+    case ')':
+        throw ParseException("Expected number but encountered ')'");
+    default:
+        throw ParseException("Expected number but encountered ','");
+    }
+}
+
+WKTBufferReader::Word
+WKTBufferReader::getNextWord(Tokenizer& tokenizer)
+{
+    switch(tokenizer.nextToken()) {
+    case Tokenizer::TT_WORD:
+        return tokenizer.getSVal();
+    case Tokenizer::TT_EOF:
+        throw ParseException("Expected word but encountered end of stream");
+    case Tokenizer::TT_NUMBER:
+        throw ParseException("Expected word but encountered number", tokenizer.getNVal());
+    case '(':
+        return "(";
+    case ')':
+        return ")";
+    default:
+        return ",";
+    }
+}
+
+void
+WKTBufferReader::readOrdinateFlags(const Word& s, OrdinateSet& ordinateFlags)
+{
+    if (s.endsWithIgnoreCase("ZM")) {
+        ordinateFlags.setM(true);
+        ordinateFlags.setZ(true);
+        ordinateFlags.setChangesAllowed(false);
+    } else if (s.endsWithIgnoreCase("M")) {
+        ordinateFlags.setM(true);
+        ordinateFlags.setChangesAllowed(false);
+    } else if (s.endsWithIgnoreCase("Z")) {
+        ordinateFlags.setZ(true);
+        ordinateFlags.setChangesAllowed(false);
+    }
+}
+
+bool
+WKTBufferReader::getNextEmptyOrOpener(Tokenizer& tokenizer, OrdinateSet& ordinateFlags)
+{
+    Word nextWord = getNextWord(tokenizer);
+
+    bool flagsModified = false;
+
+    // Skip the Z, M or ZM of an SF1.2 3/4 dim coordinate.
+    if (nextWord.equalsIgnoreCase("ZM")) {
+        ordinateFlags.setZ(true);
+        ordinateFlags.setM(true);
+        flagsModified = true;
+        nextWord = getNextWord(tokenizer);
+    } else {
+        if (nextWord.equalsIgnoreCase("Z")) {
+            ordinateFlags.setZ(true);
+            flagsModified = true;
+            nextWord = getNextWord(tokenizer);
+        }
+
+        if (nextWord.equalsIgnoreCase("M")) {
+            ordinateFlags.setM(true);
+            flagsModified = true;
+            nextWord = getNextWord(tokenizer);
+        }
+    }
+
+    if (flagsModified) {
+        ordinateFlags.setChangesAllowed(false);
+    }
+
+    if (nextWord.equalsIgnoreCase("(")) {
+        return false;
+    }
+    if (nextWord.equalsIgnoreCase("EMPTY")) {
+        return true;
+    }
+    throw ParseException("Expected 'Z', 'M', 'ZM', 'EMPTY' or '(' but encountered ", nextWord.toUpper());
+}
+
+bool
+WKTBufferReader::getNextCloserOrComma(Tokenizer& tokenizer)
+{
+    int type = tokenizer.nextToken();
+    if (type == ',') {
+        return true;
+    }
+    if (type == ')') {
+        return false;
+    }
+    throw ParseException("Expected ')' or ',' but encountered", tokenizer.getText(type));
+}
+
+void
+WKTBufferReader::getNextCloser(Tokenizer& tokenizer)
+{
+    int type = tokenizer.nextToken();
+    if (type != ')') {
+        throw ParseException("Expected ')' but encountered", tokenizer.getText(type));
+    }
+}
+
+std::unique_ptr<Geometry>
+WKTBufferReader::readGeometryTaggedText(Tokenizer& tokenizer, OrdinateSet& ordinateFlags) const
+{
+    Word type = getNextWord(tokenizer);
+
+    std::unique_ptr<Geometry> geom;
+    OrdinateSet origFlags = ordinateFlags;
+    OrdinateSet newFlags = OrdinateSet::createXY();
+    readOrdinateFlags(type, newFlags);
+
+    if(type.startsWithIgnoreCase("POINT")) {
+        geom = readPointText(tokenizer, newFlags);
+    }
+    else if(type.startsWithIgnoreCase("LINESTRING")) {
+        geom = readLineStringText(tokenizer, newFlags);
+    }
+    else if(type.startsWithIgnoreCase("LINEARRING")) {
+        geom = readLinearRingText(tokenizer, newFlags);
+    }
+    else if(type.startsWithIgnoreCase("POLYGON")) {
+        geom = readPolygonText(tokenizer, newFlags);
+    }
+    else if(type.startsWithIgnoreCase("MULTIPOINT")) {
+        geom = readMultiPointText(tokenizer, newFlags);
+    }
+    else if(type.startsWithIgnoreCase("MULTILINESTRING")) {
+        geom = readMultiLineStringText(tokenizer, newFlags);
+    }
+    else if(type.startsWithIgnoreCase("MULTIPOLYGON")) {
+        geom = readMultiPolygonText(tokenizer, newFlags);
+    }
+    else if(type.startsWithIgnoreCase("GEOMETRYCOLLECTION")) {
+        geom = readGeometryCollectionText(tokenizer, newFlags);
+    } else {
+        throw ParseException("Unknown type", type.toUpper());
+    }
+
+    if (!origFlags.changesAllowed() && newFlags != origFlags) {
+        throw ParseException("Cannot mix dimensionality in a geometry.");
+    }
+
+    return geom;
+}
+
+std::unique_ptr<Point>
+WKTBufferReader::readPointText(Tokenizer& tokenizer, OrdinateSet& ordinateFlags) const
+{
+    if (getNextEmptyOrOpener(tokenizer, ordinateFlags)) {
+        return geometryFactory->createPoint(ordinateFlags.hasZ() ? 3 : 2);
+    }
+
+    Coordinate coord;
+    getPreciseCoordinate(tokenizer, ordinateFlags, coord);
+    getNextCloser(tokenizer);
+
+    return std::unique_ptr<Point>(geometryFactory->createPoint(coord));
+}
+
+std::unique_ptr<LineString>
+WKTBufferReader::readLineStringText(Tokenizer& tokenizer, OrdinateSet& ordinateFlags) const
+{
+    return geometryFactory->createLineString(getCoordinates(tokenizer, ordinateFlags, false));
+}
+
+std::unique_ptr<LinearRing>
+WKTBufferReader::readLinearRingText(Tokenizer& tokenizer, OrdinateSet& ordinateFlags) const
+{
+    return geometryFactory->createLinearRing(getCoordinates(tokenizer, ordinateFlags, fixStructure));
+}
+
+std::unique_ptr<MultiPoint>
+WKTBufferReader::readMultiPointText(Tokenizer& tokenizer, OrdinateSet& ordinateFlags) const
+{
+    if (getNextEmptyOrOpener(tokenizer, ordinateFlags)) {
+        return geometryFactory->createMultiPoint();
+    }
+
+    int tok = tokenizer.peekNextToken();
+
+    if(tok == Tokenizer::TT_NUMBER) {
+        // Try to parse deprecated form "MULTIPOINT(0 0, 1 1)"
+        std::vector<Coordinate> coords;
+        Coordinate coord;
+        do {
+            getPreciseCoordinate(tokenizer, ordinateFlags, coord);
+            coords.push_back(coord);
+        } while(getNextCloserOrComma(tokenizer));
+
+        return std::unique_ptr<MultiPoint>(geometryFactory->createMultiPoint(coords));
+    }
+
+    if(tok == '(' ||  // Try to parse correct form "MULTIPOINT((0 0), (1 1))"
+            tok == Tokenizer::TT_WORD) { // EMPTY?
+        std::vector<std::unique_ptr<Point>> points;
+        do {
+            points.push_back(readPointText(tokenizer, ordinateFlags));
+        } while(getNextCloserOrComma(tokenizer));
+
+        return geometryFactory->createMultiPoint(std::move(points));
+    }
+
+    switch(tok) {
+    case Tokenizer::TT_EOF:
+        throw ParseException("Unexpected token: EOF or EOL");
+    case ')':
+        throw ParseException("Unexpected token: )");
+    default:
+        throw ParseException("Unexpected token: ,");
+    }
+}
+
+std::unique_ptr<Polygon>
+WKTBufferReader::readPolygonText(Tokenizer& tokenizer, OrdinateSet& ordinateFlags) const
+{
+    if (getNextEmptyOrOpener(tokenizer, ordinateFlags)) {
+        return geometryFactory->createPolygon(ordinateFlags.hasZ() ? 3 : 2);
+    }
+
+    std::vector<std::unique_ptr<LinearRing>> holes;
+    auto shell = readLinearRingText(tokenizer, ordinateFlags);
+    while(getNextCloserOrComma(tokenizer)) {
+        holes.push_back(readLinearRingText(tokenizer, ordinateFlags));
+    }
+
+    return geometryFactory->createPolygon(std::move(shell), std::move(holes));
+}
+
+std::unique_ptr<MultiLineString>
+WKTBufferReader::readMultiLineStringText(Tokenizer& tokenizer, OrdinateSet& ordinateFlags) const
+{
+    if (getNextEmptyOrOpener(tokenizer, ordinateFlags)) {
+        return geometryFactory->createMultiLineString();
+    }
+
+    std::vector<std::unique_ptr<LineString>> lineStrings;
+    do {
+        lineStrings.push_back(readLineStringText(tokenizer, ordinateFlags));
+    } while (getNextCloserOrComma(tokenizer));
+
+    return geometryFactory->createMultiLineString(std::move(lineStrings));
+}
+
+std::unique_ptr<MultiPolygon>
+WKTBufferReader::readMultiPolygonText(Tokenizer& tokenizer, OrdinateSet& ordinateFlags) const
+{
+    if (getNextEmptyOrOpener(tokenizer, ordinateFlags)) {
+        return geometryFactory->createMultiPolygon();
+    }
+
+    std::vector<std::unique_ptr<Polygon>> polygons;
+    do {
+        polygons.push_back(readPolygonText(tokenizer, ordinateFlags));
+    } while(getNextCloserOrComma(tokenizer));
+
+    return geometryFactory->createMultiPolygon(std::move(polygons));
+}
+
+std::unique_ptr<GeometryCollection>
+WKTBufferReader::readGeometryCollectionText(Tokenizer& tokenizer, OrdinateSet& ordinateFlags) const
+{
+    if (getNextEmptyOrOpener(tokenizer, ordinateFlags)) {
+        return geometryFactory->createGeometryCollection();
+    }
+
+    std::vector<std::unique_ptr<Geometry>> geoms;
+    do {
+        geoms.push_back(readGeometryTaggedText(tokenizer, ordinateFlags));
+    } while(getNextCloserOrComma(tokenizer));
+
+    return geometryFactory->createGeometryCollection(std::move(geoms));
+}
+
+} // namespace geos.io
+} // namespace geos
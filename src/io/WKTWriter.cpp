@@ -20,7 +20,6 @@
 
 #include <geos/io/WKTWriter.h>
 #include <geos/io/Writer.h>
-#include <geos/io/CLocalizer.h>
 #include <geos/geom/Coordinate.h>
 #include <geos/geom/Point.h>
 #include <geos/geom/LinearRing.h>
@@ -37,12 +36,13 @@
 
 #include <algorithm> // for min
 #include <typeinfo>
-#include <cstdio> // should avoid this
+#include <cctype>
+#include <cstdio>
+#include <cstring>
 #include <string>
 #include <sstream>
 #include <cassert>
 #include <cmath>
-#include <iomanip>
 
 
 using namespace geos::geom;
@@ -169,6 +169,18 @@ WKTWriter::write(const Geometry* geometry, Writer* writer)
     writeFormatted(geometry, false, writer);
 }
 
+std::size_t
+WKTWriter::write(const Geometry* geometry, char* buffer, std::size_t size)
+{
+    Writer writer(buffer, size);
+    writeFormatted(geometry, false, &writer);
+    std::size_t length = writer.getLength();
+    if (size > 0) {
+        buffer[std::min(length, size - 1)] = '\0';
+    }
+    return length;
+}
+
 std::string
 WKTWriter::writeFormatted(const Geometry* geometry)
 {
@@ -187,7 +199,6 @@ void
 WKTWriter::writeFormatted(const Geometry* geometry, bool p_isFormatted,
                           Writer* writer)
 {
-    CLocalizer clocale;
     this->isFormatted = p_isFormatted;
     decimalPlaces = roundingPrecision == -1
                     ? geometry->getPrecisionModel()->getMaximumSignificantDigits()
@@ -203,38 +214,32 @@ WKTWriter::appendGeometryTaggedText(const Geometry* geometry, int p_level,
                                geometry->getCoordinateDimension());
 
     indent(p_level, writer);
-    if(const Point* point = dynamic_cast<const Point*>(geometry)) {
-        appendPointTaggedText(point->getCoordinate(), p_level, writer);
-    }
-    else if(const LinearRing* lr =
-                dynamic_cast<const LinearRing*>(geometry)) {
-        appendLinearRingTaggedText(lr, p_level, writer);
-    }
-    else if(const LineString* ls =
-                dynamic_cast<const LineString*>(geometry)) {
-        appendLineStringTaggedText(ls, p_level, writer);
-    }
-    else if(const Polygon* x1 =
-                dynamic_cast<const Polygon*>(geometry)) {
-        appendPolygonTaggedText(x1, p_level, writer);
-    }
-    else if(const MultiPoint* x2 =
-                dynamic_cast<const MultiPoint*>(geometry)) {
-        appendMultiPointTaggedText(x2, p_level, writer);
-    }
-    else if(const MultiLineString* x3 =
-                dynamic_cast<const MultiLineString*>(geometry)) {
-        appendMultiLineStringTaggedText(x3, p_level, writer);
-    }
-    else if(const MultiPolygon* x4 =
-                dynamic_cast<const MultiPolygon*>(geometry)) {
-        appendMultiPolygonTaggedText(x4, p_level, writer);
-    }
-    else if(const GeometryCollection* x5 =
-                dynamic_cast<const GeometryCollection*>(geometry)) {
-        appendGeometryCollectionTaggedText(x5, p_level, writer);
-    }
-    else {
+    switch(geometry->getGeometryTypeId()) {
+    case GEOS_POINT:
+        appendPointTaggedText(static_cast<const Point*>(geometry)->getCoordinate(), p_level, writer);
+        break;
+    case GEOS_LINEARRING:
+        appendLinearRingTaggedText(static_cast<const LinearRing*>(geometry), p_level, writer);
+        break;
+    case GEOS_LINESTRING:
+        appendLineStringTaggedText(static_cast<const LineString*>(geometry), p_level, writer);
+        break;
+    case GEOS_POLYGON:
+        appendPolygonTaggedText(static_cast<const Polygon*>(geometry), p_level, writer);
+        break;
+    case GEOS_MULTIPOINT:
+        appendMultiPointTaggedText(static_cast<const MultiPoint*>(geometry), p_level, writer);
+        break;
+    case GEOS_MULTILINESTRING:
+        appendMultiLineStringTaggedText(static_cast<const MultiLineString*>(geometry), p_level, writer);
+        break;
+    case GEOS_MULTIPOLYGON:
+        appendMultiPolygonTaggedText(static_cast<const MultiPolygon*>(geometry), p_level, writer);
+        break;
+    case GEOS_GEOMETRYCOLLECTION:
+        appendGeometryCollectionTaggedText(static_cast<const GeometryCollection*>(geometry), p_level, writer);
+        break;
+    default:
         assert(0); // Unsupported Geometry implementation
     }
 }
@@ -351,16 +356,16 @@ void
 WKTWriter::appendCoordinate(const Coordinate* coordinate,
                             Writer* writer)
 {
-    writer->write(writeNumber(coordinate->x));
-    writer->write(" ");
-    writer->write(writeNumber(coordinate->y));
+    appendNumber(coordinate->x, writer);
+    writer->write(' ');
+    appendNumber(coordinate->y, writer);
     if(outputDimension == 3) {
-        writer->write(" ");
+        writer->write(' ');
         if(std::isnan(coordinate->z)) {
-            writer->write(writeNumber(0.0));
+            appendNumber(0.0, writer);
         }
         else {
-            writer->write(writeNumber(coordinate->z));
+            appendNumber(coordinate->z, writer);
         }
     }
 }
@@ -368,29 +373,56 @@ WKTWriter::appendCoordinate(const Coordinate* coordinate,
 /* protected */
 std::string
 WKTWriter::writeNumber(double d) const
+{
+    Writer writer;
+    appendNumber(d, &writer);
+    return writer.toString();
+}
+
+/* private */
+void
+WKTWriter::appendNumber(double d, Writer* writer) const
 {
     uint32_t precision = decimalPlaces >= 0 ? static_cast<std::uint32_t>(decimalPlaces) : 0;
+    // Longest fixed notation: sign, 309 integer digits, point and decimals
+    std::size_t maxLength = 330 + precision;
+    char* buf = writer->prepare(maxLength);
     /*
     * For a "trimmed" result, with no trailing zeros we use
     * the ryu library.
     */
     if (trim) {
-        char buf[128];
         int len = geos_d2sfixed_buffered_n(d, precision, buf);
-        buf[len] = '\0';
-        std::string s(buf);
-        return s;
+        writer->commit(static_cast<std::size_t>(len));
     }
     /*
     * For an "untrimmed" result, compatible with the old
-    * format, we continue to use std::fixed.
+    * format, we continue to use fixed notation with all decimals.
     */
     else {
-        std::stringstream ss;
-        ss << std::fixed;
-        ss << std::setprecision(static_cast<int>(precision));
-        ss << d;
-        return ss.str();
+        int len = std::snprintf(buf, maxLength, "%.*f", static_cast<int>(precision), d);
+        std::size_t n = static_cast<std::size_t>(len);
+        // Use a '.' whatever the decimal point of the locale
+        char* p = buf;
+        char* end = buf + n;
+        if (p != end && *p == '-') {
+            ++p;
+        }
+        if (p != end && std::isdigit(static_cast<unsigned char>(*p))) {
+            while (p != end && std::isdigit(static_cast<unsigned char>(*p))) {
+                ++p;
+            }
+            if (p != end && *p != '.') {
+                char* q = p;
+                while (q != end && !std::isdigit(static_cast<unsigned char>(*q))) {
+                    ++q;
+                }
+                *p = '.';
+                std::memmove(p + 1, q, static_cast<std::size_t>(end - q));
+                n -= static_cast<std::size_t>(q - p - 1);
+            }
+        }
+        writer->commit(n);
     }
 }
 
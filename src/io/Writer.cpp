@@ -18,30 +18,83 @@
  **********************************************************************/
 
 #include <geos/io/Writer.h>
+#include <geos/util/IllegalArgumentException.h>
+#include <algorithm>
+#include <cstring>
 #include <string>
 
 namespace geos {
 namespace io { // geos.io
 
 Writer::Writer()
+    : buf(nullptr)
+    , bufSize(0)
+    , length(0)
+    , external(false)
+    , usingScratch(false)
 {
 }
 
+Writer::Writer(char* buffer, std::size_t size)
+    : buf(buffer)
+    , bufSize(size)
+    , length(0)
+    , external(true)
+    , usingScratch(false)
+{
+    if (!buffer && size > 0) {
+        throw util::IllegalArgumentException("Writer: null buffer of non-zero size");
+    }
+}
+
 void
 Writer::reserve(std::size_t capacity)
 {
-    str.reserve(capacity);
+    if (!external && capacity > str.size()) {
+        str.resize(capacity);
+    }
 }
 
 void
-Writer::write(const std::string& txt)
+Writer::writeOverflow(const char* txt, std::size_t len)
+{
+    if (external) {
+        // copy what fits in the caller's buffer
+        if (length < bufSize) {
+            std::memcpy(buf + length, txt, std::min(len, bufSize - length));
+        }
+    }
+    else {
+        str.resize(std::max(2 * str.size(), length + len));
+        std::memcpy(&str[length], txt, len);
+    }
+    length += len;
+}
+
+char*
+Writer::prepareOverflow(std::size_t n)
 {
-    str.append(txt);
+    if (external) {
+        // format in a scratch space, to be partially copied on commit
+        if (str.size() < n) {
+            str.resize(n);
+        }
+        usingScratch = true;
+        return &str[0];
+    }
+    str.resize(std::max(2 * str.size(), length + n));
+    return &str[length];
 }
 
 const std::string&
 Writer::toString()
 {
+    if (external) {
+        str.assign(buf, std::min(length, bufSize));
+    }
+    else {
+        str.resize(length);
+    }
     return str;
 }
 
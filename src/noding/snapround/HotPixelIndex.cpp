@@ -21,6 +21,7 @@
 #include <algorithm> // for std::min and std::max
 #include <cassert>
 #include <memory>
+#include <numeric>
 
 using namespace geos::algorithm;
 using namespace geos::geom;
@@ -81,59 +82,117 @@ HotPixelIndex::add(const Coordinate& p)
 void
 HotPixelIndex::add(const CoordinateSequence *pts)
 {
-    /*
-    * Add the points to the tree in random order
-    * to avoid getting an unbalanced tree from
-    * spatially autocorrelated coordinates
-    */
-    std::vector<std::size_t> idxs;
-    for (std::size_t i = 0, sz = pts->size(); i < sz; i++)
-        idxs.push_back(i);
-
-    std::random_device rd;
-    std::mt19937 g(rd());
-    std::shuffle(idxs.begin(), idxs.end(), g);
-
-    for (auto i : idxs) {
-        add(pts->getAt(i));
-    }
+    std::vector<Coordinate> coords;
+    pts->toVector(coords);
+    add(coords, std::vector<Coordinate>());
 }
 
 /*public*/
 void
 HotPixelIndex::add(const std::vector<geom::Coordinate>& pts)
 {
-    std::vector<std::size_t> idxs;
-    for (std::size_t i = 0, sz = pts.size(); i < sz; i++)
-        idxs.push_back(i);
-
-    std::random_device rd;
-    std::mt19937 g(rd());
-    std::shuffle(idxs.begin(), idxs.end(), g);
-
-    for (auto i : idxs) {
-        add(pts[i]);
-    }
+    add(pts, std::vector<Coordinate>());
 }
 
 /*public*/
 void
 HotPixelIndex::addNodes(const CoordinateSequence *pts)
 {
-    for (std::size_t i = 0, sz = pts->size(); i < sz; i++) {
-        HotPixel* hp = add(pts->getAt(i));
-        hp->setToNode();
-    }
+    std::vector<Coordinate> coords;
+    pts->toVector(coords);
+    add(std::vector<Coordinate>(), coords);
 }
 
 /*public*/
 void
 HotPixelIndex::addNodes(const std::vector<geom::Coordinate>& pts)
 {
-    for (auto pt: pts) {
+    add(std::vector<Coordinate>(), pts);
+}
+
+/*public*/
+void
+HotPixelIndex::add(const std::vector<geom::Coordinate>& pts, const std::vector<geom::Coordinate>& nodePts)
+{
+    if (!index->isEmpty()) {
+        addOneByOne(pts, nodePts);
+        return;
+    }
+
+    /*
+    * Round the nodes first, so that each pixel is created
+    * from the same point as when they are added one at a time
+    */
+    std::vector<Coordinate> roundPts;
+    roundPts.reserve(nodePts.size() + pts.size());
+    for (const auto& pt : nodePts) {
+        roundPts.push_back(round(pt));
+    }
+    for (const auto& pt : pts) {
+        roundPts.push_back(round(pt));
+    }
+
+    std::vector<std::size_t> order(roundPts.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&roundPts](std::size_t a, std::size_t b) {
+        return roundPts[a].compareTo(roundPts[b]) < 0;
+    });
+
+    std::vector<Coordinate> pixelPts;
+    std::vector<void*> pixels;
+    for (std::size_t k = 0; k < order.size(); ) {
+        const Coordinate& pRound = roundPts[order[k]];
+        bool isNode = order[k] < nodePts.size();
+
+        /**
+         * Hot Pixels which are added more than once
+         * must have more than one vertex in them
+         * and thus must be nodes.
+         */
+        std::size_t next = k + 1;
+        while (next < order.size() && roundPts[order[next]].equals2D(pRound)) {
+            isNode = true;
+            next++;
+        }
+
+        hotPixelQue.emplace_back(pRound, scaleFactor);
+        HotPixel* hp = &(hotPixelQue.back());
+        if (isNode) {
+            hp->setToNode();
+        }
+        pixelPts.push_back(hp->getCoordinate());
+        pixels.push_back(hp);
+
+        k = next;
+    }
+
+    index->insert(pixelPts, pixels);
+}
+
+/*private*/
+void
+HotPixelIndex::addOneByOne(const std::vector<geom::Coordinate>& pts, const std::vector<geom::Coordinate>& nodePts)
+{
+    for (const auto& pt : nodePts) {
         HotPixel* hp = add(pt);
         hp->setToNode();
     }
+
+    /*
+    * Add the points to the tree in random order
+    * to avoid getting an unbalanced tree from
+    * spatially autocorrelated coordinates
+    */
+    std::vector<std::size_t> idxs(pts.size());
+    std::iota(idxs.begin(), idxs.end(), 0);
+
+    std::random_device rd;
+    std::mt19937 g(rd());
+    std::shuffle(idxs.begin(), idxs.end(), g);
+
+    for (auto i : idxs) {
+        add(pts[i]);
+    }
 }
 
 /*private*/
@@ -59,8 +59,12 @@ SnapRoundingIntersectionAdder::processIntersections(
                 // Take a copy of the intersection coordinate
                 intersections->emplace_back(li.getIntersection(intIndex));
             }
-            static_cast<NodedSegmentString*>(e0)->addIntersections(&li, segIndex0, 0);
-            static_cast<NodedSegmentString*>(e1)->addIntersections(&li, segIndex1, 1);
+            for (std::size_t intIndex = 0, intNum = li.getIntersectionNum(); intIndex < intNum; intIndex++) {
+                addNode(e0, li.getIntersection(intIndex), segIndex0);
+            }
+            for (std::size_t intIndex = 0, intNum = li.getIntersectionNum(); intIndex < intNum; intIndex++) {
+                addNode(e1, li.getIntersection(intIndex), segIndex1);
+            }
             return;
         }
     }
@@ -94,8 +98,31 @@ SnapRoundingIntersectionAdder::processNearVertex(
     double distSeg = algorithm::Distance::pointToSegment(p, p0, p1);
     if (distSeg < nearnessTol) {
         intersections->emplace_back(p);
-        static_cast<NodedSegmentString*>(edge)->addIntersection(p, segIndex);
+        addNode(edge, p, segIndex);
+    }
+}
+
+/*private*/
+void
+SnapRoundingIntersectionAdder::addNode(SegmentString* ss, const geom::Coordinate& pt, std::size_t segIndex)
+{
+    NodedSegmentString* nss = static_cast<NodedSegmentString*>(ss);
+    if (deferNodes) {
+        deferredNodes.push_back({nss, pt, segIndex});
+    }
+    else {
+        nss->addIntersection(pt, segIndex);
+    }
+}
+
+/*public*/
+void
+SnapRoundingIntersectionAdder::addDeferredNodes()
+{
+    for (const auto& node : deferredNodes) {
+        node.ss->addIntersection(node.pt, node.segIndex);
     }
+    deferredNodes.clear();
 }
 
 
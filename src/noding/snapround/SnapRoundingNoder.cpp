@@ -19,16 +19,24 @@
 #include <geos/index/kdtree/KdTree.h>
 #include <geos/index/kdtree/KdNode.h>
 #include <geos/index/kdtree/KdNodeVisitor.h>
+#include <geos/index/chain/MonotoneChain.h>
+#include <geos/index/chain/MonotoneChainBuilder.h>
+#include <geos/index/strtree/TemplateSTRtree.h>
 #include <geos/noding/SegmentString.h>
 #include <geos/noding/NodedSegmentString.h>
 #include <geos/noding/snapround/SnapRoundingNoder.h>
 #include <geos/noding/snapround/SnapRoundingIntersectionAdder.h>
+#include <geos/util.h>
+#include <geos/util/parallel.h>
 
 #include <algorithm> // for std::min and std::max
 #include <memory>
 
 using namespace geos::geom;
 using namespace geos::index::kdtree;
+using geos::index::chain::MonotoneChain;
+using geos::index::chain::MonotoneChainBuilder;
+using geos::index::strtree::TemplateSTRtree;
 
 namespace geos {
 namespace noding { // geos.noding
@@ -66,33 +74,108 @@ SnapRoundingNoder::snapRound(std::vector<SegmentString*>& inputSegStrings, std::
     * to avoid distorting the line arrangement
     * (rounding can cause vertices to move across edges).
     */
-    addIntersectionPixels(inputSegStrings);
-    addVertexPixels(inputSegStrings);
+    std::vector<Coordinate> intPts = findInteriorIntersections(inputSegStrings);
+    std::vector<Coordinate> vertexPts = getVertices(inputSegStrings);
+
+    /**
+    * Add all the hot pixels at once,
+    * so that the pixel index is bulk-loaded.
+    */
+    pixelIndex.add(vertexPts, intPts);
 
     computeSnaps(inputSegStrings, resultNodedSegments);
     return;
 }
 
 /*private*/
-void
-SnapRoundingNoder::addIntersectionPixels(std::vector<SegmentString*>& segStrings)
+std::vector<Coordinate>
+SnapRoundingNoder::findInteriorIntersections(std::vector<SegmentString*>& segStrings)
 {
     double tolerance = 1.0 / pm->getScale() / INTERSECTION_NEARNESS_FACTOR;
+    if (numThreads != 1) {
+        return findInteriorIntersectionsParallel(segStrings, tolerance);
+    }
+
     SnapRoundingIntersectionAdder intAdder(tolerance);
     MCIndexNoder noder(&intAdder, tolerance);
     noder.computeNodes(&segStrings);
     std::unique_ptr<std::vector<Coordinate>> intPts = intAdder.getIntersections();
-    pixelIndex.addNodes(*intPts);
+    return std::move(*intPts);
 }
 
-/*private void*/
-void
-SnapRoundingNoder::addVertexPixels(std::vector<SegmentString*>& segStrings)
+/*private*/
+std::vector<Coordinate>
+SnapRoundingNoder::findInteriorIntersectionsParallel(std::vector<SegmentString*>& segStrings, double tolerance)
 {
-    for (SegmentString* nss : segStrings) {
-        const CoordinateSequence* pts = nss->getCoordinates();
-        pixelIndex.add(pts);
+    /**
+    * Build the same chains and chain index as MCIndexNoder,
+    * so that chain pairs are compared in the same order.
+    */
+    std::vector<MonotoneChain> chains;
+    for (SegmentString* ss : segStrings) {
+        MonotoneChainBuilder::getChains(ss->getCoordinates(), ss, chains);
     }
+
+    TemplateSTRtree<const MonotoneChain*> chainIndex;
+    for (const MonotoneChain& mc : chains) {
+        chainIndex.insert(mc.getEnvelope(tolerance), &mc);
+    }
+    chainIndex.build();
+
+    /**
+    * Each block of chains is intersected with a separate adder,
+    * which records its nodes instead of adding them to the
+    * (shared) segment strings.
+    */
+    std::size_t numBlocks = (chains.size() + CHAIN_BLOCK_SIZE - 1) / CHAIN_BLOCK_SIZE;
+    std::vector<std::unique_ptr<SnapRoundingIntersectionAdder>> adders(numBlocks);
+
+    util::parallelFor(numBlocks, numThreads, [&](std::size_t block) {
+        auto intAdder = detail::make_unique<SnapRoundingIntersectionAdder>(tolerance);
+        intAdder->setDeferNodes(true);
+        MCIndexNoder::SegmentOverlapAction overlapAction(*intAdder);
+
+        std::size_t end = std::min(chains.size(), (block + 1) * CHAIN_BLOCK_SIZE);
+        for (std::size_t i = block * CHAIN_BLOCK_SIZE; i < end; i++) {
+            const MonotoneChain& queryChain = chains[i];
+            chainIndex.query(queryChain.getEnvelope(tolerance), [&queryChain, &overlapAction, tolerance](const MonotoneChain* testChain) {
+                // compare each pair of chains once, as MCIndexNoder does
+                if (testChain > &queryChain) {
+                    queryChain.computeOverlaps(testChain, tolerance, &overlapAction);
+                }
+            });
+        }
+
+        adders[block] = std::move(intAdder);
+    });
+
+    std::vector<Coordinate> intPts;
+    for (auto& intAdder : adders) {
+        intAdder->addDeferredNodes();
+        std::unique_ptr<std::vector<Coordinate>> blockPts = intAdder->getIntersections();
+        intPts.insert(intPts.end(), blockPts->begin(), blockPts->end());
+    }
+    return intPts;
+}
+
+/*private*/
+std::vector<Coordinate>
+SnapRoundingNoder::getVertices(const std::vector<SegmentString*>& segStrings)
+{
+    std::size_t numPts = 0;
+    for (const SegmentString* ss : segStrings) {
+        numPts += ss->size();
+    }
+
+    std::vector<Coordinate> pts;
+    pts.reserve(numPts);
+    for (const SegmentString* ss : segStrings) {
+        const CoordinateSequence* seq = ss->getCoordinates();
+        for (std::size_t i = 0, sz = seq->size(); i < sz; i++) {
+            pts.push_back(seq->getAt(i));
+        }
+    }
+    return pts;
 }
 
 /*private*/
@@ -111,8 +194,13 @@ SnapRoundingNoder::round(const std::vector<Coordinate>& pts) const
 void
 SnapRoundingNoder::computeSnaps(const std::vector<SegmentString*>& segStrings, std::vector<SegmentString*>& snapped)
 {
+    if (numThreads != 1) {
+        computeSnapsParallel(segStrings, snapped);
+        return;
+    }
+
     for (SegmentString* ss: segStrings) {
-        NodedSegmentString* snappedSS = computeSegmentSnaps(detail::down_cast<NodedSegmentString*>(ss));
+        NodedSegmentString* snappedSS = computeSegmentSnaps(detail::down_cast<NodedSegmentString*>(ss), nullptr);
         if (snappedSS != nullptr) {
             /**
              * Some intersection hot pixels may have been marked as nodes in the previous
@@ -128,17 +216,63 @@ SnapRoundingNoder::computeSnaps(const std::vector<SegmentString*>& segStrings, s
     return;
 }
 
+/*private*/
+void
+SnapRoundingNoder::computeSnapsParallel(const std::vector<SegmentString*>& segStrings, std::vector<SegmentString*>& snapped)
+{
+    struct SnapResult {
+        std::unique_ptr<NodedSegmentString> ss;
+        std::vector<PixelHit> hits;
+    };
+    std::vector<SnapResult> results(segStrings.size());
+
+    /**
+    * Round the segment strings and find the hot pixels their
+    * segments intersect. The hot pixels are not modified.
+    */
+    util::parallelFor(segStrings.size(), numThreads, [&](std::size_t i) {
+        SnapResult& result = results[i];
+        result.ss.reset(computeSegmentSnaps(detail::down_cast<NodedSegmentString*>(segStrings[i]), &result.hits));
+    }, 16);
+
+    /**
+    * Whether a pixel intersection is added as a node depends on
+    * whether the pixel has already been marked as a node, so
+    * the intersections are added in the same order as in serial mode.
+    */
+    for (SnapResult& result : results) {
+        if (result.ss == nullptr) {
+            continue;
+        }
+        for (const PixelHit& hit : result.hits) {
+            if (! hit.hp->isNode() && hit.containsVertex) {
+                continue;
+            }
+            result.ss->addIntersection(hit.hp->getCoordinate(), hit.segIndex);
+            hit.hp->setToNode();
+        }
+        snapped.push_back(result.ss.release());
+    }
+
+    // Now that all nodes are marked, the vertex nodes of each string can be added independently
+    util::parallelFor(snapped.size(), numThreads, [&snapped, this](std::size_t i) {
+        addVertexNodeSnaps(detail::down_cast<NodedSegmentString*>(snapped[i]));
+    }, 16);
+}
+
 /**
 * Add snapped vertices to a segment string.
 * If the segment string collapses completely due to rounding,
 * null is returned.
 *
 * @param ss the segment string to snap
+* @param hits if not null, the hot pixels intersected by each segment are
+*        recorded here instead of being snapped to
 * @return the snapped segment string, or null if it collapses completely
 */
 /*private*/
 NodedSegmentString*
-SnapRoundingNoder::computeSegmentSnaps(NodedSegmentString* ss)
+SnapRoundingNoder::computeSegmentSnaps(NodedSegmentString* ss, std::vector<PixelHit>* hits)
 {
     /**
     * Get edge coordinates, including added intersection nodes.
@@ -177,7 +311,7 @@ SnapRoundingNoder::computeSegmentSnaps(NodedSegmentString* ss)
         * (It is important to check original segment because rounding can
         * move it enough to intersect other hot pixels not intersecting original segment)
         */
-        snapSegment(p0, p1, snapSS, snapSSindex);
+        snapSegment(p0, p1, snapSS, snapSSindex, hits);
         snapSSindex++;
     }
     return snapSS;
@@ -190,10 +324,11 @@ SnapRoundingNoder::computeSegmentSnaps(NodedSegmentString* ss)
 * @param p1 the segment end coordinate
 * @param ss the segment string to add intersections to
 * @param segIndex the index of the segment
+* @param hits if not null, the intersected hot pixels are recorded here
 */
 /*private*/
 void
-SnapRoundingNoder::snapSegment(Coordinate& p0, Coordinate& p1, NodedSegmentString* ss, std::size_t segIndex)
+SnapRoundingNoder::snapSegment(Coordinate& p0, Coordinate& p1, NodedSegmentString* ss, std::size_t segIndex, std::vector<PixelHit>* hits)
 {
     /* First define a visitor to use in the pixelIndex.query() */
     struct SnapRoundingVisitor : KdNodeVisitor {
@@ -201,12 +336,25 @@ SnapRoundingNoder::snapSegment(Coordinate& p0, Coordinate& p1, NodedSegmentStrin
         const Coordinate& p1;
         NodedSegmentString* ss;
         std::size_t segIndex;
+        std::vector<PixelHit>* hits;
 
-        SnapRoundingVisitor(const Coordinate& pp0, const Coordinate& pp1, NodedSegmentString* pss, std::size_t psegIndex)
-            : p0(pp0), p1(pp1), ss(pss), segIndex(psegIndex) {};
+        SnapRoundingVisitor(const Coordinate& pp0, const Coordinate& pp1, NodedSegmentString* pss, std::size_t psegIndex, std::vector<PixelHit>* phits)
+            : p0(pp0), p1(pp1), ss(pss), segIndex(psegIndex), hits(phits) {};
 
         void visit(KdNode* node) override {
             HotPixel* hp = static_cast<HotPixel*>(node->getData());
+
+            /**
+            * When recording, the decision is left to computeSnapsParallel,
+            * since the node status of the pixel may still change.
+            */
+            if (hits != nullptr) {
+                if (hp->intersects(p0, p1)) {
+                    hits->push_back({segIndex, hp, hp->intersects(p0) || hp->intersects(p1)});
+                }
+                return;
+            }
+
             /**
             * If the hot pixel is not a node, and it contains one of the segment vertices,
             * then that vertex is the source for the hot pixel.
@@ -232,7 +380,7 @@ SnapRoundingNoder::snapSegment(Coordinate& p0, Coordinate& p1, NodedSegmentStrin
     };
 
     /* Then run the query with the visitor */
-    SnapRoundingVisitor srv(p0, p1, ss, segIndex);
+    SnapRoundingVisitor srv(p0, p1, ss, segIndex, hits);
     pixelIndex.query(p0, p1, srv);
 }
 
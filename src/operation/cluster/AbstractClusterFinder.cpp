@@ -16,10 +16,14 @@
 #include <geos/geom/Geometry.h>
 #include <geos/geom/GeometryCollection.h>
 #include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Point.h>
 #include <geos/geom/prep/PreparedGeometry.h>
 
 #include <geos/util.h>
+#include <geos/util/parallel.h>
 #include <geos/index/strtree/TemplateSTRtree.h>
+#include <geos/operation/cluster/ConcurrentUnionFind.h>
+#include <geos/operation/cluster/PointGrid.h>
 #include <geos/operation/cluster/UnionFind.h>
 
 namespace geos {
@@ -46,14 +50,46 @@ AbstractClusterFinder::clusterToCollection(const geom::Geometry & g) {
 }
 
 
+static bool
+getPointCoordinates(const std::vector<const geom::Geometry*> & components,
+                    std::vector<geom::CoordinateXY> & pts) {
+    pts.reserve(components.size());
+
+    for (const auto* g : components) {
+        if (g->getGeometryTypeId() != geom::GEOS_POINT || g->isEmpty()) {
+            return false;
+        }
+        pts.push_back(*detail::down_cast<const geom::Point*>(g)->getCoordinate());
+    }
+
+    return true;
+}
+
 Clusters
 AbstractClusterFinder::cluster(const std::vector<const geom::Geometry*> & components) {
+    double pointDistance = pointClusterDistance();
+    if (pointDistance >= 0) {
+        std::vector<geom::CoordinateXY> pts;
+        if (getPointCoordinates(components, pts) && PointGrid::isApplicable(pts, pointDistance)) {
+            PointGrid grid(pts, pointDistance);
+            ConcurrentUnionFind uf(pts.size());
+            return processPoints(grid, uf, m_numThreads);
+        }
+    }
+
     index::strtree::TemplateSTRtree<std::size_t> tree;
 
     for (std::size_t i = 0; i < components.size(); i++) {
         tree.insert(*components[i]->getEnvelopeInternal(), i);
     }
 
+    if (m_numThreads != 1) {
+        tree.build();
+
+        ConcurrentUnionFind uf(components.size());
+        return processParallel(components, tree, uf, m_numThreads);
+    }
+
     UnionFind uf(components.size());
     return process(components, tree, uf);
 }
@@ -119,6 +155,68 @@ AbstractClusterFinder::process(const std::vector<const Geometry*> & components,
     return uf.getClusters();
 }
 
+Clusters
+AbstractClusterFinder::processParallel(const std::vector<const Geometry*> & components,
+                                       index::strtree::TemplateSTRtree<std::size_t> & tree,
+                                       ConcurrentUnionFind & uf,
+                                       std::size_t numThreads) {
+
+    if (!cloneFinder()) {
+        UnionFind serialUf(components.size());
+        return process(components, tree, serialUf);
+    }
+
+    // Each block of components is processed with its own finder, so that
+    // any state cached by queryEnvelope and shouldJoin is not shared.
+    const std::size_t blockSize = 256;
+    std::size_t numBlocks = (components.size() + blockSize - 1) / blockSize;
+
+    util::parallelFor(numBlocks, numThreads, [&](std::size_t block) {
+        auto finder = cloneFinder();
+        std::vector<size_t> hits;
+
+        std::size_t end = std::min(components.size(), (block + 1) * blockSize);
+        for (std::size_t i = block * blockSize; i < end; i++) {
+            const geom::Geometry* gi = components[i];
+
+            hits.clear();
+
+            tree.query(finder->queryEnvelope(gi), hits);
+            std::sort(hits.begin(), hits.end(), [&components](std::size_t a, std::size_t b) {
+                return components[a]->getEnvelopeInternal()->getArea() < components[b]->getEnvelopeInternal()->getArea();
+            });
+
+            for (std::size_t j : hits) {
+                if (uf.different(i, j)) {
+                    const geom::Geometry* gj = components[j];
+
+                    if (finder->shouldJoin(gi, gj)) {
+                        uf.join(i, j);
+                    }
+                }
+            }
+        }
+    });
+
+    return uf.getClusters();
+}
+
+Clusters
+AbstractClusterFinder::processPoints(const PointGrid & grid,
+                                     ConcurrentUnionFind & uf,
+                                     std::size_t numThreads) {
+
+    util::parallelFor(grid.size(), numThreads, [&grid, &uf](std::size_t i) {
+        grid.visitNeighbors(i, [&uf, i](std::size_t j) {
+            if (j > i) {
+                uf.join(i, j);
+            }
+        });
+    }, 1024);
+
+    return uf.getClusters();
+}
+
 std::vector<std::unique_ptr<Geometry>>
 AbstractClusterFinder::getComponents(std::unique_ptr<Geometry>&& g)
 {
@@ -13,6 +13,7 @@
  **********************************************************************/
 
 #include <geos/operation/cluster/Clusters.h>
+#include <geos/operation/cluster/ConcurrentUnionFind.h>
 #include <geos/operation/cluster/UnionFind.h>
 
 namespace geos {
@@ -23,6 +24,19 @@ Clusters::Clusters(UnionFind & uf, std::vector<std::size_t> elemsInCluster, size
     m_elemsInCluster = std::move(elemsInCluster);
     m_numElems = numElems;
 
+    groupByCluster(uf);
+}
+
+Clusters::Clusters(ConcurrentUnionFind & uf, std::vector<std::size_t> elemsInCluster, size_t numElems) {
+    m_elemsInCluster = std::move(elemsInCluster);
+    m_numElems = numElems;
+
+    groupByCluster(uf);
+}
+
+template<typename UF>
+void
+Clusters::groupByCluster(UF & uf) {
     if (!m_elemsInCluster.empty()) {
         uf.sortByCluster(m_elemsInCluster.begin(), m_elemsInCluster.end());
 
@@ -0,0 +1,36 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/operation/cluster/ConcurrentUnionFind.h>
+
+#include <numeric>
+
+namespace geos {
+namespace operation {
+namespace cluster {
+
+Clusters ConcurrentUnionFind::getClusters() {
+    std::vector<size_t> elems(numElems);
+    std::iota(elems.begin(), elems.end(), 0);
+
+    return Clusters(*this, std::move(elems), numElems);
+}
+
+Clusters ConcurrentUnionFind::getClusters(std::vector<size_t> elems) {
+    return Clusters(*this, std::move(elems), numElems);
+}
+
+}
+}
+}
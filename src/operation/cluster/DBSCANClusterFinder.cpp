@@ -16,7 +16,13 @@
 #include <geos/geom/Geometry.h>
 #include <geos/geom/prep/PreparedGeometry.h>
 #include <geos/geom/prep/PreparedGeometryFactory.h>
+#include <geos/operation/cluster/ConcurrentUnionFind.h>
+#include <geos/operation/cluster/PointGrid.h>
 #include <geos/operation/cluster/UnionFind.h>
+#include <geos/util/parallel.h>
+
+#include <atomic>
+#include <limits>
 
 namespace geos {
 namespace operation {
@@ -128,6 +134,179 @@ Clusters DBSCANClusterFinder::process(const std::vector<const geom::Geometry*> &
 }
 
 
+
+/*
+ * The parallel version runs in three passes over the components:
+ *
+ * 1. Identify core points, by counting neighbors until minPoints is reached.
+ * 2. Join each core point with its core neighbors, and record for each
+ *    non-core neighbor the lowest-numbered core point that reaches it.
+ * 3. Join each border point to the core point that claimed it.
+ *
+ * The serial algorithm assigns a border point to the cluster of the first
+ * core point (in input order) that reaches it, which is exactly what
+ * pass 2 records, so both produce the same clusters.
+ */
+Clusters DBSCANClusterFinder::processParallel(const std::vector<const geom::Geometry*> & components,
+                                              index::strtree::TemplateSTRtree<std::size_t> & tree,
+                                              ConcurrentUnionFind & uf,
+                                              std::size_t numThreads) {
+
+    const std::size_t n = components.size();
+    const std::size_t grainSize = 64;
+    const std::size_t unclaimed = std::numeric_limits<std::size_t>::max();
+
+    auto queryEnv = [this](const geom::Geometry* g) {
+        geom::Envelope env = *g->getEnvelopeInternal();
+        env.expandBy(m_eps);
+        return env;
+    };
+
+    std::vector<char> is_core(n);
+
+    util::parallelFor(n, numThreads, [&](std::size_t p) {
+        const geom::Geometry* gp = components[p];
+        std::vector<size_t> hits;
+        tree.query(queryEnv(gp), hits);
+
+        if (hits.size() < m_minPoints) {
+            return;
+        }
+
+        std::unique_ptr<geom::prep::PreparedGeometry> prep;
+        std::size_t numNeighbors = 0;
+        for (size_t q : hits) {
+            if (q != p) {
+                if (!prep) {
+                    prep = geom::prep::PreparedGeometryFactory::prepare(gp);
+                }
+                if (prep->distance(components[q]) > m_eps) {
+                    continue;
+                }
+            }
+            if (++numNeighbors >= m_minPoints) {
+                is_core[p] = true;
+                return;
+            }
+        }
+    }, grainSize);
+
+    std::unique_ptr<std::atomic<std::size_t>[]> claimedBy(new std::atomic<std::size_t>[n]);
+    for (std::size_t i = 0; i < n; i++) {
+        claimedBy[i].store(unclaimed, std::memory_order_relaxed);
+    }
+
+    util::parallelFor(n, numThreads, [&](std::size_t p) {
+        if (!is_core[p]) {
+            return;
+        }
+
+        const geom::Geometry* gp = components[p];
+        std::vector<size_t> hits;
+        tree.query(queryEnv(gp), hits);
+
+        std::unique_ptr<geom::prep::PreparedGeometry> prep;
+        for (size_t q : hits) {
+            if (q == p) {
+                continue;
+            }
+
+            if (is_core[q]) {
+                // Core pairs are symmetric; let the lower-numbered point join them.
+                if (q < p || uf.same(p, q)) {
+                    continue;
+                }
+            } else if (claimedBy[q].load(std::memory_order_relaxed) < p) {
+                continue;
+            }
+
+            if (!prep) {
+                prep = geom::prep::PreparedGeometryFactory::prepare(gp);
+            }
+            if (prep->distance(components[q]) > m_eps) {
+                continue;
+            }
+
+            if (is_core[q]) {
+                uf.join(p, q);
+            } else {
+                auto current = claimedBy[q].load(std::memory_order_relaxed);
+                while (p < current && !claimedBy[q].compare_exchange_weak(current, p)) {}
+            }
+        }
+    }, grainSize);
+
+    std::vector<size_t> includedInCluster;
+    includedInCluster.reserve(n);
+    for (size_t p = 0; p < n; p++) {
+        auto claim = claimedBy[p].load(std::memory_order_relaxed);
+        if (is_core[p]) {
+            includedInCluster.push_back(p);
+        } else if (claim != unclaimed) {
+            uf.join(p, claim);
+            includedInCluster.push_back(p);
+        }
+    }
+
+    return uf.getClusters(includedInCluster);
+}
+
+
+Clusters DBSCANClusterFinder::processPoints(const PointGrid & grid,
+                                            ConcurrentUnionFind & uf,
+                                            std::size_t numThreads) {
+
+    // Same passes as processParallel, with neighbors taken from the grid.
+    const std::size_t n = grid.size();
+    const std::size_t unclaimed = std::numeric_limits<std::size_t>::max();
+
+    std::vector<char> is_core(n);
+    util::parallelFor(n, numThreads, [&](std::size_t p) {
+        std::size_t numNeighbors = 0;
+        grid.visitNeighbors(p, [&numNeighbors](std::size_t) {
+            numNeighbors++;
+        });
+        is_core[p] = numNeighbors >= m_minPoints;
+    }, 1024);
+
+    std::unique_ptr<std::atomic<std::size_t>[]> claimedBy(new std::atomic<std::size_t>[n]);
+    for (std::size_t i = 0; i < n; i++) {
+        claimedBy[i].store(unclaimed, std::memory_order_relaxed);
+    }
+
+    util::parallelFor(n, numThreads, [&](std::size_t p) {
+        if (!is_core[p]) {
+            return;
+        }
+
+        grid.visitNeighbors(p, [&](std::size_t q) {
+            if (is_core[q]) {
+                if (q > p) {
+                    uf.join(p, q);
+                }
+            } else {
+                auto current = claimedBy[q].load(std::memory_order_relaxed);
+                while (p < current && !claimedBy[q].compare_exchange_weak(current, p)) {}
+            }
+        });
+    }, 1024);
+
+    std::vector<size_t> includedInCluster;
+    includedInCluster.reserve(n);
+    for (size_t p = 0; p < n; p++) {
+        auto claim = claimedBy[p].load(std::memory_order_relaxed);
+        if (is_core[p]) {
+            includedInCluster.push_back(p);
+        } else if (claim != unclaimed) {
+            uf.join(p, claim);
+            includedInCluster.push_back(p);
+        }
+    }
+
+    return uf.getClusters(includedInCluster);
+}
+
+
 }
 }
 }
@@ -0,0 +1,112 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/operation/cluster/PointGrid.h>
+#include <geos/geom/Envelope.h>
+
+#include <algorithm>
+#include <numeric>
+
+namespace geos {
+namespace operation {
+namespace cluster {
+
+// Cells are made slightly wider than the clustering distance so that two
+// points within that distance can never be assigned to cells two apart
+// because of rounding in the cell computation.
+static constexpr double CELL_SIZE_FACTOR = 1 + 1e-9;
+
+// Largest number of cells allowed along either axis, keeping cell
+// coordinates well within the range in which doubles are exact.
+static constexpr double MAX_CELLS = 1e15;
+
+static geom::Envelope
+extent(const std::vector<geom::CoordinateXY>& pts)
+{
+    geom::Envelope env;
+    for (const auto& p : pts) {
+        env.expandToInclude(p);
+    }
+    return env;
+}
+
+bool
+PointGrid::isApplicable(const std::vector<geom::CoordinateXY>& pts, double distance)
+{
+    if (!(distance > 0) || !std::isfinite(distance)) {
+        return false;
+    }
+
+    for (const auto& p : pts) {
+        if (!std::isfinite(p.x) || !std::isfinite(p.y)) {
+            return false;
+        }
+    }
+
+    geom::Envelope env = extent(pts);
+    if (env.isNull()) {
+        return true;
+    }
+
+    double cellSize = distance * CELL_SIZE_FACTOR;
+    return env.getWidth() / cellSize < MAX_CELLS && env.getHeight() / cellSize < MAX_CELLS;
+}
+
+PointGrid::PointGrid(const std::vector<geom::CoordinateXY>& pts, double distance) :
+    m_pts(pts),
+    m_distance(distance),
+    m_distSqLow(distance * distance * (1 - 4 * std::numeric_limits<double>::epsilon())),
+    m_distSqHigh(distance * distance * (1 + 4 * std::numeric_limits<double>::epsilon())),
+    m_cellSize(distance * CELL_SIZE_FACTOR),
+    m_originX(0),
+    m_originY(0)
+{
+    geom::Envelope env = extent(pts);
+    if (!env.isNull()) {
+        m_originX = env.getMinX();
+        m_originY = env.getMinY();
+    }
+
+    std::vector<CellKey> keys;
+    keys.reserve(pts.size());
+    for (const auto& p : pts) {
+        keys.push_back(CellKey{cellX(p.x), cellY(p.y)});
+    }
+
+    m_order.resize(pts.size());
+    std::iota(m_order.begin(), m_order.end(), 0);
+    std::sort(m_order.begin(), m_order.end(), [&keys](std::size_t a, std::size_t b) {
+        const auto& ka = keys[a];
+        const auto& kb = keys[b];
+        if (ka.x != kb.x) {
+            return ka.x < kb.x;
+        }
+        if (ka.y != kb.y) {
+            return ka.y < kb.y;
+        }
+        return a < b;
+    });
+
+    std::size_t start = 0;
+    for (std::size_t k = 1; k <= m_order.size(); k++) {
+        if (k == m_order.size() || !(keys[m_order[k]] == keys[m_order[start]])) {
+            m_cells.emplace(keys[m_order[start]], std::make_pair(start, k));
+            start = k;
+        }
+    }
+}
+
+}
+}
+}
@@ -17,9 +17,12 @@
  **********************************************************************/
 
 #include <geos/geom/Coordinate.h>
+#include <geos/geom/FixedSizeCoordinateSequence.h>
 #include <geos/index/strtree/STRtree.h>
 #include <geos/operation/distance/IndexedFacetDistance.h>
 
+#include <limits>
+
 using namespace geos::geom;
 using namespace geos::index::strtree;
 
@@ -56,6 +59,63 @@ IndexedFacetDistance::distance(const Geometry* g) const
     return nearest.first->distance(*nearest.second);
 }
 
+/**
+* Finds the distance from a point to the nearest facet below a tree node,
+* skipping nodes which are farther than the nearest facet found so far.
+* The nearest child is searched first, so that the others
+* are more likely to be skipped.
+*/
+static void
+nearestFacetDistance(const TemplateSTRtree<const FacetSequence*>::Node& node,
+                     const FacetSequence& ptFacet, const Envelope& ptEnv, double& minDist)
+{
+    if (node.isLeaf()) {
+        double dist = node.getItem()->distance(ptFacet);
+        if (dist < minDist) {
+            minDist = dist;
+        }
+        return;
+    }
+
+    const TemplateSTRtree<const FacetSequence*>::Node* nearestChild = nullptr;
+    double nearestDistSq = std::numeric_limits<double>::infinity();
+    for (auto* child = node.beginChildren(); child < node.endChildren(); ++child) {
+        double distSq = child->getBounds().distanceSquared(ptEnv);
+        if (distSq < nearestDistSq) {
+            nearestDistSq = distSq;
+            nearestChild = child;
+        }
+    }
+    if (nearestChild == nullptr) {
+        return;
+    }
+    nearestFacetDistance(*nearestChild, ptFacet, ptEnv, minDist);
+
+    for (auto* child = node.beginChildren(); child < node.endChildren(); ++child) {
+        if (child != nearestChild
+                && child->getBounds().distanceSquared(ptEnv) < minDist * minDist) {
+            nearestFacetDistance(*child, ptFacet, ptEnv, minDist);
+        }
+    }
+}
+
+double
+IndexedFacetDistance::distance(const CoordinateXY& pt) const
+{
+    const auto* root = cachedTree->getRoot();
+    if (!root) {
+        throw util::GEOSException("Cannot calculate IndexedFacetDistance on empty geometries.");
+    }
+
+    FixedSizeCoordinateSequence<1> seq;
+    seq.setAt(Coordinate(pt), 0);
+    FacetSequence ptFacet(&seq, 0, 1);
+
+    double minDist = std::numeric_limits<double>::infinity();
+    nearestFacetDistance(*root, ptFacet, *ptFacet.getEnvelope(), minDist);
+    return minDist;
+}
+
 bool
 IndexedFacetDistance::isWithinDistance(const Geometry* g, double maxDistance) const
 {
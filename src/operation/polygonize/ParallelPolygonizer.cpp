@@ -0,0 +1,881 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/operation/polygonize/ParallelPolygonizer.h>
+#include <geos/algorithm/Orientation.h>
+#include <geos/algorithm/locate/IndexedPointInAreaLocator.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/Location.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/Quadrant.h>
+#include <geos/geom/util/LinearComponentExtracter.h>
+#include <geos/index/strtree/TemplateSTRtree.h>
+#include <geos/util.h>
+#include <geos/util/Interrupt.h>
+#include <geos/util/parallel.h>
+
+#include <algorithm>
+#include <limits>
+#include <mutex>
+
+using geos::algorithm::Orientation;
+using geos::algorithm::locate::IndexedPointInAreaLocator;
+using geos::geom::Coordinate;
+using geos::geom::CoordinateArraySequence;
+using geos::geom::CoordinateSequence;
+using geos::geom::CoordinateXY;
+using geos::geom::Envelope;
+using geos::geom::Geometry;
+using geos::geom::LinearRing;
+using geos::geom::LineString;
+using geos::geom::Location;
+using geos::geom::Polygon;
+using geos::geom::Quadrant;
+using geos::index::strtree::TemplateSTRtree;
+
+namespace geos {
+namespace operation { // geos.operation
+namespace polygonize { // geos.operation.polygonize
+
+static constexpr std::size_t NONE = std::numeric_limits<std::size_t>::max();
+
+static bool
+lessThanXY(const CoordinateXY& a, const CoordinateXY& b)
+{
+    if (a.x < b.x) {
+        return true;
+    }
+    if (a.x > b.x) {
+        return false;
+    }
+    return a.y < b.y;
+}
+
+ParallelPolygonizer::ParallelPolygonizer(bool onlyPolygonal)
+    : extractOnlyPolygonal(onlyPolygonal)
+    , computed(false)
+    , numThreads(1)
+    , factory(nullptr)
+{
+}
+
+ParallelPolygonizer::~ParallelPolygonizer() = default;
+
+/* public */
+void
+ParallelPolygonizer::add(const std::vector<const Geometry*>& geomList)
+{
+    for (const Geometry* g : geomList) {
+        add(g);
+    }
+}
+
+/* public */
+void
+ParallelPolygonizer::add(const Geometry* g)
+{
+    std::vector<const LineString*> lines;
+    geom::util::LinearComponentExtracter::getLines(*g, lines);
+    for (const LineString* line : lines) {
+        addLine(line);
+    }
+}
+
+/* public */
+void
+ParallelPolygonizer::setNumThreads(std::size_t p_numThreads)
+{
+    numThreads = p_numThreads;
+}
+
+/**
+* Adds a line as an edge of the graph. As in PolygonizeGraph, repeated
+* points are ignored, so the direction of each half-edge is given by
+* the first point of the line which differs from its origin.
+*/
+/* private */
+void
+ParallelPolygonizer::addLine(const LineString* line)
+{
+    if (factory == nullptr) {
+        factory = line->getFactory();
+    }
+    const CoordinateSequence* pts = line->getCoordinatesRO();
+    std::size_t n = pts->size();
+    if (n < 2) {
+        return;
+    }
+
+    const Coordinate& startPt = pts->getAt(0);
+    std::size_t i = 1;
+    while (i < n && pts->getAt(i).equals2D(startPt)) {
+        i++;
+    }
+    if (i == n) {
+        return;
+    }
+    const Coordinate& endPt = pts->getAt(n - 1);
+    std::size_t j = n - 2;
+    while (pts->getAt(j).equals2D(endPt)) {
+        j--;
+    }
+
+    edgeLines.push_back(line);
+    edgeDirPts.emplace_back(pts->getAt(i));
+    edgeDirPts.emplace_back(pts->getAt(j));
+}
+
+/* public */
+std::vector<std::unique_ptr<Polygon>>
+ParallelPolygonizer::getPolygons()
+{
+    polygonize();
+    return std::move(polyList);
+}
+
+/* public */
+const std::vector<const LineString*>&
+ParallelPolygonizer::getDangles()
+{
+    polygonize();
+    return dangles;
+}
+
+/* public */
+const std::vector<const LineString*>&
+ParallelPolygonizer::getCutEdges()
+{
+    polygonize();
+    return cutEdges;
+}
+
+/* public */
+const std::vector<std::unique_ptr<LineString>>&
+ParallelPolygonizer::getInvalidRingLines()
+{
+    polygonize();
+    return invalidRingLines;
+}
+
+/* private */
+void
+ParallelPolygonizer::polygonize()
+{
+    if (computed) {
+        return;
+    }
+    computed = true;
+    if (edgeLines.empty()) {
+        return;
+    }
+
+    buildGraph();
+    GEOS_CHECK_FOR_INTERRUPTS();
+
+    //-- find the connected components of the graph
+    std::size_t numNodes = nodeStarStart.size() - 1;
+    std::vector<std::size_t> parent(numNodes);
+    for (std::size_t i = 0; i < numNodes; i++) {
+        parent[i] = i;
+    }
+    auto findRoot = [&parent](std::size_t i) {
+        while (parent[i] != i) {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    };
+    for (std::size_t e = 0; e < edgeLines.size(); e++) {
+        std::size_t r0 = findRoot(halfEdgeNode[2 * e]);
+        std::size_t r1 = findRoot(halfEdgeNode[2 * e + 1]);
+        if (r0 != r1) {
+            parent[std::max(r0, r1)] = std::min(r0, r1);
+        }
+    }
+    std::vector<std::size_t> nodeComponent(numNodes);
+    std::size_t numComponents = 0;
+    for (std::size_t i = 0; i < numNodes; i++) {
+        std::size_t root = findRoot(i);
+        nodeComponent[i] = root == i ? numComponents++ : nodeComponent[root];
+    }
+    parent.clear();
+    parent.shrink_to_fit();
+
+    std::vector<std::vector<std::size_t>> componentNodes(numComponents);
+    for (std::size_t i = 0; i < numNodes; i++) {
+        componentNodes[nodeComponent[i]].push_back(i);
+    }
+    std::vector<std::vector<std::size_t>> componentHalfEdges(numComponents);
+    for (std::size_t he = 0; he < halfEdgeNode.size(); he++) {
+        componentHalfEdges[nodeComponent[halfEdgeNode[he]]].push_back(he);
+    }
+    nodeComponent.clear();
+    nodeComponent.shrink_to_fit();
+
+    //-- the components share no nodes or edges, so they are processed independently
+    std::vector<std::vector<std::size_t>> componentRings(numComponents);
+    util::parallelFor(numComponents, numThreads, [&](std::size_t i) {
+        componentRings[i] = processComponent(componentNodes[i], componentHalfEdges[i]);
+        componentNodes[i].clear();
+        componentNodes[i].shrink_to_fit();
+        componentHalfEdges[i].clear();
+        componentHalfEdges[i].shrink_to_fit();
+    }, 16);
+    componentNodes.clear();
+    componentHalfEdges.clear();
+    GEOS_CHECK_FOR_INTERRUPTS();
+
+    for (std::size_t e = 0; e < edgeLines.size(); e++) {
+        if (isDangle[e]) {
+            dangles.push_back(edgeLines[e]);
+        }
+        else if (isCutEdge[e]) {
+            cutEdges.push_back(edgeLines[e]);
+        }
+    }
+
+    //-- rings are ordered as PolygonizeGraph finds them
+    std::vector<std::size_t> ringStarts;
+    for (auto& starts : componentRings) {
+        ringStarts.insert(ringStarts.end(), starts.begin(), starts.end());
+    }
+    componentRings.clear();
+    std::sort(ringStarts.begin(), ringStarts.end());
+
+    rings.resize(ringStarts.size());
+    for (std::size_t i = 0; i < rings.size(); i++) {
+        rings[i].start = ringStarts[i];
+        rings[i].shell = NONE;
+    }
+
+    util::parallelFor(rings.size(), numThreads, [&](std::size_t i) {
+        buildRing(rings[i]);
+    }, 16);
+    GEOS_CHECK_FOR_INTERRUPTS();
+
+    std::vector<std::size_t> shells;
+    std::vector<std::size_t> holes;
+    for (std::size_t i = 0; i < rings.size(); i++) {
+        Ring& ring = rings[i];
+        if (ring.invalidLine) {
+            invalidRingLines.push_back(std::move(ring.invalidLine));
+        }
+        else if (ring.isHole) {
+            holes.push_back(i);
+        }
+        else {
+            shells.push_back(i);
+        }
+    }
+
+    //-- assign holes to shells, as in HoleAssigner
+    if (!shells.empty() && !holes.empty()) {
+        TemplateSTRtree<std::size_t> shellIndex;
+        for (std::size_t i : shells) {
+            shellIndex.insert(*rings[i].ring->getEnvelopeInternal(), i);
+        }
+        shellIndex.build();
+
+        std::unique_ptr<std::once_flag[]> isShellPrepared(new std::once_flag[rings.size()]);
+        std::vector<std::size_t> holeShells(holes.size());
+        util::parallelFor(holes.size(), numThreads, [&](std::size_t i) {
+            const Ring& hole = rings[holes[i]];
+            const Envelope* holeEnv = hole.ring->getEnvelopeInternal();
+            std::vector<std::size_t> candidates;
+            shellIndex.query(*holeEnv, [&](std::size_t j) {
+                const Envelope* shellEnv = rings[j].ring->getEnvelopeInternal();
+                // the hole envelope cannot equal the shell envelope,
+                // and must be contained in it
+                if (!shellEnv->equals(holeEnv) && shellEnv->contains(holeEnv)) {
+                    candidates.push_back(j);
+                }
+            });
+            for (std::size_t j : candidates) {
+                std::call_once(isShellPrepared[j], [this, j]() {
+                    prepareShell(rings[j]);
+                });
+            }
+            holeShells[i] = findShellContaining(hole, candidates);
+        }, 16);
+
+        for (std::size_t i = 0; i < holes.size(); i++) {
+            if (holeShells[i] != NONE) {
+                rings[holeShells[i]].holes.push_back(holes[i]);
+                rings[holes[i]].shell = holeShells[i];
+            }
+        }
+    }
+    GEOS_CHECK_FOR_INTERRUPTS();
+
+    bool includeAll = true;
+    if (extractOnlyPolygonal) {
+        findDisjointShells(shells);
+        includeAll = false;
+    }
+
+    std::vector<std::size_t> polyShells;
+    for (std::size_t i : shells) {
+        if (includeAll || rings[i].isIncluded) {
+            polyShells.push_back(i);
+        }
+    }
+    polyList.resize(polyShells.size());
+    util::parallelFor(polyShells.size(), numThreads, [&](std::size_t i) {
+        Ring& shell = rings[polyShells[i]];
+        std::vector<std::unique_ptr<LinearRing>> holeRings;
+        holeRings.reserve(shell.holes.size());
+        for (std::size_t j : shell.holes) {
+            holeRings.push_back(std::move(rings[j].ring));
+        }
+        polyList[i] = factory->createPolygon(std::move(shell.ring), std::move(holeRings));
+    }, 16);
+
+    //-- release the graph
+    rings.clear();
+    rings.shrink_to_fit();
+    nodeStarStart.clear();
+    nodeStarStart.shrink_to_fit();
+    nodeStar.clear();
+    nodeStar.shrink_to_fit();
+    halfEdgeNode.clear();
+    halfEdgeNode.shrink_to_fit();
+    halfEdgeNext.clear();
+    halfEdgeNext.shrink_to_fit();
+    halfEdgeLabel.clear();
+    halfEdgeLabel.shrink_to_fit();
+    halfEdgeMarked.clear();
+    halfEdgeMarked.shrink_to_fit();
+    nodeDegree.clear();
+    nodeDegree.shrink_to_fit();
+    isDangle.clear();
+    isDangle.shrink_to_fit();
+    isCutEdge.clear();
+    isCutEdge.shrink_to_fit();
+}
+
+/**
+* Builds the nodes of the graph and sorts the out half-edges of each node
+* in CCW order. The half-edges of a node are sorted with the same
+* algorithm, comparison and initial order as in DirectedEdgeStar,
+* so that they are ordered identically even if some are collinear.
+*/
+/* private */
+void
+ParallelPolygonizer::buildGraph()
+{
+    std::size_t numHalfEdges = 2 * edgeLines.size();
+
+    struct EndPoint {
+        CoordinateXY pt;
+        std::size_t halfEdge;
+    };
+    std::vector<EndPoint> endPts(numHalfEdges);
+    for (std::size_t e = 0; e < edgeLines.size(); e++) {
+        const CoordinateSequence* pts = edgeLines[e]->getCoordinatesRO();
+        endPts[2 * e] = { pts->getAt(0), 2 * e };
+        endPts[2 * e + 1] = { pts->getAt(pts->size() - 1), 2 * e + 1 };
+    }
+    std::sort(endPts.begin(), endPts.end(), [](const EndPoint& a, const EndPoint& b) {
+        if (lessThanXY(a.pt, b.pt)) {
+            return true;
+        }
+        if (lessThanXY(b.pt, a.pt)) {
+            return false;
+        }
+        return a.halfEdge < b.halfEdge;
+    });
+
+    halfEdgeNode.resize(numHalfEdges);
+    for (std::size_t i = 0; i < numHalfEdges; i++) {
+        if (i == 0 || lessThanXY(endPts[i - 1].pt, endPts[i].pt)) {
+            nodePts.push_back(endPts[i].pt);
+        }
+        halfEdgeNode[endPts[i].halfEdge] = nodePts.size() - 1;
+    }
+    endPts.clear();
+    endPts.shrink_to_fit();
+
+    //-- node stars, with the half-edges in the order they were added
+    std::size_t numNodes = nodePts.size();
+    nodeStarStart.assign(numNodes + 1, 0);
+    for (std::size_t he = 0; he < numHalfEdges; he++) {
+        nodeStarStart[halfEdgeNode[he] + 1]++;
+    }
+    for (std::size_t i = 0; i < numNodes; i++) {
+        nodeStarStart[i + 1] += nodeStarStart[i];
+    }
+    nodeStar.resize(numHalfEdges);
+    std::vector<std::size_t> starSize(numNodes, 0);
+    for (std::size_t he = 0; he < numHalfEdges; he++) {
+        std::size_t node = halfEdgeNode[he];
+        nodeStar[nodeStarStart[node] + starSize[node]++] = he;
+    }
+    starSize.clear();
+    starSize.shrink_to_fit();
+
+    util::parallelFor(numNodes, numThreads, [this](std::size_t node) {
+        const CoordinateXY& p0 = nodePts[node];
+        auto compareDirection = [this, &p0](std::size_t he0, std::size_t he1) {
+            const CoordinateXY& p1 = edgeDirPts[he0];
+            const CoordinateXY& q1 = edgeDirPts[he1];
+            int quadrant0 = Quadrant::quadrant(p1.x - p0.x, p1.y - p0.y);
+            int quadrant1 = Quadrant::quadrant(q1.x - p0.x, q1.y - p0.y);
+            if (quadrant0 != quadrant1) {
+                return quadrant0 < quadrant1;
+            }
+            return Orientation::index(p0, q1, p1) < 0;
+        };
+        std::sort(nodeStar.begin() + static_cast<std::ptrdiff_t>(nodeStarStart[node]),
+                  nodeStar.begin() + static_cast<std::ptrdiff_t>(nodeStarStart[node + 1]),
+                  compareDirection);
+    }, 256);
+    edgeDirPts.clear();
+    edgeDirPts.shrink_to_fit();
+    nodePts.clear();
+    nodePts.shrink_to_fit();
+
+    halfEdgeNext.assign(numHalfEdges, NONE);
+    halfEdgeLabel.assign(numHalfEdges, NONE);
+    halfEdgeMarked.assign(numHalfEdges, 0);
+    nodeDegree.assign(numNodes, 0);
+    isDangle.assign(edgeLines.size(), 0);
+    isCutEdge.assign(edgeLines.size(), 0);
+}
+
+/**
+* Removes the dangles and cut edges of a connected component
+* and finds its minimal edge rings, following PolygonizeGraph.
+* Each ring is labelled with its lowest half-edge index.
+*
+* @return the lowest half-edge index of each ring
+*/
+/* private */
+std::vector<std::size_t>
+ParallelPolygonizer::processComponent(const std::vector<std::size_t>& nodes,
+                                      const std::vector<std::size_t>& halfEdges)
+{
+    deleteDangles(nodes);
+    deleteCutEdges(nodes, halfEdges);
+
+    computeNextCWEdges(nodes);
+    for (std::size_t he : halfEdges) {
+        halfEdgeLabel[he] = NONE;
+    }
+    auto maximalRings = findLabeledEdgeRings(halfEdges);
+    convertMaximalToMinimalEdgeRings(maximalRings);
+
+    for (std::size_t he : halfEdges) {
+        halfEdgeLabel[he] = NONE;
+    }
+    return findLabeledEdgeRings(halfEdges);
+}
+
+/* private */
+void
+ParallelPolygonizer::deleteDangles(const std::vector<std::size_t>& nodes)
+{
+    std::vector<std::size_t> nodeStack;
+    for (std::size_t node : nodes) {
+        nodeDegree[node] = nodeStarStart[node + 1] - nodeStarStart[node];
+        if (nodeDegree[node] == 1) {
+            nodeStack.push_back(node);
+        }
+    }
+
+    while (!nodeStack.empty()) {
+        std::size_t node = nodeStack.back();
+        nodeStack.pop_back();
+        for (std::size_t i = nodeStarStart[node]; i < nodeStarStart[node + 1]; i++) {
+            std::size_t he = nodeStar[i];
+            if (halfEdgeMarked[he]) {
+                continue;
+            }
+            halfEdgeMarked[he] = 1;
+            halfEdgeMarked[he ^ 1] = 1;
+            isDangle[he / 2] = 1;
+            nodeDegree[node]--;
+            std::size_t toNode = halfEdgeNode[he ^ 1];
+            nodeDegree[toNode]--;
+            if (nodeDegree[toNode] == 1) {
+                nodeStack.push_back(toNode);
+            }
+        }
+    }
+}
+
+/**
+* Cut edges are edges where both half-edges are in the same edge ring.
+*/
+/* private */
+void
+ParallelPolygonizer::deleteCutEdges(const std::vector<std::size_t>& nodes,
+                                    const std::vector<std::size_t>& halfEdges)
+{
+    computeNextCWEdges(nodes);
+    findLabeledEdgeRings(halfEdges);
+
+    for (std::size_t he : halfEdges) {
+        if (halfEdgeMarked[he]) {
+            continue;
+        }
+        if (halfEdgeLabel[he] == halfEdgeLabel[he ^ 1]) {
+            halfEdgeMarked[he] = 1;
+            halfEdgeMarked[he ^ 1] = 1;
+            isCutEdge[he / 2] = 1;
+        }
+    }
+}
+
+/* private */
+void
+ParallelPolygonizer::computeNextCWEdges(const std::vector<std::size_t>& nodes)
+{
+    for (std::size_t node : nodes) {
+        std::size_t startHe = NONE;
+        std::size_t prevHe = NONE;
+        for (std::size_t i = nodeStarStart[node]; i < nodeStarStart[node + 1]; i++) {
+            std::size_t he = nodeStar[i];
+            if (halfEdgeMarked[he]) {
+                continue;
+            }
+            if (startHe == NONE) {
+                startHe = he;
+            }
+            if (prevHe != NONE) {
+                halfEdgeNext[prevHe ^ 1] = he;
+            }
+            prevHe = he;
+        }
+        if (prevHe != NONE) {
+            halfEdgeNext[prevHe ^ 1] = startHe;
+        }
+    }
+}
+
+/**
+* Computes the next half-edges going CCW around a node, for the given
+* edge ring label. This converts maximal edge rings into minimal ones.
+*/
+/* private */
+void
+ParallelPolygonizer::computeNextCCWEdges(std::size_t node, std::size_t label)
+{
+    std::size_t firstOutHe = NONE;
+    std::size_t prevInHe = NONE;
+
+    for (std::size_t i = nodeStarStart[node + 1]; i > nodeStarStart[node]; i--) {
+        std::size_t he = nodeStar[i - 1];
+        std::size_t sym = he ^ 1;
+        bool isOut = halfEdgeLabel[he] == label;
+        bool isIn = halfEdgeLabel[sym] == label;
+        if (!isOut && !isIn) {
+            continue;
+        }
+        if (isIn) {
+            prevInHe = sym;
+        }
+        if (isOut) {
+            if (prevInHe != NONE) {
+                halfEdgeNext[prevInHe] = he;
+                prevInHe = NONE;
+            }
+            if (firstOutHe == NONE) {
+                firstOutHe = he;
+            }
+        }
+    }
+    if (prevInHe != NONE) {
+        halfEdgeNext[prevInHe] = firstOutHe;
+    }
+}
+
+/* private */
+void
+ParallelPolygonizer::convertMaximalToMinimalEdgeRings(const std::vector<std::size_t>& ringStarts)
+{
+    std::vector<std::size_t> intNodes;
+    for (std::size_t start : ringStarts) {
+        std::size_t label = halfEdgeLabel[start];
+        std::size_t he = start;
+        do {
+            std::size_t node = halfEdgeNode[he];
+            if (getDegree(node, label) > 1) {
+                intNodes.push_back(node);
+            }
+            he = halfEdgeNext[he];
+        }
+        while (he != start);
+
+        for (std::size_t node : intNodes) {
+            computeNextCCWEdges(node, label);
+        }
+        intNodes.clear();
+    }
+}
+
+/* private */
+std::vector<std::size_t>
+ParallelPolygonizer::findLabeledEdgeRings(const std::vector<std::size_t>& halfEdges)
+{
+    std::vector<std::size_t> ringStarts;
+    for (std::size_t start : halfEdges) {
+        if (halfEdgeMarked[start] || halfEdgeLabel[start] != NONE) {
+            continue;
+        }
+        ringStarts.push_back(start);
+        std::size_t he = start;
+        do {
+            halfEdgeLabel[he] = start;
+            he = halfEdgeNext[he];
+        }
+        while (he != start);
+    }
+    return ringStarts;
+}
+
+/* private */
+std::size_t
+ParallelPolygonizer::getDegree(std::size_t node, std::size_t label) const
+{
+    std::size_t degree = 0;
+    for (std::size_t i = nodeStarStart[node]; i < nodeStarStart[node + 1]; i++) {
+        if (halfEdgeLabel[nodeStar[i]] == label) {
+            degree++;
+        }
+    }
+    return degree;
+}
+
+/**
+* Builds the ring geometry from the input lines, as EdgeRing does,
+* and determines whether it is valid and whether it is a hole.
+*/
+/* private */
+void
+ParallelPolygonizer::buildRing(Ring& ring) const
+{
+    auto ringPts = detail::make_unique<CoordinateArraySequence>(0u, 0u);
+    std::size_t he = ring.start;
+    do {
+        const CoordinateSequence* pts = edgeLines[he / 2]->getCoordinatesRO();
+        std::size_t n = pts->size();
+        if (he % 2 == 0) {
+            for (std::size_t i = 0; i < n; i++) {
+                ringPts->add(pts->getAt(i), false);
+            }
+        }
+        else {
+            for (std::size_t i = n; i > 0; i--) {
+                ringPts->add(pts->getAt(i - 1), false);
+            }
+        }
+        he = halfEdgeNext[he];
+    }
+    while (he != ring.start);
+
+    //-- rings which cannot be constructed are invalid
+    std::size_t n = ringPts->size();
+    if (n < LinearRing::MINIMUM_VALID_SIZE || !ringPts->getAt(0).equals2D(ringPts->getAt(n - 1))) {
+        ring.invalidLine = factory->createLineString(std::move(ringPts));
+        return;
+    }
+
+    ring.ring = factory->createLinearRing(std::move(ringPts));
+    if (!ring.ring->isValid()) {
+        ring.invalidLine = factory->createLineString(ring.ring->getCoordinates());
+        ring.ring.reset();
+        return;
+    }
+    ring.isHole = Orientation::isCCW(ring.ring->getCoordinatesRO());
+}
+
+/**
+* Builds the point locator and the sorted vertices of a shell,
+* used to test whether the shell contains a hole.
+*/
+/* private */
+void
+ParallelPolygonizer::prepareShell(Ring& shell) const
+{
+    shell.locator.reset(new IndexedPointInAreaLocator(*shell.ring));
+    //-- the locator index is built lazily, so build it before sharing the locator
+    Coordinate pt = shell.ring->getCoordinatesRO()->getAt(0);
+    shell.locator->locate(&pt);
+
+    shell.ring->getCoordinatesRO()->toVector(shell.sortedPts);
+    std::sort(shell.sortedPts.begin(), shell.sortedPts.end(), lessThanXY);
+}
+
+/**
+* Finds the smallest shell containing a hole, in the same way as
+* EdgeRing::findEdgeRingContaining. The candidate shells are those
+* whose envelope contains the hole envelope.
+*/
+/* private */
+std::size_t
+ParallelPolygonizer::findShellContaining(const Ring& hole, const std::vector<std::size_t>& candidates)
+{
+    const CoordinateSequence* testPts = hole.ring->getCoordinatesRO();
+    std::size_t minShell = NONE;
+    const Envelope* minShellEnv = nullptr;
+
+    for (std::size_t i : candidates) {
+        const Ring& tryShell = rings[i];
+        const Envelope* tryShellEnv = tryShell.ring->getEnvelopeInternal();
+
+        Coordinate testPt = Coordinate::getNull();
+        for (std::size_t j = 0; j < testPts->size(); j++) {
+            const Coordinate& pt = testPts->getAt(j);
+            if (!std::binary_search(tryShell.sortedPts.begin(), tryShell.sortedPts.end(), pt, lessThanXY)) {
+                testPt = pt;
+                break;
+            }
+        }
+
+        // check if this new containing ring is smaller than the current minimum ring
+        if (tryShell.locator->locate(&testPt) != Location::EXTERIOR) {
+            if (minShell == NONE || minShellEnv->contains(tryShellEnv)) {
+                minShell = i;
+                minShellEnv = tryShellEnv;
+            }
+        }
+    }
+    return minShell;
+}
+
+/* private */
+std::size_t
+ParallelPolygonizer::getRingIndex(std::size_t halfEdge) const
+{
+    std::size_t start = halfEdgeLabel[halfEdge];
+    auto it = std::lower_bound(rings.begin(), rings.end(), start, [](const Ring& ring, std::size_t s) {
+        return ring.start < s;
+    });
+    return static_cast<std::size_t>(it - rings.begin());
+}
+
+/**
+* Gets the shell of a ring: the ring itself, unless it is a hole.
+*/
+/* private */
+std::size_t
+ParallelPolygonizer::getShell(std::size_t ringIndex) const
+{
+    const Ring& ring = rings[ringIndex];
+    return ring.isHole ? ring.shell : ringIndex;
+}
+
+/**
+* A shell is an outer shell if any edge is also in an outer hole:
+* a hole which is not contained by a shell.
+*/
+/* private */
+std::size_t
+ParallelPolygonizer::getOuterHole(std::size_t ringIndex) const
+{
+    std::size_t start = rings[ringIndex].start;
+    std::size_t he = start;
+    do {
+        std::size_t adjIndex = getRingIndex(he ^ 1);
+        const Ring& adjRing = rings[adjIndex];
+        if (adjRing.isHole && adjRing.shell == NONE) {
+            return adjIndex;
+        }
+        he = halfEdgeNext[he];
+    }
+    while (he != start);
+    return NONE;
+}
+
+/* private */
+void
+ParallelPolygonizer::findDisjointShells(const std::vector<std::size_t>& shells)
+{
+    for (std::size_t i : shells) {
+        std::size_t outerHole = getOuterHole(i);
+        if (outerHole != NONE && !rings[outerHole].isProcessed) {
+            rings[i].isIncluded = true;
+            rings[i].isIncludedSet = true;
+            rings[outerHole].isProcessed = true;
+        }
+    }
+
+    for (std::size_t i : shells) {
+        if (!rings[i].isIncludedSet) {
+            updateIncluded(i);
+        }
+    }
+}
+
+/**
+* Sets the inclusion of a shell to the opposite of an adjacent shell,
+* visiting the adjacent shells first, as EdgeRing::updateIncludedRecursive
+* does. An explicit stack is used so that long chains of shells
+* do not overflow the call stack.
+*/
+/* private */
+void
+ParallelPolygonizer::updateIncluded(std::size_t shellIndex)
+{
+    struct Visit {
+        std::size_t ring;
+        std::size_t nextHe; // next half-edge to visit, or NONE when done
+    };
+    std::vector<Visit> stack;
+    rings[shellIndex].isVisited = true;
+    stack.push_back({ shellIndex, rings[shellIndex].start });
+
+    while (!stack.empty()) {
+        std::size_t ringIndex = stack.back().ring;
+        std::size_t start = rings[ringIndex].start;
+
+        bool isDescending = false;
+        while (stack.back().nextHe != NONE) {
+            std::size_t he = stack.back().nextHe;
+            std::size_t next = halfEdgeNext[he];
+            stack.back().nextHe = next == start ? NONE : next;
+
+            std::size_t adjShell = getShell(getRingIndex(he ^ 1));
+            if (adjShell != NONE && !rings[adjShell].isIncludedSet && !rings[adjShell].isVisited) {
+                rings[adjShell].isVisited = true;
+                stack.push_back({ adjShell, rings[adjShell].start });
+                isDescending = true;
+                break;
+            }
+        }
+        if (isDescending) {
+            continue;
+        }
+
+        std::size_t he = start;
+        do {
+            std::size_t adjShell = getShell(getRingIndex(he ^ 1));
+            if (adjShell != NONE && rings[adjShell].isIncludedSet) {
+                rings[ringIndex].isIncluded = !rings[adjShell].isIncluded;
+                rings[ringIndex].isIncludedSet = true;
+                break;
+            }
+            he = halfEdgeNext[he];
+        }
+        while (he != start);
+        stack.pop_back();
+    }
+}
+
+} // namespace geos.operation.polygonize
+} // namespace geos.operation
+} // namespace geos
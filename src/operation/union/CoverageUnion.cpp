@@ -23,6 +23,10 @@
 #include <geos/util/IllegalArgumentException.h>
 #include <geos/util/TopologyException.h>
 #include <geos/shape/fractal/HilbertEncoder.h>
+#include <geos/util/parallel.h>
+
+#include <algorithm>
+#include <cmath>
 
 namespace geos {
 namespace operation {
@@ -37,6 +41,32 @@ using geos::geom::GeometryCollection;
 using geos::geom::GeometryFactory;
 using geos::operation::polygonize::Polygonizer;
 
+namespace {
+
+// Segments are distributed into a fixed number of shards by hash, and
+// rings are processed in fixed-size blocks, so that the order in which
+// segments are hashed does not depend on the number of threads.
+constexpr std::size_t NUM_SHARDS = 64;
+constexpr std::size_t RING_BLOCK_SIZE = 64;
+
+struct GroupSegment {
+    LineSegment segment;
+    std::size_t group;
+
+    bool operator==(const GroupSegment& other) const {
+        return group == other.group && segment == other.segment;
+    }
+
+    struct HashCode {
+        std::size_t operator()(const GroupSegment& gs) const {
+            std::size_t h = LineSegment::HashCode{}(gs.segment);
+            return h ^ (gs.group * 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2));
+        }
+    };
+};
+
+}
+
 void CoverageUnion::extractRings(const Geometry* geom) {
     const Polygon* p = dynamic_cast<const Polygon*>(geom);
     if (p != nullptr) {
@@ -131,6 +161,106 @@ std::unique_ptr<geom::Geometry> CoverageUnion::Union(const geom::Geometry* geom)
     return ret;
 }
 
+std::map<std::int64_t, std::unique_ptr<Geometry>>
+CoverageUnion::Union(const std::vector<const Geometry*>& geoms,
+                     const std::vector<std::int64_t>& keys,
+                     std::size_t numThreads)
+{
+    if (geoms.size() != keys.size()) {
+        throw geos::util::IllegalArgumentException("CoverageUnion requires one group key per input geometry.");
+    }
+
+    std::map<std::int64_t, std::size_t> groupIndex;
+    for (std::int64_t key : keys) {
+        groupIndex.emplace(key, 0);
+    }
+    std::size_t numGroups = 0;
+    for (auto& entry : groupIndex) {
+        entry.second = numGroups++;
+    }
+
+    std::vector<std::unique_ptr<CoverageUnion>> groups;
+    for (std::size_t g = 0; g < numGroups; g++) {
+        groups.emplace_back(new CoverageUnion());
+    }
+    std::vector<double> groupArea(numGroups, 0.0);
+    std::vector<const GeometryFactory*> groupFactory(numGroups, nullptr);
+    std::vector<std::pair<std::size_t, const LinearRing*>> rings;
+    for (std::size_t i = 0; i < geoms.size(); i++) {
+        std::size_t g = groupIndex[keys[i]];
+        CoverageUnion& cu = *groups[g];
+        std::size_t start = cu.rings.size();
+        cu.extractRings(geoms[i]);
+        for (std::size_t j = start; j < cu.rings.size(); j++) {
+            rings.emplace_back(g, cu.rings[j]);
+        }
+        groupArea[g] += geoms[i]->getArea();
+        groupFactory[g] = geoms[i]->getFactory();
+    }
+
+    //-- hash the segments of each block of rings into shards
+    std::size_t numBlocks = (rings.size() + RING_BLOCK_SIZE - 1) / RING_BLOCK_SIZE;
+    std::vector<std::vector<std::vector<GroupSegment>>> blockShards(numBlocks);
+    geos::util::parallelFor(numBlocks, numThreads, [&](std::size_t b) {
+        std::vector<std::vector<GroupSegment>>& shards = blockShards[b];
+        shards.resize(NUM_SHARDS);
+        std::size_t end = std::min(rings.size(), (b + 1) * RING_BLOCK_SIZE);
+        for (std::size_t r = b * RING_BLOCK_SIZE; r < end; r++) {
+            auto coords = rings[r].second->getCoordinatesRO();
+            for (std::size_t i = 1; i < coords->size(); i++) {
+                GroupSegment gs{LineSegment{coords->getAt(i), coords->getAt(i - 1)}, rings[r].first};
+                gs.segment.normalize();
+                std::size_t shard = GroupSegment::HashCode{}(gs) % NUM_SHARDS;
+                shards[shard].push_back(std::move(gs));
+            }
+        }
+    });
+
+    //-- cancel segments shared within a group, one shard at a time
+    std::vector<std::vector<GroupSegment>> remaining(NUM_SHARDS);
+    geos::util::parallelFor(NUM_SHARDS, numThreads, [&](std::size_t shard) {
+        std::unordered_set<GroupSegment, GroupSegment::HashCode> segments;
+        for (const auto& shards : blockShards) {
+            for (const GroupSegment& gs : shards[shard]) {
+                if (!segments.erase(gs)) {
+                    segments.insert(gs);
+                }
+            }
+        }
+        remaining[shard].assign(segments.begin(), segments.end());
+    });
+    blockShards.clear();
+
+    std::vector<std::vector<LineSegment>> groupSegments(numGroups);
+    for (const auto& shard : remaining) {
+        for (const GroupSegment& gs : shard) {
+            groupSegments[gs.group].push_back(gs.segment);
+        }
+    }
+    remaining.clear();
+
+    //-- build the rings of each group
+    std::vector<std::unique_ptr<Geometry>> results(numGroups);
+    geos::util::parallelFor(numGroups, numThreads, [&](std::size_t g) {
+        CoverageUnion& cu = *groups[g];
+        cu.segments.insert(groupSegments[g].begin(), groupSegments[g].end());
+        auto ret = cu.polygonize(groupFactory[g]);
+
+        double area_in = groupArea[g];
+        double area_out = ret->getArea();
+        if (area_in > 0 && std::abs((area_out - area_in)/area_in) > AREA_PCT_DIFF_TOL) {
+            throw geos::util::TopologyException("CoverageUnion cannot process overlapping inputs.");
+        }
+        results[g] = std::move(ret);
+    });
+
+    std::map<std::int64_t, std::unique_ptr<Geometry>> result;
+    for (const auto& entry : groupIndex) {
+        result.emplace(entry.first, std::move(results[entry.second]));
+    }
+    return result;
+}
+
 }
 }
 }
@@ -20,6 +20,9 @@
 #include <geos/geom/Coordinate.h>
 #include <geos/geom/LineSegment.h>
 
+#include <algorithm>
+#include <limits>
+#include <tuple>
 #include <vector>
 #include <memory> // for unique_ptr
 
@@ -39,6 +42,54 @@ DouglasPeuckerLineSimplifier::simplify(
     return simp.simplify();
 }
 
+/*public static*/
+std::vector<double>
+DouglasPeuckerLineSimplifier::computeEliminationTolerances(
+    const DouglasPeuckerLineSimplifier::CoordsVect& nPts)
+{
+    const double inf = std::numeric_limits<double>::infinity();
+    std::vector<double> tolerances(nPts.size(), inf);
+    if(nPts.size() < 3) {
+        return tolerances;
+    }
+
+    /*
+     * The sections are split at the same points for every tolerance.
+     * A point survives while every section containing it, up to the
+     * one split at that point, is further than the tolerance from
+     * its chord.  An explicit stack avoids deep recursion.
+     */
+    std::vector<std::tuple<std::size_t, std::size_t, double>> sections;
+    sections.emplace_back(0, nPts.size() - 1, inf);
+    while(!sections.empty()) {
+        std::size_t i, j;
+        double parentTolerance;
+        std::tie(i, j, parentTolerance) = sections.back();
+        sections.pop_back();
+
+        if((i + 1) == j) {
+            continue;
+        }
+
+        geos::geom::LineSegment seg(nPts[i], nPts[j]);
+        double maxDistance = -1.0;
+        std::size_t maxIndex = i;
+        for(std::size_t k = i + 1; k < j; k++) {
+            double distance = seg.distance(nPts[k]);
+            if(distance > maxDistance) {
+                maxDistance = distance;
+                maxIndex = k;
+            }
+        }
+
+        double tolerance = std::min(parentTolerance, maxDistance);
+        tolerances[maxIndex] = tolerance;
+        sections.emplace_back(maxIndex, j, tolerance);
+        sections.emplace_back(i, maxIndex, tolerance);
+    }
+    return tolerances;
+}
+
 /*public*/
 DouglasPeuckerLineSimplifier::DouglasPeuckerLineSimplifier(
     const DouglasPeuckerLineSimplifier::CoordsVect& nPts)
@@ -29,6 +29,8 @@
 #include <geos/util.h>
 
 #include <memory> // for unique_ptr
+#include <unordered_map>
+#include <vector>
 #include <cassert>
 
 #ifndef GEOS_DEBUG
@@ -44,12 +46,22 @@ using namespace geos::geom;
 namespace geos {
 namespace simplify { // geos::simplify
 
+/// Elimination tolerances of the points of each input coordinate sequence
+typedef std::unordered_map<const CoordinateSequence*, std::vector<double>> EliminationToleranceMap;
+
 class DPTransformer: public geom::util::GeometryTransformer {
 
 public:
 
     DPTransformer(double tolerance);
 
+    /*
+     * Creates a transformer which simplifies by filtering points
+     * by their elimination tolerance, computing these on first use
+     * and caching them for transforms with other tolerances.
+     */
+    DPTransformer(double tolerance, EliminationToleranceMap* eliminationTolerances);
+
 protected:
 
     CoordinateSequence::Ptr transformCoordinates(
@@ -88,11 +100,22 @@ private:
 
     double distanceTolerance;
 
+    EliminationToleranceMap* eliminationTolerances;
+
 };
 
 DPTransformer::DPTransformer(double t)
     :
-    distanceTolerance(t)
+    distanceTolerance(t),
+    eliminationTolerances(nullptr)
+{
+    setSkipTransformedInvalidInteriorRings(true);
+}
+
+DPTransformer::DPTransformer(double t, EliminationToleranceMap* p_eliminationTolerances)
+    :
+    distanceTolerance(t),
+    eliminationTolerances(p_eliminationTolerances)
 {
     setSkipTransformedInvalidInteriorRings(true);
 }
@@ -116,8 +139,24 @@ DPTransformer::transformCoordinates(
     Coordinate::Vect inputPts;
     coords->toVector(inputPts);
 
-    std::unique_ptr<Coordinate::Vect> newPts =
-        DouglasPeuckerLineSimplifier::simplify(inputPts, distanceTolerance);
+    std::unique_ptr<Coordinate::Vect> newPts;
+    if(eliminationTolerances) {
+        auto it = eliminationTolerances->find(coords);
+        if(it == eliminationTolerances->end()) {
+            it = eliminationTolerances->emplace(coords,
+                DouglasPeuckerLineSimplifier::computeEliminationTolerances(inputPts)).first;
+        }
+        const std::vector<double>& tolerances = it->second;
+        newPts.reset(new Coordinate::Vect());
+        for(std::size_t i = 0; i < inputPts.size(); i++) {
+            if(tolerances[i] > distanceTolerance) {
+                newPts->push_back(inputPts[i]);
+            }
+        }
+    }
+    else {
+        newPts = DouglasPeuckerLineSimplifier::simplify(inputPts, distanceTolerance);
+    }
 
     return CoordinateSequence::Ptr(
                factory->getCoordinateSequenceFactory()->create(
@@ -191,6 +230,27 @@ DouglasPeuckerSimplifier::simplify(const Geometry* geom,
     return tss.getResultGeometry();
 }
 
+/*public static*/
+std::vector<Geometry::Ptr>
+DouglasPeuckerSimplifier::simplify(const Geometry* geom,
+                                   const std::vector<double>& tolerances)
+{
+    for(double tol : tolerances) {
+        if(tol < 0.0) {
+            throw util::IllegalArgumentException("Tolerance must be non-negative");
+        }
+    }
+
+    EliminationToleranceMap eliminationTolerances;
+    std::vector<Geometry::Ptr> results;
+    results.reserve(tolerances.size());
+    for(double tol : tolerances) {
+        DPTransformer t(tol, &eliminationTolerances);
+        results.push_back(t.transform(geom));
+    }
+    return results;
+}
+
 /*public*/
 DouglasPeuckerSimplifier::DouglasPeuckerSimplifier(const Geometry* geom)
     :
@@ -58,6 +58,32 @@ PolygonHullSimplifier::hullByAreaDelta(const Geometry* geom, bool bOuter, double
 }
 
 
+/* public static */
+std::vector<std::unique_ptr<Geometry>>
+PolygonHullSimplifier::hull(const Geometry* geom, bool bOuter, const std::vector<double>& vertexNumFractions)
+{
+    PolygonHullSimplifier hull(geom, bOuter);
+    std::vector<double> targets;
+    for (double fraction : vertexNumFractions) {
+        targets.push_back(util::clamp(std::abs(fraction), 0.0, 1.0));
+    }
+    return hull.computeLevels(targets, false);
+}
+
+
+/* public static */
+std::vector<std::unique_ptr<Geometry>>
+PolygonHullSimplifier::hullByAreaDelta(const Geometry* geom, bool bOuter, const std::vector<double>& areaDeltaRatios)
+{
+    PolygonHullSimplifier hull(geom, bOuter);
+    std::vector<double> targets;
+    for (double ratio : areaDeltaRatios) {
+        targets.push_back(std::abs(ratio));
+    }
+    return hull.computeLevels(targets, true);
+}
+
+
 /* public */
 void
 PolygonHullSimplifier::setVertexNumFraction(double p_vertexNumFraction)
@@ -166,6 +192,118 @@ PolygonHullSimplifier::computePolygon(const Polygon* poly)
 }
 
 
+/**
+* Computes the removal sequence of every ring once, then extracts
+* the hull of each ring for each target.
+* Rings which may overlap are checked against unmodified copies of
+* the other rings, so that the result for each target does not depend
+* on the order in which the rings were processed.
+*/
+/* private */
+std::vector<std::unique_ptr<Geometry>>
+PolygonHullSimplifier::computeLevels(const std::vector<double>& targets, bool isAreaDelta)
+{
+    std::vector<const Polygon*> polys;
+    bool isMulti = inputGeom->getGeometryTypeId() == geom::GEOS_MULTIPOLYGON;
+    if (isMulti) {
+        for (std::size_t i = 0; i < inputGeom->getNumGeometries(); i++) {
+            polys.push_back(static_cast<const Polygon*>(inputGeom->getGeometryN(i)));
+        }
+    }
+    else if (inputGeom->getGeometryTypeId() == geom::GEOS_POLYGON) {
+        polys.push_back(static_cast<const Polygon*>(inputGeom));
+    }
+    else {
+        throw util::IllegalArgumentException("Input geometry must be polygonal");
+    }
+
+    //-- same overlap conditions as getResult()
+    bool isOverlapPossibleAll = isMulti && isOuter && polys.size() > 1;
+
+    RingHullIndex allIndex;
+    std::vector<RingHullIndex> polyIndex(polys.size());
+    for (std::size_t i = 0; i < polys.size(); i++) {
+        const Polygon* poly = polys[i];
+        bool isOverlapPossible = isOverlapPossibleAll
+            || (! isOuter && poly->getNumInteriorRing() > 0);
+        if (poly->isEmpty() || ! isOverlapPossible) {
+            continue;
+        }
+        RingHullIndex& hullIndex = isOverlapPossibleAll ? allIndex : polyIndex[i];
+        ringStore.emplace_back(new RingHull(poly->getExteriorRing(), isOuter));
+        hullIndex.add(ringStore.back().get());
+        for (std::size_t j = 0; j < poly->getNumInteriorRing(); j++) {
+            ringStore.emplace_back(new RingHull(poly->getInteriorRingN(j), ! isOuter));
+            hullIndex.add(ringStore.back().get());
+        }
+    }
+
+    std::vector<std::vector<RingHull*>> polyHulls(polys.size());
+    for (std::size_t i = 0; i < polys.size(); i++) {
+        const Polygon* poly = polys[i];
+        if (poly->isEmpty()) {
+            continue;
+        }
+        RingHullIndex& hullIndex = isOverlapPossibleAll ? allIndex : polyIndex[i];
+        ringStore.emplace_back(new RingHull(poly->getExteriorRing(), isOuter));
+        polyHulls[i].push_back(ringStore.back().get());
+        for (std::size_t j = 0; j < poly->getNumInteriorRing(); j++) {
+            ringStore.emplace_back(new RingHull(poly->getInteriorRingN(j), ! isOuter));
+            polyHulls[i].push_back(ringStore.back().get());
+        }
+        for (RingHull* ringHull : polyHulls[i]) {
+            ringHull->computeRemovals(hullIndex);
+        }
+    }
+
+    std::vector<std::unique_ptr<Geometry>> results;
+    for (double target : targets) {
+        //-- handle trivial parameter values
+        if ((! isAreaDelta && target == 1) || (isAreaDelta && target == 0)) {
+            results.push_back(inputGeom->clone());
+            continue;
+        }
+
+        std::vector<std::unique_ptr<Polygon>> hullPolys;
+        for (std::size_t i = 0; i < polys.size(); i++) {
+            const Polygon* poly = polys[i];
+            if (poly->isEmpty()) {
+                hullPolys.push_back(poly->clone());
+                continue;
+            }
+            double areaTotal = isAreaDelta ? ringArea(poly) : 0.0;
+            std::vector<std::unique_ptr<LinearRing>> rings;
+            for (std::size_t j = 0; j < polyHulls[i].size(); j++) {
+                const LinearRing* ring = j == 0 ? poly->getExteriorRing() : poly->getInteriorRingN(j - 1);
+                if (isAreaDelta) {
+                    double linearRingArea = Area::ofRing(ring->getCoordinatesRO());
+                    double linearRingWeight = linearRingArea / areaTotal;
+                    double maxAreaDelta = linearRingWeight * target * linearRingArea;
+                    rings.push_back(polyHulls[i][j]->getHullForAreaDelta(maxAreaDelta));
+                }
+                else {
+                    double dNumPoints = static_cast<double>(ring->getNumPoints());
+                    std::size_t targetVertexCount = static_cast<std::size_t>(
+                        std::ceil(target * (dNumPoints - 1)));
+                    rings.push_back(polyHulls[i][j]->getHullForVertexNum(targetVertexCount));
+                }
+            }
+            std::unique_ptr<LinearRing> shell = std::move(rings[0]);
+            rings.erase(rings.begin());
+            hullPolys.push_back(geomFactory->createPolygon(std::move(shell), std::move(rings)));
+        }
+
+        if (isMulti) {
+            results.push_back(geomFactory->createMultiPolygon(std::move(hullPolys)));
+        }
+        else {
+            results.push_back(std::move(hullPolys[0]));
+        }
+    }
+    return results;
+}
+
+
 /* private */
 std::vector<RingHull*>
 PolygonHullSimplifier::initPolygon(const Polygon* poly, RingHullIndex& hullIndex)
@@ -28,6 +28,8 @@
 #include <geos/geom/Triangle.h>
 #include <geos/index/VertexSequencePackedRtree.h>
 
+#include <algorithm>
+
 using geos::algorithm::Orientation;
 using geos::geom::Envelope;
 using geos::geom::Coordinate;
@@ -155,6 +157,7 @@ RingHull::area(const LinkedRing& vertexRing, std::size_t index)
 void
 RingHull::compute(RingHullIndex& hullIndex)
 {
+    double maxTestedAreaDelta = 0.0;
     while (! cornerQueue.empty()
         && vertexRing->size() > 3)
     {
@@ -163,7 +166,10 @@ RingHull::compute(RingHullIndex& hullIndex)
         //-- a corner may no longer be valid due to removal of adjacent corners
         if (corner.isRemoved(*vertexRing))
             continue;
-        if (isAtTarget(corner)) {
+        if (isRecording) {
+            maxTestedAreaDelta = std::max(maxTestedAreaDelta, areaDelta + corner.getArea());
+        }
+        else if (isAtTarget(corner)) {
             return;
         }
         //System.out.println(corner.toLineString(vertexList));
@@ -171,11 +177,72 @@ RingHull::compute(RingHullIndex& hullIndex)
         * Corner is concave or flat - remove it if possible.
         */
         if (isRemovable(corner, hullIndex)) {
+            if (isRecording) {
+                removedVertex.push_back(corner.getIndex());
+                removalAreaDelta.push_back(maxTestedAreaDelta);
+            }
             removeCorner(corner, cornerQueue);
         }
     }
 }
 
+/* public */
+void
+RingHull::computeRemovals(RingHullIndex& hullIndex)
+{
+    isRecording = true;
+    compute(hullIndex);
+    isRecording = false;
+}
+
+/**
+* Removals happen while the ring has at least the minimum
+* number of vertices, so the first (size - minVertexNum + 1)
+* recorded removals are performed.
+*/
+/* public */
+std::unique_ptr<LinearRing>
+RingHull::getHullForVertexNum(std::size_t minVertexNum) const
+{
+    std::size_t ringSize = vertex.size() - 1;
+    std::size_t numRemoved = 0;
+    if (ringSize >= minVertexNum) {
+        numRemoved = std::min(removedVertex.size(), ringSize - minVertexNum + 1);
+    }
+    return buildHull(numRemoved);
+}
+
+/**
+* The area deltas tested up to each removal are non-decreasing,
+* so the removals performed are a prefix of the recorded ones.
+*/
+/* public */
+std::unique_ptr<LinearRing>
+RingHull::getHullForAreaDelta(double maxAreaDelta) const
+{
+    auto end = std::upper_bound(removalAreaDelta.begin(), removalAreaDelta.end(), maxAreaDelta);
+    std::size_t numRemoved = static_cast<std::size_t>(end - removalAreaDelta.begin());
+    return buildHull(numRemoved);
+}
+
+/* private */
+std::unique_ptr<LinearRing>
+RingHull::buildHull(std::size_t numRemoved) const
+{
+    std::vector<bool> isRemoved(vertex.size(), false);
+    for (std::size_t i = 0; i < numRemoved; i++) {
+        isRemoved[removedVertex[i]] = true;
+    }
+    std::unique_ptr<CoordinateArraySequence> coords(new CoordinateArraySequence());
+    for (std::size_t i = 0; i < vertex.size() - 1; i++) {
+        if (! isRemoved[i]) {
+            coords->add(vertex[i], false);
+        }
+    }
+    coords->closeRing();
+    return inputRing->getFactory()->createLinearRing(std::move(coords));
+}
+
 /* private */
 bool
 RingHull::isAtTarget(const Corner& corner)
@@ -233,7 +300,7 @@ RingHull::isRemovable(const Corner& corner, const RingHullIndex& hullIndex) cons
     std::vector<const RingHull*> queryResult = hullIndex.query(cornerEnv);
     for (const RingHull* hull : queryResult) {
       //-- this hull was already checked above
-        if (hull == this)
+        if (hull->inputRing == inputRing)
             continue;
         if (hasIntersectingVertex(corner, cornerEnv, hull))
             return false;
@@ -57,10 +57,13 @@ TaggedLineStringSimplifier::TaggedLineStringSimplifier(
     li(new algorithm::LineIntersector()),
     line(nullptr),
     linePts(nullptr),
-    distanceTolerance(0.0)
+    distanceTolerance(0.0),
+    deferIndexUpdates(false)
 {
 }
 
+TaggedLineStringSimplifier::~TaggedLineStringSimplifier() = default;
+
 /*public*/
 void
 TaggedLineStringSimplifier::simplify(TaggedLineString* nLine)
@@ -85,6 +88,22 @@ TaggedLineStringSimplifier::simplify(TaggedLineString* nLine)
 
 }
 
+/*public*/
+void
+TaggedLineStringSimplifier::applyIndexUpdates()
+{
+    for(const LineSegment* seg : removedSegList) {
+        inputIndex->remove(seg);
+    }
+    for(const LineSegment* seg : addedSegList) {
+        outputIndex->add(seg);
+    }
+    removedSegs.clear();
+    removedSegList.clear();
+    addedSegList.clear();
+    addedIndex.reset();
+}
+
 
 /*private*/
 void
@@ -184,7 +203,16 @@ TaggedLineStringSimplifier::flatten(std::size_t start, std::size_t end)
     std::unique_ptr<TaggedLineSegment> newSeg(new TaggedLineSegment(p0, p1));
     // update the indexes
     remove(line, start, end);
-    outputIndex->add(newSeg.get());
+    if(deferIndexUpdates) {
+        if(!addedIndex) {
+            addedIndex.reset(new LineSegmentIndex());
+        }
+        addedIndex->add(newSeg.get());
+        addedSegList.push_back(newSeg.get());
+    }
+    else {
+        outputIndex->add(newSeg.get());
+    }
     return newSeg;
 }
 
@@ -220,6 +248,15 @@ TaggedLineStringSimplifier::hasBadOutputIntersection(
         }
     }
 
+    if(addedIndex) {
+        querySegs = addedIndex->query(&candidateSeg);
+        for(const LineSegment* querySeg : *querySegs) {
+            if(hasInteriorIntersection(*querySeg, candidateSeg)) {
+                return true;
+            }
+        }
+    }
+
     return false;
 }
 
@@ -246,6 +283,10 @@ TaggedLineStringSimplifier::hasBadInputIntersection(
     for(const LineSegment* ls : *querySegs) {
         const TaggedLineSegment* querySeg = static_cast<const TaggedLineSegment*>(ls);
 
+        if(deferIndexUpdates && removedSegs.count(ls) > 0) {
+            continue;
+        }
+
         if(!isInLineSection(parentLine, sectionIndex, querySeg) && hasInteriorIntersection(*querySeg, candidateSeg)) {
 
             return true;
@@ -286,7 +327,13 @@ TaggedLineStringSimplifier::remove(const TaggedLineString* p_line,
 
     for(std::size_t i = start; i < end; i++) {
         const TaggedLineSegment* seg = p_line->getSegment(i);
-        inputIndex->remove(seg);
+        if(deferIndexUpdates) {
+            removedSegs.insert(seg);
+            removedSegList.push_back(seg);
+        }
+        else {
+            inputIndex->remove(seg);
+        }
     }
 }
 
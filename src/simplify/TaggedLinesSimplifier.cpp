@@ -19,7 +19,12 @@
 #include <geos/simplify/TaggedLinesSimplifier.h>
 #include <geos/simplify/LineSegmentIndex.h>
 #include <geos/simplify/TaggedLineStringSimplifier.h>
+#include <geos/simplify/TaggedLineString.h>
 #include <geos/algorithm/LineIntersector.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/LineString.h>
+#include <geos/index/strtree/TemplateSTRtree.h>
+#include <geos/util/parallel.h>
 
 #include <cassert>
 #include <algorithm>
@@ -45,7 +50,9 @@ TaggedLinesSimplifier::TaggedLinesSimplifier()
     inputIndex(new LineSegmentIndex()),
     outputIndex(new LineSegmentIndex()),
     taggedlineSimplifier(new TaggedLineStringSimplifier(inputIndex.get(),
-                         outputIndex.get()))
+                         outputIndex.get())),
+    distanceTolerance(0.0),
+    numThreads(1)
 {
 }
 
@@ -54,6 +61,14 @@ void
 TaggedLinesSimplifier::setDistanceTolerance(double d)
 {
     taggedlineSimplifier->setDistanceTolerance(d);
+    distanceTolerance = d;
+}
+
+/*public*/
+void
+TaggedLinesSimplifier::setNumThreads(std::size_t n)
+{
+    numThreads = n;
 }
 
 /*private*/
@@ -63,5 +78,65 @@ TaggedLinesSimplifier::simplify(TaggedLineString& tls)
     taggedlineSimplifier->simplify(&tls);
 }
 
+/*private*/
+void
+TaggedLinesSimplifier::simplifyParallel(const std::vector<TaggedLineString*>& lines)
+{
+    for(const TaggedLineString* line : lines) {
+        inputIndex->add(*line);
+    }
+
+    std::vector<std::size_t> waveOfLine = computeWaves(lines);
+    std::vector<std::vector<TaggedLineString*>> waves;
+    for(std::size_t i = 0; i < lines.size(); i++) {
+        if(waveOfLine[i] >= waves.size()) {
+            waves.resize(waveOfLine[i] + 1);
+        }
+        waves[waveOfLine[i]].push_back(lines[i]);
+    }
+
+    for(const auto& wave : waves) {
+        std::vector<std::unique_ptr<TaggedLineStringSimplifier>> simplifiers(wave.size());
+        util::parallelFor(wave.size(), numThreads, [&](std::size_t i) {
+            simplifiers[i].reset(new TaggedLineStringSimplifier(inputIndex.get(), outputIndex.get()));
+            simplifiers[i]->setDistanceTolerance(distanceTolerance);
+            simplifiers[i]->setDeferIndexUpdates(true);
+            simplifiers[i]->simplify(wave[i]);
+        });
+        for(auto& simplifier : simplifiers) {
+            simplifier->applyIndexUpdates();
+        }
+    }
+}
+
+/**
+ * A line is only affected by the index updates of lines whose envelopes
+ * intersect its own. Each line is placed in the wave after the latest
+ * preceding line it interacts with, so the lines in a wave are disjoint
+ * and see the same index state as in serial order.
+ */
+/*private static*/
+std::vector<std::size_t>
+TaggedLinesSimplifier::computeWaves(const std::vector<TaggedLineString*>& lines)
+{
+    index::strtree::TemplateSTRtree<std::size_t> envIndex(10, lines.size());
+    for(std::size_t i = 0; i < lines.size(); i++) {
+        envIndex.insert(*lines[i]->getParent()->getEnvelopeInternal(), i);
+    }
+    envIndex.build();
+
+    std::vector<std::size_t> waveOfLine(lines.size(), 0);
+    for(std::size_t i = 0; i < lines.size(); i++) {
+        std::size_t wave = 0;
+        envIndex.query(*lines[i]->getParent()->getEnvelopeInternal(), [&](std::size_t j) {
+            if(j < i) {
+                wave = std::max(wave, waveOfLine[j] + 1);
+            }
+        });
+        waveOfLine[i] = wave;
+    }
+    return waveOfLine;
+}
+
 } // namespace geos::simplify
 } // namespace geos
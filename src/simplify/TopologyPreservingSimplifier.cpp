@@ -226,6 +226,13 @@ TopologyPreservingSimplifier::setDistanceTolerance(double d)
     lineSimplifier->setDistanceTolerance(d);
 }
 
+/*public*/
+void
+TopologyPreservingSimplifier::setNumThreads(std::size_t numThreads)
+{
+    lineSimplifier->setNumThreads(numThreads);
+}
+
 
 /*public*/
 std::unique_ptr<geom::Geometry>
@@ -19,6 +19,8 @@
 #include <geos/triangulate/DelaunayTriangulationBuilder.h>
 
 #include <algorithm>
+#include <cstdint>
+#include <utility>
 
 #include <geos/geom/GeometryFactory.h>
 #include <geos/geom/Coordinate.h>
@@ -27,10 +29,15 @@
 #include <geos/operation/valid/RepeatedPointRemover.h>
 #include <geos/triangulate/IncrementalDelaunayTriangulator.h>
 #include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
+#include <geos/triangulate/quadedge/WalkingQuadEdgeLocator.h>
 #include <geos/operation/valid/RepeatedPointRemover.h>
 #include <geos/operation/valid/RepeatedPointTester.h>
+#include <geos/shape/fractal/HilbertCode.h>
+#include <geos/shape/fractal/HilbertEncoder.h>
 #include <geos/util.h>
 
+using geos::detail::make_unique;
+
 namespace geos {
 namespace triangulate { //geos.triangulate
 
@@ -76,8 +83,51 @@ DelaunayTriangulationBuilder::toVertices(
     return vertexList;
 }
 
+void
+DelaunayTriangulationBuilder::spatialSort(IncrementalDelaunayTriangulator::VertexList& vertices)
+{
+    if (vertices.size() < 2) {
+        return;
+    }
+
+    Envelope extent;
+    for (const auto& v : vertices) {
+        extent.expandToInclude(v.getCoordinate());
+    }
+    shape::fractal::HilbertEncoder encoder(shape::fractal::HilbertCode::MAX_LEVEL, extent);
+
+    // Each vertex is assigned to a round using a hash of its position in
+    // the input, with about half of the vertices in the last round,
+    // a quarter in the one before, and so on.
+    std::vector<std::pair<std::uint64_t, std::size_t>> keys(vertices.size());
+    for (std::size_t i = 0; i < vertices.size(); i++) {
+        std::uint64_t h = static_cast<std::uint64_t>(i) + 0x9e3779b97f4a7c15ULL;
+        h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+        h = h ^ (h >> 31);
+
+        std::uint64_t round = 0;
+        while (round < 31 && (h & 1)) {
+            h >>= 1;
+            round++;
+        }
+
+        Envelope env(vertices[i].getCoordinate());
+        std::uint64_t code = encoder.encode(&env);
+        keys[i] = std::make_pair(((31 - round) << 32) | code, i);
+    }
+    std::sort(keys.begin(), keys.end());
+
+    IncrementalDelaunayTriangulator::VertexList sorted;
+    sorted.reserve(vertices.size());
+    for (const auto& key : keys) {
+        sorted.push_back(vertices[key.second]);
+    }
+    vertices = std::move(sorted);
+}
+
 DelaunayTriangulationBuilder::DelaunayTriangulationBuilder() :
-    siteCoords(nullptr), tolerance(0.0), subdiv(nullptr)
+    siteCoords(nullptr), tolerance(0.0), isSpatialSort(false), subdiv(nullptr)
 {
 }
 
@@ -109,10 +159,16 @@ DelaunayTriangulationBuilder::create()
 
     Envelope siteEnv = siteCoords->getEnvelope();
     auto vertices = toVertices(*siteCoords);
-    std::sort(vertices.begin(),
-              vertices.end()); // Best performance from locator when inserting points near each other
 
     subdiv.reset(new quadedge::QuadEdgeSubdivision(siteEnv, tolerance));
+    if (isSpatialSort) {
+        spatialSort(vertices);
+        subdiv->setLocator(make_unique<quadedge::WalkingQuadEdgeLocator>(subdiv.get()));
+    }
+    else {
+        std::sort(vertices.begin(),
+                  vertices.end()); // Best performance from locator when inserting points near each other
+    }
     IncrementalDelaunayTriangulator triangulator = IncrementalDelaunayTriangulator(subdiv.get());
     triangulator.insertSites(vertices);
 }
@@ -0,0 +1,355 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/triangulate/PartitionedVoronoiDiagramBuilder.h>
+
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryCollection.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/triangulate/DelaunayTriangulationBuilder.h>
+#include <geos/triangulate/IncrementalDelaunayTriangulator.h>
+#include <geos/triangulate/quadedge/QuadEdge.h>
+#include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
+#include <geos/triangulate/quadedge/WalkingQuadEdgeLocator.h>
+#include <geos/util/parallel.h>
+#include <geos/util.h>
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <unordered_set>
+
+using geos::detail::make_unique;
+using geos::geom::Coordinate;
+using geos::geom::Envelope;
+using geos::geom::Geometry;
+using geos::geom::GeometryCollection;
+using geos::geom::GeometryFactory;
+
+namespace geos {
+namespace triangulate { //geos.triangulate
+
+namespace {
+
+/**
+ * The area around a tile whose sites are triangulated:
+ * an envelope around the tile, and boxes added around sites found
+ * to be missing.
+ */
+struct HaloRegion {
+    Envelope base;
+    std::vector<Envelope> boxes;
+
+    bool
+    covers(const Envelope& env) const
+    {
+        if (base.covers(env)) {
+            return true;
+        }
+        for (const Envelope& box : boxes) {
+            if (box.covers(env)) {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+/**
+ * Finds the nearest site outside a region which lies strictly inside
+ * a disk, shrinking the disk to the distance of each site found.
+ * Index nodes which are outside the disk, or are covered by the region,
+ * are skipped.
+ */
+template<typename Node>
+void
+findSiteInDisk(const Node& node, const Coordinate& p, double& radius,
+               const HaloRegion& region, const std::unordered_set<std::size_t>& regionSites,
+               const std::vector<Coordinate>& sites, const Coordinate*& nearSite)
+{
+    const Envelope& env = node.getBounds();
+    if (env.distance(Envelope(p)) >= radius || region.covers(env)) {
+        return;
+    }
+    if (node.isLeaf()) {
+        const Coordinate& q = sites[node.getItem()];
+        double dist = q.distance(p);
+        if (dist < radius && regionSites.count(node.getItem()) == 0) {
+            radius = dist;
+            nearSite = &q;
+        }
+        return;
+    }
+    for (const Node* child = node.beginChildren(); child < node.endChildren(); ++child) {
+        findSiteInDisk(*child, p, radius, region, regionSites, sites, nearSite);
+    }
+}
+
+} // anonymous namespace
+
+PartitionedVoronoiDiagramBuilder::PartitionedVoronoiDiagramBuilder() :
+    tolerance(0.0), clipEnv(nullptr), numThreads(1), maxTileSize(50000)
+{
+}
+
+void
+PartitionedVoronoiDiagramBuilder::setSites(const geom::Geometry& geom)
+{
+    siteCoords = DelaunayTriangulationBuilder::extractUniqueCoordinates(geom);
+}
+
+void
+PartitionedVoronoiDiagramBuilder::setSites(const geom::CoordinateSequence& coords)
+{
+    siteCoords = DelaunayTriangulationBuilder::unique(&coords);
+}
+
+void
+PartitionedVoronoiDiagramBuilder::setClipEnvelope(const geom::Envelope* nClipEnv)
+{
+    clipEnv = nClipEnv;
+}
+
+void
+PartitionedVoronoiDiagramBuilder::setTolerance(double nTolerance)
+{
+    tolerance = nTolerance;
+}
+
+void
+PartitionedVoronoiDiagramBuilder::setNumThreads(std::size_t nNumThreads)
+{
+    numThreads = nNumThreads;
+}
+
+void
+PartitionedVoronoiDiagramBuilder::setMaxTileSize(std::size_t nMaxTileSize)
+{
+    maxTileSize = std::max<std::size_t>(nMaxTileSize, 1);
+}
+
+std::unique_ptr<GeometryCollection>
+PartitionedVoronoiDiagramBuilder::getDiagram(const GeometryFactory& geomFact)
+{
+    std::vector<std::unique_ptr<Geometry>> cells;
+    getDiagram(geomFact, [&cells](std::unique_ptr<Geometry> cell) {
+        cells.push_back(std::move(cell));
+    });
+    return geomFact.createGeometryCollection(std::move(cells));
+}
+
+void
+PartitionedVoronoiDiagramBuilder::getDiagram(const GeometryFactory& geomFact,
+        const std::function<void(std::unique_ptr<Geometry>)>& visitor)
+{
+    if (!siteCoords || siteCoords->isEmpty()) {
+        return;
+    }
+
+    std::vector<Coordinate> sites;
+    siteCoords->toVector(sites);
+
+    // the same diagram envelope as VoronoiDiagramBuilder, so that
+    // the subdivision frames and the clipping are the same
+    Envelope siteEnv = siteCoords->getEnvelope();
+    Envelope diagramEnv = siteEnv;
+    double expandBy = std::max(diagramEnv.getWidth(), diagramEnv.getHeight());
+    diagramEnv.expandBy(expandBy);
+    if (clipEnv) {
+        diagramEnv.expandToInclude(clipEnv);
+    }
+
+    index::strtree::TemplateSTRtree<std::size_t> siteIndex(10, sites.size());
+    for (std::size_t i = 0; i < sites.size(); i++) {
+        siteIndex.insert(Envelope(sites[i]), i);
+    }
+    siteIndex.build();
+
+    std::vector<Tile> tiles = createTiles(sites);
+
+    // tiles are computed in batches, and emitted in order
+    std::size_t batchSize = 4 * (numThreads == 0 ? util::hardwareThreadCount() : numThreads);
+    for (std::size_t batchStart = 0; batchStart < tiles.size(); batchStart += batchSize) {
+        std::size_t batchEnd = std::min(batchStart + batchSize, tiles.size());
+        std::vector<std::vector<std::unique_ptr<Geometry>>> tileCells(batchEnd - batchStart);
+        util::parallelFor(tileCells.size(), numThreads, [&](std::size_t i) {
+            tileCells[i] = computeTile(tiles[batchStart + i], sites, siteIndex, diagramEnv, geomFact);
+        });
+        for (auto& cells : tileCells) {
+            for (auto& cell : cells) {
+                if (cell) {
+                    visitor(std::move(cell));
+                }
+            }
+        }
+    }
+}
+
+/* private */
+std::vector<PartitionedVoronoiDiagramBuilder::Tile>
+PartitionedVoronoiDiagramBuilder::createTiles(const std::vector<Coordinate>& sites) const
+{
+    // Sites are sorted by x. They are split into vertical strips of equal
+    // size, and each strip into tiles of equal size by y.
+    std::size_t n = sites.size();
+    std::size_t numTiles = (n + maxTileSize - 1) / maxTileSize;
+
+    Envelope siteEnv;
+    for (const Coordinate& p : sites) {
+        siteEnv.expandToInclude(p);
+    }
+    double aspect = siteEnv.getHeight() > 0 ? siteEnv.getWidth() / siteEnv.getHeight() : 1.0;
+    std::size_t numStrips = static_cast<std::size_t>(std::round(std::sqrt(static_cast<double>(numTiles) * aspect)));
+    numStrips = std::max<std::size_t>(1, std::min(numStrips, numTiles));
+    std::size_t tilesPerStrip = (numTiles + numStrips - 1) / numStrips;
+
+    std::vector<Tile> tiles;
+    for (std::size_t s = 0; s < numStrips; s++) {
+        std::size_t stripStart = n * s / numStrips;
+        std::size_t stripEnd = n * (s + 1) / numStrips;
+
+        std::vector<std::size_t> strip;
+        strip.reserve(stripEnd - stripStart);
+        for (std::size_t i = stripStart; i < stripEnd; i++) {
+            strip.push_back(i);
+        }
+        std::sort(strip.begin(), strip.end(), [&sites](std::size_t a, std::size_t b) {
+            if (sites[a].y != sites[b].y) {
+                return sites[a].y < sites[b].y;
+            }
+            return a < b;
+        });
+
+        for (std::size_t t = 0; t < tilesPerStrip; t++) {
+            std::size_t tileStart = strip.size() * t / tilesPerStrip;
+            std::size_t tileEnd = strip.size() * (t + 1) / tilesPerStrip;
+            if (tileStart == tileEnd) {
+                continue;
+            }
+            Tile tile;
+            tile.siteIndexes.assign(strip.begin() + static_cast<std::ptrdiff_t>(tileStart),
+                                    strip.begin() + static_cast<std::ptrdiff_t>(tileEnd));
+            std::sort(tile.siteIndexes.begin(), tile.siteIndexes.end());
+            for (std::size_t i : tile.siteIndexes) {
+                tile.env.expandToInclude(sites[i]);
+            }
+            tiles.push_back(std::move(tile));
+        }
+    }
+    return tiles;
+}
+
+/* private */
+std::vector<std::unique_ptr<Geometry>>
+PartitionedVoronoiDiagramBuilder::computeTile(
+    const Tile& tile,
+    const std::vector<Coordinate>& sites,
+    index::strtree::TemplateSTRtree<std::size_t>& siteIndex,
+    const Envelope& diagramEnv,
+    const GeometryFactory& geomFact) const
+{
+    std::unordered_map<Coordinate, std::size_t, Coordinate::HashCode> tileSitePos;
+    for (std::size_t i = 0; i < tile.siteIndexes.size(); i++) {
+        tileSitePos[sites[tile.siteIndexes[i]]] = i;
+    }
+
+    // the initial halo is a few times the mean site spacing
+    double spacing = std::sqrt(tile.env.getArea() / static_cast<double>(tile.siteIndexes.size()));
+    if (spacing == 0) {
+        spacing = std::max(tile.env.getWidth(), tile.env.getHeight()) / static_cast<double>(tile.siteIndexes.size());
+    }
+    HaloRegion region;
+    region.base = tile.env;
+    region.base.expandBy(3 * spacing);
+    std::vector<Envelope> newBoxes = { region.base };
+
+    std::unique_ptr<Geometry> clipPoly(geomFact.toGeometry(&diagramEnv));
+
+    quadedge::QuadEdgeSubdivision subdiv(diagramEnv, tolerance);
+    subdiv.setLocator(make_unique<quadedge::WalkingQuadEdgeLocator>(&subdiv));
+    IncrementalDelaunayTriangulator triangulator(&subdiv);
+    std::unordered_set<std::size_t> regionSites;
+
+    std::vector<std::unique_ptr<Geometry>> cells(tile.siteIndexes.size());
+    std::vector<char> isPending(tile.siteIndexes.size(), 1);
+    while (!newBoxes.empty()) {
+        // add the sites in the new boxes which are not yet triangulated
+        std::vector<std::size_t> boxSites;
+        for (const Envelope& box : newBoxes) {
+            siteIndex.query(box, boxSites);
+        }
+        std::sort(boxSites.begin(), boxSites.end());
+
+        IncrementalDelaunayTriangulator::VertexList vertices;
+        vertices.reserve(boxSites.size());
+        for (std::size_t i : boxSites) {
+            if (regionSites.insert(i).second) {
+                vertices.emplace_back(sites[i]);
+            }
+        }
+        DelaunayTriangulationBuilder::spatialSort(vertices);
+        triangulator.insertSites(vertices);
+        newBoxes.clear();
+
+        subdiv.computeVoronoiVertices();
+        std::unique_ptr<quadedge::QuadEdgeSubdivision::QuadEdgeList> edges = subdiv.getVertexUniqueEdges(false);
+
+        for (const quadedge::QuadEdge* qe : *edges) {
+            const Coordinate& site = qe->orig().getCoordinate();
+            auto it = tileSitePos.find(site);
+            if (it == tileSitePos.end() || !isPending[it->second]) {
+                continue;
+            }
+            isPending[it->second] = 0;
+
+            // clip as VoronoiDiagramBuilder does
+            std::unique_ptr<Geometry>& cell = cells[it->second];
+            cell = subdiv.getVoronoiCellPolygon(qe, geomFact);
+            if (!diagramEnv.contains(cell->getEnvelopeInternal())) {
+                if (diagramEnv.intersects(cell->getEnvelopeInternal())) {
+                    cell = clipPoly->intersection(cell.get());
+                }
+                if (cell->isEmpty() || !diagramEnv.intersects(cell->getEnvelopeInternal())) {
+                    cell.reset();
+                    continue;
+                }
+            }
+
+            // the cell is exact if no site outside the region is
+            // nearer to a cell vertex than the cell site
+            std::unique_ptr<geom::CoordinateSequence> cellPts = cell->getCoordinates();
+            for (std::size_t j = 0; j < cellPts->size(); j++) {
+                const Coordinate& p = cellPts->getAt(j);
+                double radius = p.distance(site);
+                if (region.covers(Envelope(p.x - radius, p.x + radius, p.y - radius, p.y + radius))) {
+                    continue;
+                }
+                const Coordinate* nearSite = nullptr;
+                findSiteInDisk(*siteIndex.getRoot(), p, radius, region, regionSites, sites, nearSite);
+                if (nearSite) {
+                    Envelope box(*nearSite);
+                    box.expandBy(3 * spacing);
+                    newBoxes.push_back(box);
+                    isPending[it->second] = 1;
+                }
+            }
+        }
+        region.boxes.insert(region.boxes.end(), newBoxes.begin(), newBoxes.end());
+    }
+    return cells;
+}
+
+} //namespace geos.triangulate
+} //namespace geos
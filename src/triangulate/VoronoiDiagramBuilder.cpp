@@ -30,6 +30,7 @@
 #include <geos/triangulate/IncrementalDelaunayTriangulator.h>
 #include <geos/triangulate/DelaunayTriangulationBuilder.h>
 #include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
+#include <geos/triangulate/quadedge/WalkingQuadEdgeLocator.h>
 #include <geos/operation/valid/RepeatedPointRemover.h>
 #include <geos/util.h>
 
@@ -42,7 +43,7 @@ using namespace geos::geom;
 
 
 VoronoiDiagramBuilder::VoronoiDiagramBuilder() :
-    tolerance(0.0), clipEnv(nullptr)
+    tolerance(0.0), isSpatialSort(false), clipEnv(nullptr)
 {
 }
 
@@ -70,6 +71,12 @@ VoronoiDiagramBuilder::setTolerance(double nTolerance)
     tolerance = nTolerance;
 }
 
+void
+VoronoiDiagramBuilder::setSpatialSort(bool p_isSpatialSort)
+{
+    isSpatialSort = p_isSpatialSort;
+}
+
 void
 VoronoiDiagramBuilder::create()
 {
@@ -90,9 +97,15 @@ VoronoiDiagramBuilder::create()
     }
 
     auto vertices = DelaunayTriangulationBuilder::toVertices(*siteCoords);
-    std::sort(vertices.begin(), vertices.end()); // Best performance from locator when inserting points near each other
 
     subdiv.reset(new quadedge::QuadEdgeSubdivision(diagramEnv, tolerance));
+    if (isSpatialSort) {
+        DelaunayTriangulationBuilder::spatialSort(vertices);
+        subdiv->setLocator(make_unique<quadedge::WalkingQuadEdgeLocator>(subdiv.get()));
+    }
+    else {
+        std::sort(vertices.begin(), vertices.end()); // Best performance from locator when inserting points near each other
+    }
     IncrementalDelaunayTriangulator triangulator(subdiv.get());
     triangulator.insertSites(vertices);
 }
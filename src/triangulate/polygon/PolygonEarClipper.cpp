@@ -25,6 +25,8 @@
 #include <geos/triangulate/polygon/PolygonEarClipper.h>
 #include <geos/util/IllegalStateException.h>
 
+#include <algorithm>
+
 using geos::algorithm::Orientation;
 using geos::algorithm::Angle;
 using geos::triangulate::tri::TriList;
@@ -39,9 +41,11 @@ PolygonEarClipper::PolygonEarClipper(std::vector<Coordinate>& polyShell)
     : vertex(polyShell)
     , vertexSize(polyShell.size()-1)
     , vertexFirst(0)
-    , vertexCoordIndex(polyShell)
 {
     vertexNext = createNextLinks(vertexSize);
+    vertexPrev = createPrevLinks(vertexSize);
+    vertexRepeat = createRepeatLinks();
+    initCandidates();
     initCornerIndex();
 }
 
@@ -59,6 +63,79 @@ PolygonEarClipper::createNextLinks(std::size_t size) const
 }
 
 
+/* private */
+std::vector<std::size_t>
+PolygonEarClipper::createPrevLinks(std::size_t size) const
+{
+    std::vector<std::size_t> prev(size);
+    for (std::size_t i = 1; i < size; i++) {
+        prev[i] = i - 1;
+    }
+    prev[0] = size - 1;
+    return prev;
+}
+
+
+/* private */
+std::vector<std::size_t>
+PolygonEarClipper::createRepeatLinks() const
+{
+    std::vector<std::size_t> sorted(vertexSize);
+    for (std::size_t i = 0; i < vertexSize; i++) {
+        sorted[i] = i;
+    }
+    std::sort(sorted.begin(), sorted.end(), [this](std::size_t a, std::size_t b) {
+        return vertex[a].compareTo(vertex[b]) < 0;
+    });
+
+    std::vector<std::size_t> repeat(vertexSize);
+    std::size_t start = 0;
+    for (std::size_t i = 0; i < vertexSize; i++) {
+        bool isLast = i + 1 == vertexSize
+            || ! vertex[sorted[i]].equals2D(vertex[sorted[i + 1]]);
+        repeat[sorted[i]] = isLast ? sorted[start] : sorted[i + 1];
+        if (isLast) {
+            start = i + 1;
+        }
+    }
+    return repeat;
+}
+
+
+/* private */
+void
+PolygonEarClipper::initCandidates()
+{
+    // pass a copy: the constant has no out-of-line definition in C++11
+    vertexCandidate.assign(vertexSize, std::size_t(NO_VERTEX_INDEX));
+    for (std::size_t i = 0; i < vertexSize; i++) {
+        if (isRepeated(i) || ! isConvex(i)) {
+            vertexCandidate[i] = candidateVertex.size();
+            candidateVertex.push_back(i);
+            candidateCoord.push_back(vertex[i]);
+        }
+    }
+    candidateIndex.reset(new VertexSequencePackedRtree(candidateCoord));
+}
+
+
+/* private */
+bool
+PolygonEarClipper::isRepeated(std::size_t vertexIndex) const
+{
+    return vertexRepeat[vertexIndex] != vertexIndex;
+}
+
+
+/* private */
+bool
+PolygonEarClipper::isConvex(std::size_t vertexIndex) const
+{
+    return Orientation::CLOCKWISE == Orientation::index(
+        vertex[vertexPrev[vertexIndex]], vertex[vertexIndex], vertex[vertexNext[vertexIndex]]);
+}
+
+
 /* public static */
 void
 PolygonEarClipper::triangulate(std::vector<Coordinate>& polyShell, TriList<Tri>& triListResult)
@@ -158,18 +235,15 @@ PolygonEarClipper::isValidEar(std::size_t cornerIdx, const std::array<Coordinate
 std::size_t
 PolygonEarClipper::findIntersectingVertex(std::size_t cornerIdx, const std::array<Coordinate, 3>& corner) const
 {
-    Envelope cornerEnv = envelope(corner);
     std::vector<std::size_t> result;
-    vertexCoordIndex.query(cornerEnv, result);
+    candidateIndex->query(geom::Triangle(corner[0], corner[1], corner[2]), result);
 
     std::size_t dupApexIndex = NO_VERTEX_INDEX;
     //--- check for duplicate vertices
     for (std::size_t i = 0; i < result.size(); i++) {
-        std::size_t vertIndex = result[i];
+        std::size_t vertIndex = candidateVertex[result[i]];
 
-        if (vertIndex == cornerIdx ||
-            vertIndex == vertex.size() - 1 ||
-            isRemoved(vertIndex))
+        if (vertIndex == cornerIdx)
             continue;
 
         const Coordinate& v = vertex[vertIndex];
@@ -189,7 +263,7 @@ PolygonEarClipper::findIntersectingVertex(std::size_t cornerIdx, const std::arra
             continue;
         }
         //--- this is a properly intersecting vertex
-        else if (geom::Triangle::intersects(corner[0], corner[1], corner[2], v))
+        else
             return vertIndex;
     }
     if (dupApexIndex != NO_VERTEX_INDEX) {
@@ -205,52 +279,38 @@ PolygonEarClipper::isValidEarScan(std::size_t cornerIdx, const std::array<Coordi
 {
     double cornerAngle = Angle::angleBetweenOriented(corner[0], corner[1], corner[2]);
 
-    std::size_t currIndex = nextIndex(vertexFirst);
-    std::size_t prevIndex = vertexFirst;
-    for (std::size_t i = 0; i < vertexSize; i++) {
-        const Coordinate& vPrev = vertex[prevIndex];
-        const Coordinate& v = vertex[currIndex];
+    for (std::size_t currIndex = vertexRepeat[cornerIdx];
+            currIndex != cornerIdx;
+            currIndex = vertexRepeat[currIndex]) {
+        if (isRemoved(currIndex)) {
+            continue;
+        }
         /**
         * Because of hole-joining vertices can occur more than once.
         * If vertex is same as corner[1],
         * check whether either adjacent edge lies inside the ear corner.
         * If so the ear is invalid.
         */
-        if (currIndex != cornerIdx && v.equals2D(corner[1])) {
-            const Coordinate& vNext = vertex[nextIndex(currIndex)];
-
-            //TODO: for robustness use segment orientation instead
-            double aOut = Angle::angleBetweenOriented(corner[0], corner[1], vNext);
-            double aIn = Angle::angleBetweenOriented(corner[0], corner[1], vPrev);
-            if (aOut > 0 && aOut < cornerAngle ) {
-                return false;
-            }
-            if (aIn > 0 && aIn < cornerAngle) {
-                return false;
-            }
-            if (aOut == 0 && aIn == cornerAngle) {
-                return false;
-            }
+        const Coordinate& vPrev = vertex[vertexPrev[currIndex]];
+        const Coordinate& vNext = vertex[vertexNext[currIndex]];
+
+        //TODO: for robustness use segment orientation instead
+        double aOut = Angle::angleBetweenOriented(corner[0], corner[1], vNext);
+        double aIn = Angle::angleBetweenOriented(corner[0], corner[1], vPrev);
+        if (aOut > 0 && aOut < cornerAngle ) {
+            return false;
+        }
+        if (aIn > 0 && aIn < cornerAngle) {
+            return false;
+        }
+        if (aOut == 0 && aIn == cornerAngle) {
+            return false;
         }
-
-        //--- move to next vertex
-        prevIndex = currIndex;
-        currIndex = nextIndex(currIndex);
     }
     return true;
 }
 
 
-/* private static */
-Envelope
-PolygonEarClipper::envelope(const std::array<Coordinate, 3>& corner)
-{
-    Envelope cornerEnv(corner[0], corner[1]);
-    cornerEnv.expandToInclude(corner[2]);
-    return cornerEnv;
-}
-
-
 /* private */
 void
 PolygonEarClipper::removeCorner()
@@ -260,15 +320,33 @@ PolygonEarClipper::removeCorner()
         vertexFirst = vertexNext[cornerApexIndex];
     }
     vertexNext[cornerIndex[0]] = vertexNext[cornerApexIndex];
-    vertexCoordIndex.remove(cornerApexIndex);
+    vertexPrev[vertexNext[cornerApexIndex]] = cornerIndex[0];
+    removeCandidate(cornerApexIndex);
     vertexNext[cornerApexIndex] = NO_VERTEX_INDEX;
     vertexSize--;
+    //-- a neighbour which has become convex is no longer a candidate
+    for (std::size_t neighbour : { cornerIndex[0], cornerIndex[2] }) {
+        if (! isRepeated(neighbour) && isConvex(neighbour)) {
+            removeCandidate(neighbour);
+        }
+    }
     //-- adjust following corner indexes
     cornerIndex[1] = nextIndex(cornerIndex[0]);
     cornerIndex[2] = nextIndex(cornerIndex[1]);
 }
 
 
+/* private */
+void
+PolygonEarClipper::removeCandidate(std::size_t vertexIndex)
+{
+    if (vertexCandidate[vertexIndex] != NO_VERTEX_INDEX) {
+        candidateIndex->remove(vertexCandidate[vertexIndex]);
+        vertexCandidate[vertexIndex] = NO_VERTEX_INDEX;
+    }
+}
+
+
 /* private */
 bool
 PolygonEarClipper::isRemoved(std::size_t vertexIndex) const
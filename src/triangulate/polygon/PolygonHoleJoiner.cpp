@@ -22,24 +22,19 @@
 #include <geos/geom/CoordinateSequenceFactory.h>
 #include <geos/geom/LinearRing.h>
 #include <geos/geom/Polygon.h>
-#include <geos/noding/BasicSegmentString.h>
-#include <geos/noding/MCIndexSegmentSetMutualIntersector.h>
-#include <geos/noding/SegmentIntersectionDetector.h>
-#include <geos/noding/SegmentString.h>
-#include <geos/noding/SegmentStringUtil.h>
 #include <geos/util/IllegalStateException.h>
 #include <geos/util/IllegalArgumentException.h>
 
 #include <geos/triangulate/polygon/PolygonHoleJoiner.h>
 
+#include <algorithm>
 #include <limits>
 
 
 using geos::geom::GeometryFactory;
 using geos::geom::CoordinateSequence;
 using geos::geom::CoordinateSequenceFactory;
-using geos::noding::SegmentString;
-using geos::noding::SegmentSetMutualIntersector;
+using geos::geom::LineSegment;
 
 namespace geos {
 namespace triangulate {
@@ -47,10 +42,11 @@ namespace polygon {
 
 
 PolygonHoleJoiner::PolygonHoleJoiner(const Polygon* p_inputPolygon)
-    : polygonIntersector(nullptr)
+    : shellFirst(NO_NODE)
+    , isLastCrossingValid(false)
     , inputPolygon(p_inputPolygon)
 {
-    polygonIntersector = createPolygonIntersector(p_inputPolygon);
+    indexPolygonSegments(p_inputPolygon);
     if(p_inputPolygon->getNumPoints() < 4)
         throw util::IllegalArgumentException("Input polygon has too few points");
 }
@@ -80,27 +76,119 @@ std::vector<Coordinate>
 PolygonHoleJoiner::compute()
 {
     //--- copy the input polygon shell coords
-    shellCoords = ringCoordinates(inputPolygon->getExteriorRing());
+    initShell(inputPolygon->getExteriorRing());
     if (inputPolygon->getNumInteriorRing() != 0) {
         joinHoles();
     }
-    return shellCoords;
+    return shellCoordinates();
 }
 
 
-/* private static */
-std::vector<Coordinate>
-PolygonHoleJoiner::ringCoordinates(const LinearRing* ring)
+/* private */
+void
+PolygonHoleJoiner::initShell(const LinearRing* ring)
 {
     const CoordinateSequence* cs = ring->getCoordinatesRO();
-    std::vector<Coordinate> coords(cs->size());
-    for (std::size_t i = 0; i < cs->size(); i++) {
-        coords[i] = cs->getAt(i);
+    std::size_t size = cs->size();
+    shellCoords.resize(size);
+    shellNext.resize(size);
+    shellPrev.resize(size);
+    shellOrder.resize(size);
+    for (std::size_t i = 0; i < size; i++) {
+        shellCoords[i] = cs->getAt(i);
+        shellNext[i] = i + 1 < size ? i + 1 : NO_NODE;
+        shellPrev[i] = i > 0 ? i - 1 : NO_NODE;
+        shellCoordNodes.emplace(shellCoords[i], i);
+    }
+    if (size > 0) {
+        shellFirst = 0;
+        labelShellNodes(0, size - 1, size);
+    }
+}
+
+
+/* private */
+std::vector<Coordinate>
+PolygonHoleJoiner::shellCoordinates() const
+{
+    std::vector<Coordinate> coords;
+    coords.reserve(shellCoords.size());
+    for (std::size_t node = shellFirst; node != NO_NODE; node = shellNext[node]) {
+        coords.push_back(shellCoords[node]);
     }
     return coords;
 }
 
 
+/* private */
+void
+PolygonHoleJoiner::insertShellSection(std::size_t node, const std::vector<Coordinate>& section)
+{
+    if (section.empty()) {
+        return;
+    }
+    std::size_t first = shellCoords.size();
+    std::size_t prev = shellPrev[node];
+    for (std::size_t i = 0; i < section.size(); i++) {
+        std::size_t newNode = shellCoords.size();
+        shellCoords.push_back(section[i]);
+        shellOrder.push_back(0);
+        shellPrev.push_back(prev);
+        shellNext.push_back(node);
+        if (prev == NO_NODE) {
+            shellFirst = newNode;
+        }
+        else {
+            shellNext[prev] = newNode;
+        }
+        shellPrev[node] = newNode;
+        shellCoordNodes.emplace(section[i], newNode);
+        prev = newNode;
+    }
+    labelShellNodes(first, prev, section.size());
+}
+
+
+/**
+* Labels a run of nodes, by spreading them evenly between the labels
+* of the nodes on either side.
+* If the label gap is too small, the run is extended on both sides,
+* doubling its size until its label range is sparse enough.
+* This keeps the number of nodes relabelled per insertion low on average.
+*/
+/* private */
+void
+PolygonHoleJoiner::labelShellNodes(std::size_t first, std::size_t last, std::size_t numNodes)
+{
+    while (true) {
+        std::size_t before = shellPrev[first];
+        std::size_t after = shellNext[last];
+        std::uint64_t lower = before == NO_NODE ? 0 : shellOrder[before];
+        std::uint64_t upper = after == NO_NODE ? std::numeric_limits<std::uint64_t>::max() : shellOrder[after];
+        std::uint64_t orderStep = (upper - lower) / (numNodes + 1);
+        bool isWholeRing = before == NO_NODE && after == NO_NODE;
+        if (isWholeRing || orderStep > numNodes) {
+            std::uint64_t order = lower;
+            for (std::size_t node = first; ; node = shellNext[node]) {
+                order += orderStep;
+                shellOrder[node] = order;
+                if (node == last)
+                    return;
+            }
+        }
+        std::size_t numExtend = numNodes / 2 + 1;
+        for (std::size_t i = 0; i < numExtend && shellPrev[first] != NO_NODE; i++) {
+            first = shellPrev[first];
+            numNodes++;
+        }
+        for (std::size_t i = 0; i < numExtend && shellNext[last] != NO_NODE; i++) {
+            last = shellNext[last];
+            numNodes++;
+        }
+    }
+}
+
+
 /* private */
 void
 PolygonHoleJoiner::joinHoles()
@@ -184,14 +272,34 @@ PolygonHoleJoiner::getShellCoordIndex(const Coordinate& shellVertex, const Coord
 std::size_t
 PolygonHoleJoiner::getShellCoordIndexSkip(const Coordinate& coord, std::size_t numSkip)
 {
-    for (std::size_t i = 0; i < shellCoords.size(); i++) {
-        if (shellCoords[i].equals2D(coord, EPS)) {
-            if (numSkip == 0)
-                return i;
-            numSkip--;
+    //-- find the nodes within tolerance of the coordinate
+    //-- (searching a slightly larger window, to be safe from rounding)
+    std::vector<std::size_t> nodes;
+    double searchDist = 2 * EPS;
+    auto it = shellCoordNodes.lower_bound(Coordinate(coord.x - searchDist, coord.y - searchDist));
+    while (it != shellCoordNodes.end() && it->first.x <= coord.x + searchDist) {
+        if (it->first.y < coord.y - searchDist) {
+            it = shellCoordNodes.lower_bound(Coordinate(it->first.x, coord.y - searchDist));
+        }
+        else if (it->first.y > coord.y + searchDist) {
+            it = shellCoordNodes.upper_bound(Coordinate(it->first.x, DoubleInfinity));
         }
+        else {
+            if (it->first.equals2D(coord, EPS)) {
+                nodes.push_back(it->second);
+            }
+            ++it;
+        }
+    }
+    if (numSkip >= nodes.size()) {
+        throw util::IllegalStateException("Vertex is not in shellcoords");
     }
-    throw util::IllegalStateException("Vertex is not in shellcoords");
+    //-- pick the match in ring order
+    std::nth_element(nodes.begin(), nodes.begin() + static_cast<long>(numSkip), nodes.end(),
+        [this](std::size_t a, std::size_t b) {
+            return shellOrder[a] < shellOrder[b];
+        });
+    return nodes[numSkip];
 }
 
 /* private */
@@ -228,7 +336,7 @@ PolygonHoleJoiner::findLeftShellVertices(const Coordinate& holeCoord)
 
 /* private */
 bool
-PolygonHoleJoiner::isJoinable(const Coordinate& holeCoord, const Coordinate& shellCoord) const
+PolygonHoleJoiner::isJoinable(const Coordinate& holeCoord, const Coordinate& shellCoord)
 {
     /**
      * Since the line runs between a hole and the shell,
@@ -250,26 +358,31 @@ PolygonHoleJoiner::isJoinable(const Coordinate& holeCoord, const Coordinate& she
 
 /* private */
 bool
-PolygonHoleJoiner::crossesPolygon(const Coordinate& p0, const Coordinate& p1) const
+PolygonHoleJoiner::crossesPolygon(const Coordinate& p0, const Coordinate& p1)
 {
-    // Build up a two-point SegmentString to pass to
-    // the SegmentIntersectionDetector
-    std::vector<Coordinate> coords;
-    coords.emplace_back(p0);
-    coords.emplace_back(p1);
-    auto* csf = inputPolygon->getFactory()->getCoordinateSequenceFactory();
-    auto cs = csf->create(std::move(coords));
-    noding::BasicSegmentString segString(cs.get(), nullptr);
-
-    std::vector<const SegmentString*> segStrings;
-    segStrings.push_back(&segString);
-
     algorithm::LineIntersector li;
-    noding::SegmentIntersectionDetector segInt(&li);
-    segInt.setFindProper(true);
-    polygonIntersector->setSegmentIntersector(&segInt);
-    polygonIntersector->process(&segStrings);
-    return segInt.hasProperIntersection();
+    /**
+    * Successive join candidates are often blocked by the same segment,
+    * so check the last crossing segment found first.
+    */
+    if (isLastCrossingValid) {
+        li.computeIntersection(p0, p1, lastCrossing.p0, lastCrossing.p1);
+        if (li.isProper()) {
+            return true;
+        }
+    }
+    bool isCrossing = false;
+    polygonSegmentIndex.query(geom::Envelope(p0, p1), [&](const LineSegment& seg) {
+        li.computeIntersection(p0, p1, seg.p0, seg.p1);
+        if (li.isProper()) {
+            isCrossing = true;
+            lastCrossing = seg;
+            isLastCrossingValid = true;
+            return false;
+        }
+        return true;
+    });
+    return isCrossing;
 }
 
 
@@ -299,11 +412,8 @@ PolygonHoleJoiner::addHoleToShell(std::size_t shellJoinIndex,
         newSection.emplace_back(holeCoords->getAt(holeJoinIndex));
     }
 
-    // Insert newCoords into shellCoords, starting at shellVertextIndex
-    shellCoords.insert(
-        shellCoords.begin() + static_cast<long>(shellJoinIndex),
-        newSection.begin(),
-        newSection.end());
+    // Insert newCoords into shellCoords, before shellJoinIndex
+    insertShellSection(shellJoinIndex, newSection);
     // Insert all newCoords into orderedCoords
     shellCoordsSorted.insert(newSection.begin(), newSection.end());
 }
@@ -342,22 +452,21 @@ PolygonHoleJoiner::findLeftVertices(const LinearRing* ring)
 }
 
 /* private */
-std::unique_ptr<SegmentSetMutualIntersector>
-PolygonHoleJoiner::createPolygonIntersector(const Polygon* polygon)
+void
+PolygonHoleJoiner::indexPolygonSegments(const Polygon* polygon)
 {
-    std::vector<const SegmentString*> polySegStrings;
-    noding::SegmentStringUtil::extractSegmentStrings(polygon, polySegStrings);
-
-    // Put the ownership on the PolygonHoleJoiner, so that
-    // when the joining is done, the SegmentStrings go away.
-    // TODO: xxxxxx Make extractSegmentStrings() return non-const pointers
-    // so that this cast and others go away
-    for (const SegmentString* ss: polySegStrings)
-        polySegStringStore.emplace_back(const_cast<SegmentString*>(ss));
-
-    std::unique_ptr<SegmentSetMutualIntersector> ssmi(new noding::MCIndexSegmentSetMutualIntersector());
-    ssmi->setBaseSegments(&polySegStrings);
-    return ssmi;
+    auto addRing = [this](const LinearRing* ring) {
+        const CoordinateSequence* cs = ring->getCoordinatesRO();
+        for (std::size_t i = 1; i < cs->size(); i++) {
+            const Coordinate& p0 = cs->getAt(i - 1);
+            const Coordinate& p1 = cs->getAt(i);
+            polygonSegmentIndex.insert(geom::Envelope(p0, p1), LineSegment(p0, p1));
+        }
+    };
+    addRing(polygon->getExteriorRing());
+    for (std::size_t i = 0; i < polygon->getNumInteriorRing(); i++) {
+        addRing(polygon->getInteriorRingN(i));
+    }
 }
 
 
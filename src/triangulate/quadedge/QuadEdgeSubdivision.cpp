@@ -138,24 +138,34 @@ QuadEdgeSubdivision::locateFromEdge(const Vertex& v,
 {
     ::geos::ignore_unused_variable_warning(startEdge);
 
+    /*
+     * So far it has always been the case that failure to locate indicates an
+     * invalid subdivision. So just fail completely. (An alternative would be
+     * to perform an exhaustive search for the containing triangle, but this
+     * would mask errors in the subdivision topology)
+     *
+     * This can also happen if two vertices are located very close together,
+     * since the orientation predicates may experience precision failures.
+     */
+    QuadEdge* e = walkFromEdge(v, *startingEdges[0]);
+    if(e == nullptr) {
+        throw LocateFailureException("Could not locate vertex.");
+    }
+    return e;
+}
+
+QuadEdge*
+QuadEdgeSubdivision::walkFromEdge(const Vertex& v, QuadEdge& startEdge) const
+{
     std::size_t iter = 0;
     auto maxIter = quadEdges.size();
 
-    QuadEdge* e = startingEdges[0];
+    QuadEdge* e = &startEdge;
 
     for(;;) {
         ++iter;
-        /*
-         * So far it has always been the case that failure to locate indicates an
-         * invalid subdivision. So just fail completely. (An alternative would be
-         * to perform an exhaustive search for the containing triangle, but this
-         * would mask errors in the subdivision topology)
-         *
-         * This can also happen if two vertices are located very close together,
-         * since the orientation predicates may experience precision failures.
-         */
         if(iter > maxIter) {
-            throw LocateFailureException("Could not locate vertex.");
+            return nullptr;
         }
 
         if((v.equals(e->orig())) || (v.equals(e->dest()))) {
@@ -487,13 +497,19 @@ QuadEdgeSubdivision::getVoronoiDiagramEdges(const geom::GeometryFactory& geomFac
     return geomFact.createMultiLineString(getVoronoiCellEdges(geomFact));
 }
 
+void
+QuadEdgeSubdivision::computeVoronoiVertices()
+{
+    TriangleCircumcentreVisitor tricircumVisitor;
+    visitTriangles(&tricircumVisitor, true);
+}
+
 std::vector<std::unique_ptr<geom::Geometry>>
 QuadEdgeSubdivision::getVoronoiCellPolygons(const geom::GeometryFactory& geomFact)
 {
     std::vector<std::unique_ptr<geom::Geometry>> cells;
-    TriangleCircumcentreVisitor tricircumVisitor;
 
-    visitTriangles(&tricircumVisitor, true);
+    computeVoronoiVertices();
 
     std::unique_ptr<QuadEdgeSubdivision::QuadEdgeList> edges = getVertexUniqueEdges(false);
 
@@ -509,9 +525,8 @@ std::vector<std::unique_ptr<geom::Geometry>>
 QuadEdgeSubdivision::getVoronoiCellEdges(const geom::GeometryFactory& geomFact)
 {
     std::vector<std::unique_ptr<geom::Geometry>> cells;
-    TriangleCircumcentreVisitor tricircumVisitor;
 
-    visitTriangles((TriangleVisitor*) &tricircumVisitor, true);
+    computeVoronoiVertices();
 
     std::unique_ptr<QuadEdgeSubdivision::QuadEdgeList> edges = getVertexUniqueEdges(false);
     cells.reserve(edges->size());
@@ -0,0 +1,43 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2023 the GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/triangulate/quadedge/WalkingQuadEdgeLocator.h>
+#include <geos/triangulate/quadedge/QuadEdgeSubdivision.h>
+
+namespace geos {
+namespace triangulate { //geos.triangulate
+namespace quadedge { //geos.triangulate.quadedge
+
+WalkingQuadEdgeLocator::WalkingQuadEdgeLocator(QuadEdgeSubdivision* p_subdiv) :
+    subdiv(p_subdiv), lastEdge(nullptr)
+{
+}
+
+QuadEdge*
+WalkingQuadEdgeLocator::locate(const Vertex& v)
+{
+    QuadEdge* e = nullptr;
+    if(lastEdge && lastEdge->isLive()) {
+        e = subdiv->walkFromEdge(v, *lastEdge);
+    }
+    if(e == nullptr) {
+        e = subdiv->locateFromEdge(v, subdiv->getEdges()[0].base());
+    }
+    lastEdge = e;
+    return e;
+}
+
+} //namespace geos.triangulate.quadedge
+} //namespace geos.triangulate
+} //namespace geos
@@ -20,6 +20,7 @@
 #include <sstream>
 #include <string>
 #include <memory>
+#include <vector>
 
 
 
@@ -237,6 +238,37 @@ void object::test<9>
 }
 
 
-} // namespace tut
+//
+// Batch computation gives the same circles as single computation
+//
+template<>
+template<>
+void object::test<10>
+()
+{
+    std::vector<std::string> wkts = {
+        "MULTIPOINT ((100 100), (100 200), (200 200), (200 100))",
+        "MULTILINESTRING ((40 90, 90 60), (90 40, 40 10))",
+        "MULTIPOINT ((10 10), (90 90), (20 80), (70 10))"
+    };
+    std::vector<std::unique_ptr<Geometry>> geoms;
+    std::vector<const Geometry*> geomPtrs;
+    for (const auto& wkt : wkts) {
+        geoms.push_back(reader_.read(wkt));
+        geomPtrs.push_back(geoms.back().get());
+    }
+
+    auto centers = LargestEmptyCircle::getCenters(geomPtrs, 0.001, 4);
+    auto radiusLines = LargestEmptyCircle::getRadiusLines(geomPtrs, 0.001, 4);
+    ensure_equals(centers.size(), geoms.size());
+    ensure_equals(radiusLines.size(), geoms.size());
+
+    for (std::size_t i = 0; i < geoms.size(); i++) {
+        LargestEmptyCircle lec(geoms[i].get(), 0.001);
+        ensure(centers[i]->equalsExact(lec.getCenter().get()));
+        ensure(radiusLines[i]->equalsExact(lec.getRadiusLine().get()));
+    }
+}
 
 
+} // namespace tut
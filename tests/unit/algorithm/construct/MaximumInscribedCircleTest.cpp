@@ -18,6 +18,7 @@
 #include <sstream>
 #include <string>
 #include <memory>
+#include <vector>
 
 
 
@@ -187,6 +188,37 @@ void object::test<7>
 }
 
 
+//
+// Batch computation gives the same circles as single computation
+//
+template<>
+template<>
+void object::test<8>
+()
+{
+    std::vector<std::string> wkts = {
+        "POLYGON ((100 200, 200 200, 200 100, 100 100, 100 200))",
+        "MULTIPOLYGON (((150 290, 10 230, 10 10, 150 60, 150 290)), ((170 290, 350 290, 350 10, 170 90, 170 290)))",
+        "POLYGON ((10 90, 90 90, 90 10, 10 10, 10 90), (20 80, 80 80, 80 20, 20 20, 20 80))"
+    };
+    std::vector<std::unique_ptr<Geometry>> geoms;
+    std::vector<const Geometry*> geomPtrs;
+    for (const auto& wkt : wkts) {
+        geoms.push_back(reader_.read(wkt));
+        geomPtrs.push_back(geoms.back().get());
+    }
+
+    auto centers = MaximumInscribedCircle::getCenters(geomPtrs, 0.001, 4);
+    auto radiusLines = MaximumInscribedCircle::getRadiusLines(geomPtrs, 0.001, 4);
+    ensure_equals(centers.size(), geoms.size());
+    ensure_equals(radiusLines.size(), geoms.size());
+
+    for (std::size_t i = 0; i < geoms.size(); i++) {
+        MaximumInscribedCircle mic(geoms[i].get(), 0.001);
+        ensure(centers[i]->equalsExact(mic.getCenter().get()));
+        ensure(radiusLines[i]->equalsExact(mic.getRadiusLine().get()));
+    }
+}
 
-} // namespace tut
 
+} // namespace tut
@@ -189,5 +189,36 @@ void object::test<13>
     GEOSWKTWriter_destroy(writer);
 }
 
-} // namespace tut
+// Write into a caller-provided buffer
+template<>
+template<>
+void object::test<14>
+()
+{
+    GEOSWKTWriter* writer = GEOSWKTWriter_create();
+    GEOSWKTWriter_setTrim(writer, 1);
+
+    geom1_ = GEOSGeomFromWKT("LINESTRING (0 0, 10.5 -1, 100 1e-3)");
+    std::string expected = "LINESTRING (0 0, 10.5 -1, 100 0.001)";
 
+    char buffer[64];
+    std::size_t length = 0;
+    ensure_equals(GEOSWKTWriter_writeToBuffer(writer, geom1_, buffer, sizeof(buffer), &length), 1);
+    ensure_equals(length, expected.size());
+    ensure_equals(std::string(buffer), expected);
+
+    // Output is truncated, and the length needed is reported
+    char small[12];
+    ensure_equals(GEOSWKTWriter_writeToBuffer(writer, geom1_, small, sizeof(small), &length), 1);
+    ensure_equals(length, expected.size());
+    ensure_equals(std::string(small), expected.substr(0, 11));
+
+    ensure_equals(GEOSWKTWriter_writeToBuffer(writer, geom1_, nullptr, 0, &length), 1);
+    ensure_equals(length, expected.size());
+
+    ensure_equals(GEOSWKTWriter_writeToBuffer(writer, geom1_, nullptr, 8, &length), 0);
+
+    GEOSWKTWriter_destroy(writer);
+}
+
+} // namespace tut
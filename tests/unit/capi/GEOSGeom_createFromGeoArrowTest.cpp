@@ -0,0 +1,160 @@
+// Test Suite for C-API GEOSGeom_createFromGeoArrow
+
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+// std
+#include <cstdint>
+#include <vector>
+
+#include "capi_test_utils.h"
+
+namespace tut {
+struct test_capiGEOSGeom_createFromGeoArrow : public capitest::utility {
+    static void
+    countRelease(void* userdata)
+    {
+        ++*static_cast<int*>(userdata);
+    }
+};
+
+typedef test_group<test_capiGEOSGeom_createFromGeoArrow> group;
+typedef group::object object;
+
+group test_capiGEOSGeom_createFromGeoArrow_group("capi::GEOSGeom_createFromGeoArrow");
+
+// XYZ polygons reference the buffer, which is released with the last geometry
+template <>
+template <>
+void object::test<1>() {
+    std::vector<double> coords {
+        0, 0, 0, 10, 0, 0, 10, 10, 0, 0, 10, 0, 0, 0, 0,
+        20, 20, 0, 30, 20, 0, 30, 30, 0, 20, 20, 0
+    };
+    const int32_t polygonOffsets[] = { 0, 1, 2 };
+    const int32_t ringOffsets[] = { 0, 5, 9 };
+    const int32_t* offsets[] = { polygonOffsets, ringOffsets };
+    int released = 0;
+    GEOSGeometry* geoms[2];
+
+    int ret = GEOSGeom_createFromGeoArrow(GEOS_POLYGON, coords.data(), 9, 1, offsets, 2,
+                                          countRelease, &released, geoms);
+    ensure_equals(ret, 1);
+    ensure_equals(released, 0);
+
+    ensure_geometry_equals(geoms[0], "POLYGON Z ((0 0 0, 10 0 0, 10 10 0, 0 10 0, 0 0 0))");
+
+    GEOSGeom_destroy(geoms[0]);
+    ensure_equals(released, 0);
+    GEOSGeom_destroy(geoms[1]);
+    ensure_equals(released, 1);
+}
+
+// Predicates, distance and prepared geometries on referencing geometries
+template <>
+template <>
+void object::test<2>() {
+    std::vector<double> coords {
+        0, 0, 0, 10, 0, 0, 10, 10, 0, 0, 10, 0, 0, 0, 0,
+        5, 5, 1, 20, 5, 1
+    };
+    const int32_t polygonOffsets[] = { 0, 1 };
+    const int32_t polygonRingOffsets[] = { 0, 5 };
+    const int32_t* polygonBuffers[] = { polygonOffsets, polygonRingOffsets };
+    const int32_t lineOffsets[] = { 5, 7 };
+    const int32_t* lineBuffers[] = { lineOffsets };
+    int released = 0;
+
+    GEOSGeometry* poly;
+    GEOSGeometry* line;
+    ensure_equals(GEOSGeom_createFromGeoArrow(GEOS_POLYGON, coords.data(), 7, 1, polygonBuffers, 1,
+                                              countRelease, &released, &poly), 1);
+    ensure_equals(GEOSGeom_createFromGeoArrow(GEOS_LINESTRING, coords.data(), 7, 1, lineBuffers, 1,
+                                              nullptr, nullptr, &line), 1);
+
+    geom1_ = GEOSGeomFromWKT("POINT (30 5)");
+
+    ensure_equals(GEOSIntersects(poly, line), 1);
+    ensure_equals(GEOSContains(poly, line), 0);
+    ensure_equals(GEOSIntersects(poly, geom1_), 0);
+
+    double d;
+    ensure_equals(GEOSDistance(poly, geom1_, &d), 1);
+    ensure_equals(d, 20);
+    ensure_equals(GEOSDistance(line, geom1_, &d), 1);
+    ensure_equals(d, 10);
+
+    const GEOSPreparedGeometry* prep = GEOSPrepare(poly);
+    ensure(prep != nullptr);
+    ensure_equals(GEOSPreparedIntersects(prep, line), 1);
+    ensure_equals(GEOSPreparedContainsProperly(prep, line), 0);
+    ensure_equals(GEOSPreparedIntersects(prep, geom1_), 0);
+    GEOSPreparedGeom_destroy(prep);
+
+    GEOSGeom_destroy(line);
+    GEOSGeom_destroy(poly);
+    ensure_equals(released, 1);
+}
+
+// XY multipoints are copied, the buffer is released immediately
+template <>
+template <>
+void object::test<3>() {
+    const double coords[] = { 1, 2, 3, 4, 5, 6 };
+    const int32_t geomOffsets[] = { 0, 2, 3 };
+    const int32_t* offsets[] = { geomOffsets };
+    int released = 0;
+    GEOSGeometry* geoms[2];
+
+    ensure_equals(GEOSGeom_createFromGeoArrow(GEOS_MULTIPOINT, coords, 3, 0, offsets, 2,
+                                              countRelease, &released, geoms), 1);
+    ensure_equals(released, 1);
+
+    ensure_geometry_equals(geoms[0], "MULTIPOINT ((1 2), (3 4))");
+    ensure_geometry_equals(geoms[1], "MULTIPOINT ((5 6))");
+
+    GEOSGeom_destroy(geoms[0]);
+    GEOSGeom_destroy(geoms[1]);
+}
+
+// Offsets out of range fail and release the buffer
+template <>
+template <>
+void object::test<4>() {
+    const double coords[] = { 0, 0, 1, 1 };
+    const int32_t lineOffsets[] = { 0, 3 };
+    const int32_t* offsets[] = { lineOffsets };
+    int released = 0;
+    GEOSGeometry* geom = nullptr;
+
+    ensure_equals(GEOSGeom_createFromGeoArrow(GEOS_LINESTRING, coords, 2, 0, offsets, 1,
+                                              countRelease, &released, &geom), 0);
+    ensure_equals(released, 1);
+    ensure(geom == nullptr);
+}
+
+// Null buffers and decreasing offsets fail and release the buffer
+template <>
+template <>
+void object::test<5>() {
+    const double coords[] = { 0, 0, 1, 1, 2, 2 };
+    const int32_t lineOffsets[] = { 0, 2, 1 };
+    const int32_t* offsets[] = { lineOffsets };
+    int released = 0;
+    GEOSGeometry* geoms[2] = { nullptr, nullptr };
+
+    ensure_equals(GEOSGeom_createFromGeoArrow(GEOS_LINESTRING, coords, 3, 0, offsets, 2,
+                                              countRelease, &released, geoms), 0);
+    ensure_equals(released, 1);
+
+    ensure_equals(GEOSGeom_createFromGeoArrow(GEOS_LINESTRING, coords, 3, 0, nullptr, 2,
+                                              countRelease, &released, geoms), 0);
+    ensure_equals(released, 2);
+
+    ensure_equals(GEOSGeom_createFromGeoArrow(GEOS_LINESTRING, nullptr, 3, 0, offsets, 2,
+                                              nullptr, nullptr, geoms), 0);
+    ensure(geoms[0] == nullptr);
+    ensure(geoms[1] == nullptr);
+}
+
+} // namespace tut
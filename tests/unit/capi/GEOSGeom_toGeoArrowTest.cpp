@@ -0,0 +1,129 @@
+// Test Suite for C-API GEOSGeom_toGeoArrow
+
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+// std
+#include <cstdint>
+#include <vector>
+
+#include "capi_test_utils.h"
+
+namespace tut {
+struct test_capiGEOSGeom_toGeoArrow : public capitest::utility {};
+
+typedef test_group<test_capiGEOSGeom_toGeoArrow> group;
+typedef group::object object;
+
+group test_capiGEOSGeom_toGeoArrow_group("capi::GEOSGeom_toGeoArrow");
+
+// Size, fill and read back polygons
+template <>
+template <>
+void object::test<1>() {
+    geom1_ = GEOSGeomFromWKT("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (1 1, 2 1, 2 2, 1 1))");
+    geom2_ = GEOSGeomFromWKT("POLYGON ((20 20, 30 20, 30 30, 20 20))");
+    const GEOSGeometry* geoms[] = { geom1_, geom2_ };
+
+    size_t numCoords = 0;
+    size_t numOffsets[3];
+    ensure_equals(GEOSGeom_toGeoArrow(GEOS_POLYGON, geoms, 2, 0, nullptr, &numCoords, nullptr, numOffsets), 1);
+    ensure_equals(numCoords, 13u);
+    ensure_equals(numOffsets[0], 3u);
+    ensure_equals(numOffsets[1], 4u);
+    ensure_equals(numOffsets[2], 0u);
+
+    std::vector<double> coords(2 * numCoords);
+    std::vector<int32_t> polygonOffsets(numOffsets[0]);
+    std::vector<int32_t> ringOffsets(numOffsets[1]);
+    int32_t* offsets[] = { polygonOffsets.data(), ringOffsets.data() };
+    ensure_equals(GEOSGeom_toGeoArrow(GEOS_POLYGON, geoms, 2, 0, coords.data(), &numCoords, offsets, numOffsets), 1);
+    ensure_equals(numCoords, 13u);
+    ensure(polygonOffsets == std::vector<int32_t>({ 0, 2, 3 }));
+    ensure(ringOffsets == std::vector<int32_t>({ 0, 5, 9, 13 }));
+
+    const int32_t* readOffsets[] = { polygonOffsets.data(), ringOffsets.data() };
+    GEOSGeometry* result[2];
+    ensure_equals(GEOSGeom_createFromGeoArrow(GEOS_POLYGON, coords.data(), numCoords, 0, readOffsets, 2,
+                                              nullptr, nullptr, result), 1);
+    ensure_equals(GEOSEqualsExact(result[0], geom1_, 0), 1);
+    ensure_equals(GEOSEqualsExact(result[1], geom2_, 0), 1);
+    GEOSGeom_destroy(result[0]);
+    GEOSGeom_destroy(result[1]);
+}
+
+// Points with Z
+template <>
+template <>
+void object::test<2>() {
+    geom1_ = GEOSGeomFromWKT("POINT Z (1 2 3)");
+    geom2_ = GEOSGeomFromWKT("POINT Z (4 5 6)");
+    const GEOSGeometry* geoms[] = { geom1_, geom2_ };
+
+    double coords[6];
+    size_t numCoords = 2;
+    size_t numOffsets[3] = { 0, 0, 0 };
+    ensure_equals(GEOSGeom_toGeoArrow(GEOS_POINT, geoms, 2, 1, coords, &numCoords, nullptr, numOffsets), 1);
+    ensure_equals(numCoords, 2u);
+    ensure_equals(coords[2], 3);
+    ensure_equals(coords[5], 6);
+}
+
+// Geometries of another type and buffers too small fail
+template <>
+template <>
+void object::test<3>() {
+    geom1_ = GEOSGeomFromWKT("LINESTRING (0 0, 1 1, 2 2)");
+    const GEOSGeometry* geoms[] = { geom1_ };
+
+    size_t numCoords;
+    size_t numOffsets[3];
+    ensure_equals(GEOSGeom_toGeoArrow(GEOS_POLYGON, geoms, 1, 0, nullptr, &numCoords, nullptr, numOffsets), 0);
+
+    double coords[4];
+    int32_t lineOffsets[2];
+    int32_t* offsets[] = { lineOffsets };
+    numCoords = 2;
+    numOffsets[0] = 2;
+    ensure_equals(GEOSGeom_toGeoArrow(GEOS_LINESTRING, geoms, 1, 0, coords, &numCoords, offsets, numOffsets), 0);
+}
+
+// A batch of empty and NULL geometries needs no coordinates, but its
+// offsets are written
+template <>
+template <>
+void object::test<4>() {
+    geom1_ = GEOSGeomFromWKT("MULTIPOLYGON EMPTY");
+    geom2_ = GEOSGeomFromWKT("POLYGON EMPTY");
+    const GEOSGeometry* geoms[] = { geom1_, nullptr, geom2_ };
+
+    size_t numCoords = 0;
+    size_t numOffsets[3];
+    ensure_equals(GEOSGeom_toGeoArrow(GEOS_MULTIPOLYGON, geoms, 3, 0, nullptr, &numCoords, nullptr, numOffsets), 1);
+    ensure_equals(numCoords, 0u);
+    ensure_equals(numOffsets[0], 4u);
+    ensure_equals(numOffsets[1], 1u);
+    ensure_equals(numOffsets[2], 1u);
+
+    std::vector<double> coords(2 * numCoords);
+    std::vector<int32_t> multiOffsets(numOffsets[0], -1);
+    std::vector<int32_t> polygonOffsets(numOffsets[1], -1);
+    std::vector<int32_t> ringOffsets(numOffsets[2], -1);
+    int32_t* offsets[] = { multiOffsets.data(), polygonOffsets.data(), ringOffsets.data() };
+    ensure_equals(GEOSGeom_toGeoArrow(GEOS_MULTIPOLYGON, geoms, 3, 0, coords.data(), &numCoords, offsets, numOffsets), 1);
+    ensure_equals(numCoords, 0u);
+    ensure(multiOffsets == std::vector<int32_t>({ 0, 0, 0, 0 }));
+    ensure(polygonOffsets == std::vector<int32_t>({ 0 }));
+    ensure(ringOffsets == std::vector<int32_t>({ 0 }));
+
+    const int32_t* readOffsets[] = { multiOffsets.data(), polygonOffsets.data(), ringOffsets.data() };
+    GEOSGeometry* result[3];
+    ensure_equals(GEOSGeom_createFromGeoArrow(GEOS_MULTIPOLYGON, coords.data(), numCoords, 0, readOffsets, 3,
+                                              nullptr, nullptr, result), 1);
+    for (GEOSGeometry* g : result) {
+        ensure_equals(GEOSisEmpty(g), 1);
+        GEOSGeom_destroy(g);
+    }
+}
+
+} // namespace tut
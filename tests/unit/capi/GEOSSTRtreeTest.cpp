@@ -417,6 +417,114 @@ void object::test<12>()
 }
 
 
+// queryWithinDistance finds the same pairs as brute force,
+// with or without threads
+template<>
+template<>
+void object::test<13>()
+{
+    std::vector<INTPOINT> pts1;
+    std::vector<INTPOINT> pts2;
+    for (int x = 0; x < 30; x++) {
+        for (int y = 0; y < 30; y++) {
+            pts1.emplace_back(x, y);
+            pts2.emplace_back(x * 2 + 1, y * 2);
+        }
+    }
+
+    GEOSSTRtree* tree1 = GEOSSTRtree_create(4);
+    GEOSSTRtree* tree2 = GEOSSTRtree_create(4);
+    for (auto& pt : pts1) {
+        GEOSGeometry* g = INTPOINT2GEOS(&pt);
+        GEOSSTRtree_insert(tree1, g, &pt);
+        GEOSGeom_destroy(g);
+    }
+    for (auto& pt : pts2) {
+        GEOSGeometry* g = INTPOINT2GEOS(&pt);
+        GEOSSTRtree_insert(tree2, g, &pt);
+        GEOSGeom_destroy(g);
+    }
+
+    std::size_t expected = 0;
+    for (auto& p1 : pts1) {
+        for (auto& p2 : pts2) {
+            double d;
+            INTPOINT_dist(&p1, &p2, &d, nullptr);
+            if (d <= 1.5) {
+                expected++;
+            }
+        }
+    }
+
+    using PairList = std::vector<std::pair<void*, void*>>;
+    auto collect = [](void* a, void* b, double d, void* userdata) {
+        ensure(d <= 1.5);
+        static_cast<PairList*>(userdata)->emplace_back(a, b);
+    };
+
+    PairList serial;
+    ensure_equals(GEOSSTRtree_queryWithinDistance(tree1, tree2, 1.5, INTPOINT_dist, collect, &serial, 1), 1);
+    ensure_equals(serial.size(), expected);
+
+    PairList parallel;
+    ensure_equals(GEOSSTRtree_queryWithinDistance(tree1, tree2, 1.5, INTPOINT_dist, collect, &parallel, 4), 1);
+    ensure(serial == parallel);
+
+    GEOSSTRtree_destroy(tree1);
+    GEOSSTRtree_destroy(tree2);
+}
+
+// nearestEach reports the nearest geometry for every item
+template<>
+template<>
+void object::test<14>()
+{
+    std::vector<GEOSGeometry*> geoms1;
+    std::vector<GEOSGeometry*> geoms2;
+    for (size_t i = 0; i < 50; i++) {
+        geoms1.push_back(GEOSGeom_createPointFromXY((double) i, 0.0));
+        geoms2.push_back(GEOSGeom_createPointFromXY((double) i + 0.25, 1.0));
+    }
+
+    GEOSSTRtree* tree1 = GEOSSTRtree_create(10);
+    GEOSSTRtree* tree2 = GEOSSTRtree_create(10);
+    for (auto* g : geoms1) {
+        GEOSSTRtree_insert(tree1, g, g);
+    }
+    for (auto* g : geoms2) {
+        GEOSSTRtree_insert(tree2, g, g);
+    }
+
+    using PairList = std::vector<std::pair<void*, void*>>;
+    auto collect = [](void* a, void* b, double, void* userdata) {
+        static_cast<PairList*>(userdata)->emplace_back(a, b);
+    };
+
+    PairList serial;
+    ensure_equals(GEOSSTRtree_nearestEach(tree1, tree2, nullptr, collect, &serial, 1), 1);
+    ensure_equals(serial.size(), geoms1.size());
+    for (const auto& pr : serial) {
+        double x1, x2;
+        GEOSGeomGetX(static_cast<GEOSGeometry*>(pr.first), &x1);
+        GEOSGeomGetX(static_cast<GEOSGeometry*>(pr.second), &x2);
+        ensure_equals(x2, x1 + 0.25);
+    }
+
+    PairList parallel;
+    ensure_equals(GEOSSTRtree_nearestEach(tree1, tree2, nullptr, collect, &parallel, 0), 1);
+    ensure(serial == parallel);
+
+    GEOSSTRtree_destroy(tree1);
+    GEOSSTRtree_destroy(tree2);
+    for (auto* g : geoms1) {
+        GEOSGeom_destroy(g);
+    }
+    for (auto* g : geoms2) {
+        GEOSGeom_destroy(g);
+    }
+}
+
+
 } // namespace tut
 
 
@@ -0,0 +1,99 @@
+// Test Suite for C-API GEOSTWKBReader and GEOSTWKBWriter
+
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+// std
+#include <vector>
+
+#include "capi_test_utils.h"
+
+namespace tut {
+struct test_capiGEOSTWKBReaderWriter : public capitest::utility {
+    GEOSTWKBReader* reader_ = nullptr;
+    GEOSTWKBWriter* writer_ = nullptr;
+
+    test_capiGEOSTWKBReaderWriter()
+    {
+        reader_ = GEOSTWKBReader_create();
+        writer_ = GEOSTWKBWriter_create();
+    }
+
+    ~test_capiGEOSTWKBReaderWriter()
+    {
+        GEOSTWKBReader_destroy(reader_);
+        GEOSTWKBWriter_destroy(writer_);
+    }
+};
+
+typedef test_group<test_capiGEOSTWKBReaderWriter> group;
+typedef group::object object;
+
+group test_capiGEOSTWKBReaderWriter_group("capi::GEOSTWKBReaderWriter");
+
+// Round trip with a precision
+template <>
+template <>
+void object::test<1>() {
+    geom1_ = GEOSGeomFromWKT("POLYGON Z ((0 0 1, 10.123 0 2, 10 10.456 3, 0 10 4, 0 0 1))");
+    ensure_equals(GEOSTWKBWriter_setPrecision(writer_, 1, 0), 1);
+    ensure_equals(GEOSTWKBWriter_setOutputDimension(writer_, 3), 1);
+    GEOSTWKBWriter_setIncludeSize(writer_, 1);
+    GEOSTWKBWriter_setIncludeBBox(writer_, 1);
+
+    size_t size = 0;
+    unsigned char* twkb = GEOSTWKBWriter_write(writer_, geom1_, &size);
+    ensure(twkb != nullptr);
+
+    size_t bytesRead = 0;
+    geom2_ = GEOSTWKBReader_read(reader_, twkb, size, &bytesRead);
+    GEOSFree(twkb);
+    ensure(geom2_ != nullptr);
+    ensure_equals(bytesRead, size);
+    ensure_equals(GEOSHasZ(geom2_), 1);
+    ensure_geometry_equals(geom2_, "POLYGON Z ((0 0 1, 10.1 0 2, 10 10.5 3, 0 10 4, 0 0 1))");
+}
+
+// Read geometries written one after the other
+template <>
+template <>
+void object::test<2>() {
+    geom1_ = GEOSGeomFromWKT("POINT (1 2)");
+    geom2_ = GEOSGeomFromWKT("LINESTRING (3 4, 5 6)");
+
+    std::vector<unsigned char> buf;
+    for (const GEOSGeometry* g : { geom1_, geom2_ }) {
+        size_t size;
+        unsigned char* twkb = GEOSTWKBWriter_write(writer_, g, &size);
+        buf.insert(buf.end(), twkb, twkb + size);
+        GEOSFree(twkb);
+    }
+
+    size_t offset = 0;
+    size_t bytesRead;
+    for (const GEOSGeometry* expected : { geom1_, geom2_ }) {
+        GEOSGeometry* g = GEOSTWKBReader_read(reader_, buf.data() + offset, buf.size() - offset, &bytesRead);
+        ensure(g != nullptr);
+        ensure_equals(GEOSEqualsExact(g, expected, 0), 1);
+        GEOSGeom_destroy(g);
+        offset += bytesRead;
+    }
+    ensure_equals(offset, buf.size());
+}
+
+// Errors
+template <>
+template <>
+void object::test<3>() {
+    ensure_equals(GEOSTWKBWriter_setPrecision(writer_, 8, 0), 0);
+    ensure_equals(GEOSTWKBWriter_setOutputDimension(writer_, 4), 0);
+
+    const unsigned char truncated[] = { 0x02, 0x00, 0x02, 0x04 };
+    ensure(GEOSTWKBReader_read(reader_, truncated, sizeof(truncated), nullptr) == nullptr);
+
+    geom1_ = GEOSGeomFromWKT("MULTIPOINT ((0 0), EMPTY)");
+    size_t size;
+    ensure(GEOSTWKBWriter_write(writer_, geom1_, &size) == nullptr);
+}
+
+} // namespace tut
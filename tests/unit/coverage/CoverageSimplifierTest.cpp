@@ -0,0 +1,178 @@
+//
+// Test Suite for geos::coverage::CoverageSimplifier class.
+
+#include <tut/tut.hpp>
+#include <utility.h>
+
+// geos
+#include <geos/coverage/CoverageSimplifier.h>
+#include <geos/coverage/CoverageValidator.h>
+
+using geos::coverage::CoverageSimplifier;
+using geos::coverage::CoverageValidator;
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used by all tests
+struct test_coveragesimplifier_data {
+
+    WKTReader r;
+    WKTWriter w;
+
+    std::vector<std::unique_ptr<Geometry>>
+    readList(const std::vector<std::string>& wkt_geoms)
+    {
+        std::vector<std::unique_ptr<Geometry>> geoms;
+        for (const auto& wkt : wkt_geoms) {
+            geoms.push_back(r.read(wkt));
+        }
+        return geoms;
+    }
+
+    std::vector<const Geometry*>
+    toCoverage(std::vector<std::unique_ptr<Geometry>>& geoms)
+    {
+        std::vector<const Geometry*> coverage;
+        for (const auto& geom : geoms) {
+            coverage.push_back(geom.get());
+        }
+        return coverage;
+    }
+
+    void
+    checkResult(const std::vector<std::string>& wkt_geoms,
+                double tolerance,
+                const std::vector<std::string>& wkt_expected)
+    {
+        std::vector<std::unique_ptr<Geometry>> geoms = readList(wkt_geoms);
+        std::vector<const Geometry*> coverage = toCoverage(geoms);
+        std::vector<std::unique_ptr<Geometry>> expected = readList(wkt_expected);
+
+        std::vector<std::unique_ptr<Geometry>> result = CoverageSimplifier::simplify(coverage, tolerance);
+
+        ensure_equals("result size", result.size(), expected.size());
+        for (std::size_t i = 0; i < result.size(); i++) {
+            ensure_equals_geometry(result[i].get(), expected[i].get());
+        }
+        std::vector<const Geometry*> resultCoverage = toCoverage(result);
+        ensure("result coverage is valid", CoverageValidator::isValid(resultCoverage));
+    }
+
+};
+
+
+typedef test_group<test_coveragesimplifier_data> group;
+typedef group::object object;
+
+group test_coveragesimplifier_data("geos::coverage::CoverageSimplifier");
+
+
+// Noisy shared edge is simplified identically for both polygons
+template<>
+template<>
+void object::test<1> ()
+{
+    checkResult({
+        "POLYGON ((0 0, 0 10, 5 10.1, 10 10, 10 0, 0 0))",
+        "POLYGON ((0 10, 0 20, 10 20, 10 10, 5 10.1, 0 10))"
+    }, 1.0, {
+        "POLYGON ((0 0, 0 10, 10 10, 10 0, 0 0))",
+        "POLYGON ((0 10, 0 20, 10 20, 10 10, 0 10))"
+    });
+}
+
+// Simplification does not move an edge across a vertex of another edge
+template<>
+template<>
+void object::test<2> ()
+{
+    checkResult({
+        "POLYGON ((0 0, 0 10, 5 12, 10 10, 10 0, 0 0))",
+        "POLYGON ((0 10, 0 20, 10 20, 10 10, 5 12, 0 10), (4 11.5, 5 11.5, 5 11.8, 4 11.5))",
+        "POLYGON ((4 11.5, 5 11.8, 5 11.5, 4 11.5))"
+    }, 5.0, {
+        "POLYGON ((0 0, 0 10, 5 12, 10 10, 10 0, 0 0))",
+        "POLYGON ((0 10, 0 20, 10 20, 10 10, 5 12, 0 10), (4 11.5, 5 11.5, 5 11.8, 4 11.5))",
+        "POLYGON ((4 11.5, 5 11.8, 5 11.5, 4 11.5))"
+    });
+}
+
+// Rings are not collapsed
+template<>
+template<>
+void object::test<3> ()
+{
+    checkResult({
+        "POLYGON ((0 0, 1 5, 2 0, 0 0))",
+        "POLYGON ((10 0, 10 10, 11 10, 11 9, 12 10, 20 10, 20 0, 10 0))"
+    }, 100.0, {
+        "POLYGON ((0 0, 1 5, 2 0, 0 0))",
+        "POLYGON ((10 0, 10 10, 20 10, 10 0))"
+    });
+}
+
+// Hole and filling island are simplified consistently
+template<>
+template<>
+void object::test<4> ()
+{
+    checkResult({
+        "POLYGON ((0 0, 0 100, 100 100, 100 0, 0 0), (20 20, 20 80, 50 81, 80 80, 80 20, 50 19, 20 20))",
+        "POLYGON ((20 20, 20 80, 50 81, 80 80, 80 20, 50 19, 20 20))"
+    }, 2.0, {
+        "POLYGON ((0 0, 0 100, 100 100, 100 0, 0 0), (20 20, 20 80, 80 80, 80 20, 20 20))",
+        "POLYGON ((20 20, 20 80, 80 80, 80 20, 20 20))"
+    });
+}
+
+// Multi-threaded simplification gives the same result as serial
+template<>
+template<>
+void object::test<5> ()
+{
+    //-- a grid of cells sharing noisy edges
+    std::vector<std::unique_ptr<Geometry>> geoms;
+    const int n = 8;
+    auto noise = [](int i, int j) {
+        return 0.1 * ((i * 7 + j * 13) % 5);
+    };
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            double x0 = i * 10;
+            double y0 = j * 10;
+            std::ostringstream wkt;
+            wkt << "POLYGON ((" << x0 << " " << y0
+                << ", " << x0 + noise(i, j) << " " << y0 + 5
+                << ", " << x0 << " " << y0 + 10
+                << ", " << x0 + 5 << " " << y0 + 10 + noise(i, j + 1)
+                << ", " << x0 + 10 << " " << y0 + 10
+                << ", " << x0 + 10 + noise(i + 1, j) << " " << y0 + 5
+                << ", " << x0 + 10 << " " << y0
+                << ", " << x0 + 5 << " " << y0 + noise(i, j)
+                << ", " << x0 << " " << y0 << "))";
+            geoms.push_back(r.read(wkt.str()));
+        }
+    }
+    std::vector<const Geometry*> coverage = toCoverage(geoms);
+    ensure("input coverage is valid", CoverageValidator::isValid(coverage));
+
+    CoverageSimplifier serial(coverage);
+    std::vector<std::unique_ptr<Geometry>> expected = serial.simplify(0.3);
+
+    CoverageSimplifier parallel(coverage);
+    parallel.setNumThreads(4);
+    std::vector<std::unique_ptr<Geometry>> result = parallel.simplify(0.3);
+
+    ensure_equals(result.size(), expected.size());
+    for (std::size_t i = 0; i < result.size(); i++) {
+        ensure_equals(w.write(result[i].get()), w.write(expected[i].get()));
+    }
+    std::vector<const Geometry*> resultCoverage = toCoverage(result);
+    ensure("result coverage is valid", CoverageValidator::isValid(resultCoverage));
+}
+
+
+} // namespace tut
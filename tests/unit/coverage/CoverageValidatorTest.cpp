@@ -262,4 +262,113 @@ void object::test<10> ()
     checkValid(coverage);
 }
 
+// testParallel
+template<>
+template<>
+void object::test<11> ()
+{
+    // a grid of squares, some with a corner moved into a neighbour
+    std::vector<std::string> wkts;
+    for (int i = 0; i < 20; i++) {
+        for (int j = 0; j < 20; j++) {
+            double offset = (i * 20 + j) % 7 == 0 ? 0.3 : 0;
+            std::ostringstream wkt;
+            wkt << "POLYGON ((" << i << " " << j << ", " << (i + 1 + offset) << " " << j
+                << ", " << (i + 1) << " " << (j + 1) << ", " << i << " " << (j + 1)
+                << ", " << i << " " << j << "))";
+            wkts.push_back(wkt.str());
+        }
+    }
+    std::vector<std::unique_ptr<Geometry>> geoms = readList(wkts);
+    std::vector<const Geometry*> coverage = toCoverage(geoms);
+
+    std::vector<std::unique_ptr<Geometry>> expected = CoverageValidator::validate(coverage);
+    ensure(CoverageValidator::hasInvalidResult(expected));
+
+    CoverageValidator validator(coverage);
+    validator.setNumThreads(4);
+    std::vector<std::unique_ptr<Geometry>> result = validator.validate();
+
+    ensure_equals(result.size(), expected.size());
+    for (std::size_t i = 0; i < result.size(); i++) {
+        ensure_equals(result[i] == nullptr, expected[i] == nullptr);
+        if (result[i] != nullptr) {
+            ensure_equals(w.write(result[i].get()), w.write(expected[i].get()));
+        }
+    }
+
+    // streaming results
+    for (std::size_t numThreads : {1u, 4u}) {
+        CoverageValidator streamValidator(coverage);
+        streamValidator.setNumThreads(numThreads);
+
+        std::vector<bool> visited(coverage.size(), false);
+        streamValidator.validate([&](std::size_t i, std::unique_ptr<Geometry> invalidLines) {
+            ensure(!visited[i]);
+            visited[i] = true;
+            ensure(expected[i] != nullptr);
+            ensure_equals(w.write(invalidLines.get()), w.write(expected[i].get()));
+        });
+
+        for (std::size_t i = 0; i < coverage.size(); i++) {
+            ensure_equals(visited[i], expected[i] != nullptr);
+        }
+    }
+}
+
+// testParallelSharedCoordinates
+template<>
+template<>
+void object::test<12> ()
+{
+    // clones share their coordinates with the original geometries,
+    // and neighbouring polygons are read from several threads at once
+    std::vector<std::string> wkts;
+    for (int i = 0; i < 20; i++) {
+        for (int j = 0; j < 20; j++) {
+            double offset = (i * 20 + j) % 5 == 0 ? 0.3 : 0;
+            std::ostringstream wkt;
+            wkt << "POLYGON ((" << i << " " << j << ", " << (i + 1 + offset) << " " << j
+                << ", " << (i + 1) << " " << (j + 1) << ", " << i << " " << (j + 1)
+                << ", " << i << " " << j << "))";
+            wkts.push_back(wkt.str());
+        }
+    }
+    std::vector<std::unique_ptr<Geometry>> geoms = readList(wkts);
+    std::vector<std::unique_ptr<Geometry>> clones;
+    for (const auto& g : geoms) {
+        clones.push_back(g->clone());
+    }
+
+    auto firstCoordinate = [](const Geometry* g) {
+        return &static_cast<const geos::geom::Polygon*>(g)->getExteriorRing()->getCoordinatesRO()->getAt(0);
+    };
+
+    std::vector<const Geometry*> coverage = toCoverage(geoms);
+    std::vector<const Geometry*> cloneCoverage = toCoverage(clones);
+
+    std::vector<std::unique_ptr<Geometry>> expected = CoverageValidator::validate(coverage);
+    ensure(CoverageValidator::hasInvalidResult(expected));
+
+    for (int run = 0; run < 4; run++) {
+        CoverageValidator validator(cloneCoverage);
+        validator.setNumThreads(4);
+        std::vector<std::unique_ptr<Geometry>> result = validator.validate();
+
+        ensure_equals(result.size(), expected.size());
+        for (std::size_t i = 0; i < result.size(); i++) {
+            ensure_equals(result[i] == nullptr, expected[i] == nullptr);
+            if (result[i] != nullptr) {
+                ensure_equals(w.write(result[i].get()), w.write(expected[i].get()));
+            }
+        }
+    }
+
+    // validation only reads the inputs: the clones still share their coordinates
+    for (std::size_t i = 0; i < geoms.size(); i++) {
+        ensure(firstCoordinate(clones[i].get()) == firstCoordinate(geoms[i].get()));
+        ensure(clones[i]->equalsExact(geoms[i].get()));
+    }
+}
+
 } // namespace tut
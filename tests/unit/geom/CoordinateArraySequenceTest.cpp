@@ -7,6 +7,10 @@
 #include <geos/geom/CoordinateFilter.h>
 #include <geos/geom/CoordinateArraySequence.h>
 #include <geos/geom/CoordinateArraySequenceFactory.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/Polygon.h>
+#include <geos/io/WKTReader.h>
+#include <geos/noding/SegmentStringUtil.h>
 // std
 #include <string>
 #include <vector>
@@ -593,4 +597,100 @@ void object::test<17>
     ensure_equals(seq.getDimension(), 2u);
 }
 
+// Copies share their coordinates until one of them is modified
+template<>
+template<>
+void object::test<18>
+()
+{
+    using geos::geom::Coordinate;
+    using geos::geom::CoordinateArraySequence;
+    using geos::geom::CoordinateSequence;
+
+    CoordinateArraySequence seq;
+    seq.add(Coordinate(0, 0));
+    seq.add(Coordinate(1, 1));
+    seq.add(Coordinate(2, 2));
+    const CoordinateSequence& cseq = seq;
+
+    auto clone = seq.clone();
+    const CoordinateSequence& cclone = *clone;
+    ensure(&cclone.getAt(0) == &cseq.getAt(0));
+
+    CoordinateArraySequence copy(seq);
+    const CoordinateSequence& ccopy = copy;
+    ensure(&ccopy.getAt(0) == &cseq.getAt(0));
+
+    // modifying the clone leaves the others unchanged
+    clone->setAt(Coordinate(5, 5), 1);
+    ensure(&cclone.getAt(0) != &cseq.getAt(0));
+    ensure_equals(cclone.getAt(1).x, 5);
+    ensure_equals(cseq.getAt(1).x, 1);
+    ensure_equals(ccopy.getAt(1).x, 1);
+
+    // reading through the non-const accessors does not copy
+    ensure(&copy.getAt(2) == &cseq.getAt(2));
+    ensure(&copy[1] == &cseq.getAt(1));
+    copy.setOrdinate(2, CoordinateSequence::X, 7);
+    ensure_equals(ccopy.getAt(2).x, 7);
+    ensure_equals(cseq.getAt(2).x, 2);
+
+    // the last owner modifies the coordinates in place
+    const Coordinate* first = &cseq.getAt(0);
+    seq.setOrdinate(0, CoordinateSequence::Y, 3);
+    ensure(&cseq.getAt(0) == first);
+    ensure_equals(cseq.getAt(0).y, 3);
+
+    auto other = seq.clone();
+    seq.add(Coordinate(3, 3));
+    ensure_equals(seq.size(), 4u);
+    ensure_equals(other->size(), 3u);
+    seq.clear();
+    ensure(seq.isEmpty());
+    ensure_equals(other->size(), 3u);
+
+    Filter f;
+    f.is3d = true;
+    other->apply_rw(&f);
+    ensure_equals(other->getAt(0).z, 0);
+    ensure_equals(other->getAt(0).y, 3);
+}
+
+// Reading a geometry, also through a SegmentString or a validity check,
+// leaves its coordinates shared with its clones
+template<>
+template<>
+void object::test<19>
+()
+{
+    using geos::geom::Geometry;
+    using geos::geom::Polygon;
+
+    geos::io::WKTReader reader;
+    auto geom = reader.read("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (1 1, 2 1, 2 2, 1 1))");
+    auto clone = geom->clone();
+
+    auto shellPts = [](const Geometry& g) {
+        return static_cast<const Polygon&>(g).getExteriorRing()->getCoordinatesRO();
+    };
+    const geos::geom::Coordinate* shared = &shellPts(*geom)->getAt(0);
+    ensure(&shellPts(*clone)->getAt(0) == shared);
+
+    ensure(clone->isValid());
+
+    geos::noding::SegmentString::ConstVect segStrings;
+    geos::noding::SegmentStringUtil::extractSegmentStrings(clone.get(), segStrings);
+    double sumX = 0;
+    for (const auto* ss : segStrings) {
+        for (std::size_t i = 0; i < ss->size(); i++) {
+            sumX += ss->getCoordinates()->getAt(i).x;
+        }
+        delete ss;
+    }
+    ensure_equals(sumX, 26);
+
+    ensure(&shellPts(*clone)->getAt(0) == shared);
+    ensure(&shellPts(*geom)->getAt(0) == shared);
+}
+
 } // namespace tut
@@ -0,0 +1,165 @@
+//
+// Test Suite for geos::geom::FlatCoordinateSequence class.
+
+#include <tut/tut.hpp>
+// geos
+#include <geos/algorithm/Area.h>
+#include <geos/algorithm/Length.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/FlatCoordinateSequence.h>
+#include <geos/util/IllegalArgumentException.h>
+// std
+#include <cmath>
+#include <vector>
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_flatcoordinatesequence_data {
+    test_flatcoordinatesequence_data() {}
+
+    // Sum of the x ordinates of a view of any layout
+    struct SumX {
+        template<typename View>
+        double operator()(const View& view) const
+        {
+            double s = 0;
+            view.forEachXY([&s](double x, double) { s += x; });
+            return s;
+        }
+    };
+};
+
+typedef test_group<test_flatcoordinatesequence_data> group;
+typedef group::object object;
+
+group test_flatcoordinatesequence_group("geos::geom::FlatCoordinateSequence");
+
+using geos::geom::CoordinateLayout;
+using geos::geom::CoordinateSequence;
+using geos::geom::FlatCoordinateSequence;
+
+// Ordinates are stored with the stride of the layout
+template<>
+template<>
+void object::test<1>
+()
+{
+    FlatCoordinateSequence xy;
+    ensure(xy.isEmpty());
+    ensure_equals(xy.getDimension(), 2u);
+    xy.add(1, 2, 3, 4);
+    xy.add(5, 6);
+    ensure_equals(xy.size(), 2u);
+    ensure(std::vector<double>(xy.data(), xy.data() + 4) == std::vector<double>{1, 2, 5, 6});
+    ensure(std::isnan(xy.getZ(0)));
+    ensure(std::isnan(xy.getM(0)));
+
+    FlatCoordinateSequence xym(CoordinateLayout::XYM);
+    xym.add(1, 2, 3, 4);
+    ensure_equals(xym.getDimension(), 3u);
+    ensure(!xym.hasZ());
+    ensure(xym.hasM());
+    ensure(std::isnan(xym.getZ(0)));
+    ensure_equals(xym.getM(0), 4);
+    ensure_equals(xym.getOrdinate(0, CoordinateSequence::M), 4);
+
+    double buf[] = {1, 2, 3, 4, 5, 6, 7, 8};
+    FlatCoordinateSequence xyzm(buf, 2, CoordinateLayout::XYZM);
+    ensure_equals(xyzm.size(), 2u);
+    ensure_equals(xyzm.getX(1), 5);
+    ensure_equals(xyzm.getY(1), 6);
+    ensure_equals(xyzm.getZ(1), 7);
+    ensure_equals(xyzm.getM(1), 8);
+
+    xyzm.setOrdinate(0, CoordinateSequence::Z, 10);
+    xyzm.setOrdinate(0, CoordinateSequence::M, 20);
+    ensure_equals(xyzm.getZ(0), 10);
+    ensure_equals(xyzm.getM(0), 20);
+
+    ensure(FlatCoordinateSequence::layoutFor(true, true) == CoordinateLayout::XYZM);
+    ensure(FlatCoordinateSequence::layoutFor(false, true) == CoordinateLayout::XYM);
+}
+
+// Setting an ordinate the layout does not store throws
+template<>
+template<>
+void object::test<2>
+()
+{
+    FlatCoordinateSequence xyz(1, CoordinateLayout::XYZ);
+    try {
+        xyz.setOrdinate(0, CoordinateSequence::M, 1);
+        fail();
+    }
+    catch (const geos::util::IllegalArgumentException&) {}
+
+    try {
+        xyz.view<CoordinateLayout::XY>();
+        fail();
+    }
+    catch (const geos::util::IllegalArgumentException&) {}
+}
+
+// Conversion to and from CoordinateSequence
+template<>
+template<>
+void object::test<3>
+()
+{
+    geos::geom::CoordinateArraySequence cas;
+    cas.add(geos::geom::Coordinate(0, 0, 1));
+    cas.add(geos::geom::Coordinate(1, 2, 3));
+
+    FlatCoordinateSequence flat(cas);
+    ensure(flat.getLayout() == CoordinateLayout::XYZ);
+    ensure_equals(flat.getZ(1), 3);
+
+    auto back = flat.toCoordinateSequence();
+    ensure_equals(back->getDimension(), 3u);
+    ensure(*back == cas);
+
+    geos::geom::CoordinateArraySequence cas2d(2, 2);
+    cas2d.setAt(geos::geom::Coordinate(3, 4), 1);
+    FlatCoordinateSequence flat2d(cas2d);
+    ensure(flat2d.getLayout() == CoordinateLayout::XY);
+    ensure_equals(flat2d.getY(1), 4);
+}
+
+// Views and visit() see the same coordinates for every layout
+template<>
+template<>
+void object::test<4>
+()
+{
+    for (auto layout : {CoordinateLayout::XY, CoordinateLayout::XYZ, CoordinateLayout::XYM, CoordinateLayout::XYZM}) {
+        FlatCoordinateSequence seq(layout);
+        seq.add(0, 0, 1, 2);
+        seq.add(4, 0, 1, 2);
+        seq.add(4, 3, 1, 2);
+        seq.add(0, 0, 1, 2);
+
+        double sumX = seq.visit(SumX());
+        ensure_equals(sumX, 8);
+
+        auto env = seq.getEnvelope();
+        ensure_equals(env.getMaxX(), 4);
+        ensure_equals(env.getMaxY(), 3);
+
+        ensure_equals(geos::algorithm::Length::ofLine(seq), 12);
+        ensure_equals(geos::algorithm::Area::ofRing(seq), 6);
+        ensure_equals(geos::algorithm::Area::ofRingSigned(seq),
+                      geos::algorithm::Area::ofRingSigned(seq.toCoordinateSequence().get()));
+    }
+
+    FlatCoordinateSequence xyz(2, CoordinateLayout::XYZ);
+    auto view = xyz.view<CoordinateLayout::XYZ>();
+    ensure_equals(view.size(), 2u);
+    ensure_equals(view.getZ(1), 0);
+    ensure(FlatCoordinateSequence().getEnvelope().isNull());
+}
+
+} // namespace tut
@@ -8,6 +8,7 @@
 #include <geos/geom/Envelope.h>
 #include <geos/geom/Geometry.h>
 #include <geos/geom/Point.h>
+#include <geos/geom/Triangle.h>
 #include <geos/io/WKTReader.h>
 #include <geos/io/WKTWriter.h>
 #include <geos/index/VertexSequencePackedRtree.h>
@@ -169,6 +170,43 @@ void object::test<6>
 
 
 
-} // namespace tut
 
+// Triangle query
+template<>
+template<>
+void object::test<7>
+()
+{
+    std::string wkt("MULTIPOINT((0 0), (1 1), (2 2), (3 0), (0 3), (1 2), (2 1), (4 4), (1 0))");
+    auto tree = createSPRtree(wkt);
+    std::vector<std::size_t> resultIds;
+    tree->query(geos::geom::Triangle(Coordinate(0, 0), Coordinate(3, 0), Coordinate(0, 3)), resultIds);
+    expected = {0, 1, 3, 4, 5, 6, 8};
+    ensure_equals(resultIds.size(), expected.size());
+    ensure(isEqualResult(expected, resultIds));
+}
 
+// Removed items are not returned, and empty nodes are skipped
+template<>
+template<>
+void object::test<8>
+()
+{
+    std::string wkt("MULTIPOINT((0 0), (1 1), (2 2), (3 3), (4 4), (5 5), (6 6), (7 7), (8 8), (9 9), (10 10), (11 11), (12 12), (13 13), (14 14), (15 15), (16 16), (17 17), (18 18), (17 17), (16 16))");
+    auto tree = createSPRtree(wkt);
+    for (std::size_t i = 0; i < 15; i++) {
+        tree->remove(i);
+    }
+    std::vector<std::size_t> resultIds;
+    tree->query(getEnvelope(0,0, 20,20), resultIds);
+    expected = {15, 16, 17, 18, 19, 20};
+    ensure_equals(resultIds.size(), expected.size());
+    ensure(isEqualResult(expected, resultIds));
+
+    resultIds.clear();
+    tree->query(geos::geom::Triangle(Coordinate(0, 0), Coordinate(20, 0), Coordinate(20, 20)), resultIds);
+    ensure_equals(resultIds.size(), expected.size());
+    ensure(isEqualResult(expected, resultIds));
+}
+
+} // namespace tut
@@ -1,4 +1,6 @@
 #include <tut/tut.hpp>
+// std
+#include <algorithm>
 // geos
 #include <geos/index/kdtree/KdTree.h>
 #include <geos/geom/Envelope.h>
@@ -192,5 +194,103 @@ void object::test<8> ()
 
 
 
+//
+// testBulkLoad: a bulk-loaded tree holds the same nodes as
+// one built by inserting points one at a time
+//
+template<>
+template<>
+void object::test<9> ()
+{
+    // sorted input, with ties on each axis and repeated points
+    std::vector<Coordinate> pts;
+    std::vector<void*> data;
+    for (int i = 0; i < 40; i++) {
+        for (int j = 0; j < 40; j++) {
+            pts.emplace_back(i, j % 7);
+        }
+    }
+    for (std::size_t i = 0; i < pts.size(); i++) {
+        data.push_back(&pts[i]);
+    }
+
+    KdTree bulk;
+    bulk.insert(pts, data);
+
+    KdTree oneByOne;
+    for (std::size_t i = 0; i < pts.size(); i++) {
+        oneByOne.insert(pts[i], data[i]);
+    }
+
+    Envelope queryEnv(-1, 100, -1, 100);
+    auto bulkNodes = bulk.query(queryEnv);
+    auto expectedNodes = oneByOne.query(queryEnv);
+    ensure_equals(bulkNodes->size(), expectedNodes->size());
+    ensure_equals(bulkNodes->size(), 40u * 7u);
+
+    auto byCoordinate = [](KdNode* a, KdNode* b) {
+        return a->getCoordinate().compareTo(b->getCoordinate()) < 0;
+    };
+    std::sort(bulkNodes->begin(), bulkNodes->end(), byCoordinate);
+    std::sort(expectedNodes->begin(), expectedNodes->end(), byCoordinate);
+    for (std::size_t i = 0; i < bulkNodes->size(); i++) {
+        KdNode* a = (*bulkNodes)[i];
+        KdNode* b = (*expectedNodes)[i];
+        ensure(a->getCoordinate().equals2D(b->getCoordinate()));
+        ensure_equals(a->getCount(), b->getCount());
+        ensure_equals(a->getData(), b->getData());
+    }
+
+    // every point can be found by exact lookup and by range query
+    for (const auto& pt : pts) {
+        KdNode* node = bulk.query(pt);
+        ensure(node != nullptr);
+        ensure(node->getCoordinate().equals2D(pt));
+        ensure_equals(bulk.query(Envelope(pt))->size(), 1u);
+    }
+    ensure(bulk.query(Coordinate(0.5, 0.5)) == nullptr);
+
+    // later points are inserted into the bulk-loaded tree
+    KdNode* node = bulk.insert(Coordinate(3, 3.5));
+    ensure(bulk.query(Coordinate(3, 3.5)) == node);
+    ensure(bulk.insert(Coordinate(3, 3)) == bulk.query(Coordinate(3, 3)));
+    ensure_equals(bulk.query(Coordinate(3, 3))->getCount(), 7u);
+}
+
+//
+// testBatchQuery
+//
+template<>
+template<>
+void object::test<10> ()
+{
+    std::vector<Coordinate> pts;
+    for (int i = 0; i < 1000; i++) {
+        pts.emplace_back((i * 37) % 101, (i * 53) % 97);
+    }
+
+    KdTree index;
+    index.insert(pts);
+
+    std::vector<Envelope> queryEnvs;
+    for (int i = 0; i < 200; i++) {
+        double x = (i * 13) % 100;
+        double y = (i * 29) % 90;
+        queryEnvs.emplace_back(x, x + 5, y, y + 10);
+    }
+
+    for (std::size_t numThreads : {1u, 4u}) {
+        std::vector<std::vector<KdNode*>> result;
+        index.query(queryEnvs, result, numThreads);
+        ensure_equals(result.size(), queryEnvs.size());
+
+        for (std::size_t i = 0; i < queryEnvs.size(); i++) {
+            std::vector<KdNode*> expected;
+            index.query(queryEnvs[i], expected);
+            ensure(result[i] == expected);
+        }
+    }
+}
+
 } // namespace tut
 
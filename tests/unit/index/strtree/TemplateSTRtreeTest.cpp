@@ -411,5 +411,93 @@ void object::test<10>() {
 
 
 
+// queryWithinDistance matches a brute-force distance join
+template<>
+template<>
+void object::test<11>() {
+    Grid grid1;
+    grid1.nx = grid1.ny = 20;
+    Grid grid2;
+    grid2.x0 = grid2.y0 = 0.3;
+    grid2.dx = grid2.dy = 1.7;
+    grid2.nx = grid2.ny = 12;
+
+    auto geoms1 = pointGrid(grid1);
+    auto geoms2 = pointGrid(grid2);
+    auto tree1 = makeTree<const geom::Point*>(geoms1);
+    auto tree2 = makeTree<const geom::Point*>(geoms2);
+
+    struct PointDistance {
+        double operator()(const geom::Point* a, const geom::Point* b) {
+            return a->distance(b);
+        }
+    };
+
+    double maxDist = 0.8;
+    std::size_t expected = 0;
+    for (const auto& a : geoms1) {
+        for (const auto& b : geoms2) {
+            if (a->distance(b.get()) <= maxDist) {
+                expected++;
+            }
+        }
+    }
+
+    using Pairs = std::vector<std::pair<const geom::Point*, const geom::Point*>>;
+    Pairs serial;
+    tree1.queryWithinDistance<PointDistance>(tree2, maxDist,
+    [&serial](const geom::Point* a, const geom::Point* b, double d) {
+        ensure(d <= 0.8);
+        ensure_equals(a->distance(b), d);
+        serial.emplace_back(a, b);
+    });
+    ensure_equals(serial.size(), expected);
+
+    Pairs parallel;
+    tree1.queryWithinDistance<PointDistance>(tree2, maxDist,
+    [&parallel](const geom::Point* a, const geom::Point* b, double) {
+        parallel.emplace_back(a, b);
+    }, 3);
+    ensure(serial == parallel);
+}
+
+// nearestNeighbours finds the nearest item for every item of the first tree
+template<>
+template<>
+void object::test<12>() {
+    Grid grid1;
+    grid1.nx = grid1.ny = 15;
+    Grid grid2;
+    grid2.x0 = grid2.y0 = 0.4;
+    grid2.dx = grid2.dy = 2.3;
+    grid2.nx = grid2.ny = 6;
+
+    auto geoms1 = pointGrid(grid1);
+    auto geoms2 = pointGrid(grid2);
+    auto tree1 = makeTree<const geom::Point*>(geoms1);
+    auto tree2 = makeTree<const geom::Point*>(geoms2);
+
+    struct PointDistance {
+        double operator()(const geom::Point* a, const geom::Point* b) {
+            return a->distance(b);
+        }
+    };
+
+    std::size_t visited = 0;
+    tree1.nearestNeighbours<PointDistance>(tree2,
+    [&visited, &geoms2](const geom::Point* a, const geom::Point* b, double d) {
+        double bruteForce = std::numeric_limits<double>::infinity();
+        for (const auto& g : geoms2) {
+            bruteForce = std::min(bruteForce, a->distance(g.get()));
+        }
+        ensure_equals(d, bruteForce);
+        ensure_equals(a->distance(b), d);
+        visited++;
+    }, 2);
+
+    ensure_equals(visited, geoms1.size());
+}
+
+
 } // namespace tut
 
@@ -0,0 +1,223 @@
+//
+// Test Suite for geos::io::GeoArrowReader
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/io/GeoArrowReader.h>
+#include <geos/io/WKTReader.h>
+#include <geos/geom/ExternalCoordinateSequence.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/Polygon.h>
+#include <geos/util/IllegalArgumentException.h>
+// std
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+using geos::geom::ExternalCoordinateSequence;
+
+namespace tut {
+
+//
+// Test Group
+//
+
+struct test_geoarrowreader_data {
+    geos::geom::GeometryFactory::Ptr gf;
+    geos::io::GeoArrowReader reader;
+    geos::io::WKTReader wktreader;
+
+    test_geoarrowreader_data()
+        :
+        gf(geos::geom::GeometryFactory::create()),
+        reader(*gf),
+        wktreader(*gf)
+    {}
+
+    void
+    ensureEquals(const geos::geom::Geometry* actual, const std::string& wkt)
+    {
+        auto expected = wktreader.read(wkt);
+        ensure_equals(actual->toText(), expected->toText());
+        ensure(actual->equalsExact(expected.get()));
+    }
+
+    static const ExternalCoordinateSequence*
+    externalSequence(const geos::geom::LineString* line)
+    {
+        return dynamic_cast<const ExternalCoordinateSequence*>(line->getCoordinatesRO());
+    }
+};
+
+typedef test_group<test_geoarrowreader_data> group;
+typedef group::object object;
+
+group t_geoarrowreader_group("geos::io::GeoArrowReader");
+
+// Read XY points, a NaN coordinate is an empty point
+template<>
+template<>
+void object::test<1>
+()
+{
+    const double coords[] = { 1, 2, 3, 4, NAN, NAN };
+    auto geoms = reader.read(geos::geom::GEOS_POINT, coords, 3, false, nullptr, 3);
+
+    ensure_equals(geoms.size(), 3u);
+    ensureEquals(geoms[0].get(), "POINT (1 2)");
+    ensureEquals(geoms[1].get(), "POINT (3 4)");
+    ensure(geoms[2]->isEmpty());
+}
+
+// Read XY polygons and multipolygons, coordinates are copied
+template<>
+template<>
+void object::test<2>
+()
+{
+    const double coords[] = {
+        0, 0, 10, 0, 10, 10, 0, 10, 0, 0,
+        1, 1, 2, 1, 2, 2, 1, 1,
+        20, 20, 30, 20, 30, 30, 20, 20
+    };
+    const std::int32_t geomOffsets[] = { 0, 1, 2 };
+    const std::int32_t polygonOffsets[] = { 0, 2, 3 };
+    const std::int32_t ringOffsets[] = { 0, 5, 9, 13 };
+    const std::int32_t* polygonBuffers[] = { polygonOffsets, ringOffsets };
+    const std::int32_t* multiPolygonBuffers[] = { geomOffsets, polygonOffsets, ringOffsets };
+
+    auto polygons = reader.read(geos::geom::GEOS_POLYGON, coords, 13, false, polygonBuffers, 2);
+    ensure_equals(polygons.size(), 2u);
+    ensureEquals(polygons[0].get(), "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (1 1, 2 1, 2 2, 1 1))");
+    ensureEquals(polygons[1].get(), "POLYGON ((20 20, 30 20, 30 30, 20 20))");
+
+    auto multiPolygons = reader.read(geos::geom::GEOS_MULTIPOLYGON, coords, 13, false, multiPolygonBuffers, 2);
+    ensure_equals(multiPolygons.size(), 2u);
+    ensureEquals(multiPolygons[0].get(), "MULTIPOLYGON (((0 0, 10 0, 10 10, 0 10, 0 0), (1 1, 2 1, 2 2, 1 1)))");
+    ensureEquals(multiPolygons[1].get(), "MULTIPOLYGON (((20 20, 30 20, 30 30, 20 20)))");
+}
+
+// Read XYZ linestrings, coordinates are referenced and kept alive by the owner
+template<>
+template<>
+void object::test<3>
+()
+{
+    auto buffer = std::make_shared<std::vector<double>>(std::vector<double> {
+        0, 0, 1, 1, 1, 2,
+        5, 5, 3, 6, 6, 4, 7, 5, 5
+    });
+    const std::int32_t offsets[] = { 0, 2, 5 };
+    const std::int32_t* buffers[] = { offsets };
+
+    auto geoms = reader.read(geos::geom::GEOS_LINESTRING, buffer->data(), 5, true, buffers, 2, buffer);
+    ensure_equals(buffer.use_count(), 3);
+
+    auto line = static_cast<const geos::geom::LineString*>(geoms[1].get());
+    ensureEquals(line, "LINESTRING Z (5 5 3, 6 6 4, 7 5 5)");
+    ensure(externalSequence(line) != nullptr);
+    ensure(externalSequence(line)->isExternal());
+    ensure(&line->getCoordinatesRO()->getAt(0) == reinterpret_cast<const geos::geom::Coordinate*>(buffer->data() + 6));
+
+    geoms.clear();
+    ensure_equals(buffer.use_count(), 1);
+}
+
+// Modifying a referencing geometry copies its coordinates, the buffer is unchanged
+template<>
+template<>
+void object::test<4>
+()
+{
+    std::vector<double> buffer { 2, 0, 3, 1, 1, 2, 0, 0, 1 };
+    const std::int32_t offsets[] = { 0, 3 };
+    const std::int32_t* buffers[] = { offsets };
+
+    auto geoms = reader.read(geos::geom::GEOS_LINESTRING, buffer.data(), 3, true, buffers, 1);
+    auto copy = geoms[0]->clone();
+
+    geoms[0]->normalize();
+    ensureEquals(geoms[0].get(), "LINESTRING Z (0 0 1, 1 1 2, 2 0 3)");
+    ensure(!externalSequence(static_cast<const geos::geom::LineString*>(geoms[0].get()))->isExternal());
+
+    ensureEquals(copy.get(), "LINESTRING Z (2 0 3, 1 1 2, 0 0 1)");
+    ensure(externalSequence(static_cast<const geos::geom::LineString*>(copy.get()))->isExternal());
+    ensure(buffer == std::vector<double>({ 2, 0, 3, 1, 1, 2, 0, 0, 1 }));
+}
+
+// Offsets out of range are rejected
+template<>
+template<>
+void object::test<5>
+()
+{
+    const double coords[] = { 0, 0, 1, 1 };
+    const std::int32_t offsets[] = { 0, 3 };
+    const std::int32_t* buffers[] = { offsets };
+
+    try {
+        reader.read(geos::geom::GEOS_LINESTRING, coords, 2, false, buffers, 1);
+        fail("IllegalArgumentException expected");
+    }
+    catch (const geos::util::IllegalArgumentException&) {
+    }
+}
+
+// Reading a referencing geometry keeps it referencing the buffer
+template<>
+template<>
+void object::test<6>
+()
+{
+    std::vector<double> buffer { 0, 0, 0, 10, 0, 0, 10, 10, 0, 0, 10, 0, 0, 0, 0 };
+    const std::int32_t polygonOffsets[] = { 0, 1 };
+    const std::int32_t ringOffsets[] = { 0, 5 };
+    const std::int32_t* buffers[] = { polygonOffsets, ringOffsets };
+
+    auto geoms = reader.read(geos::geom::GEOS_POLYGON, buffer.data(), 5, true, buffers, 1);
+    auto clone = geoms[0]->clone();
+
+    ensure(geoms[0]->isValid());
+    ensure_equals(clone->getArea(), 100);
+    ensure(clone->intersects(geoms[0].get()));
+
+    auto shell = static_cast<const geos::geom::Polygon*>(geoms[0].get())->getExteriorRing();
+    ensure(externalSequence(shell)->isExternal());
+    ensure(&shell->getCoordinatesRO()->getAt(0) == reinterpret_cast<const geos::geom::Coordinate*>(buffer.data()));
+}
+
+// Null buffers and decreasing offsets are rejected
+template<>
+template<>
+void object::test<7>
+()
+{
+    const double coords[] = { 0, 0, 1, 1, 2, 2 };
+    const std::int32_t decreasing[] = { 0, 2, 1 };
+    const std::int32_t increasing[] = { 0, 1, 3 };
+    const std::int32_t* decreasingBuffers[] = { decreasing };
+    const std::int32_t* nullBuffers[] = { increasing, nullptr };
+
+    auto checkThrows = [this](geos::geom::GeometryTypeId type, const double* c,
+                              const std::int32_t* const* offsets) {
+        try {
+            reader.read(type, c, 3, false, offsets, 2);
+            fail("IllegalArgumentException expected");
+        }
+        catch (const geos::util::IllegalArgumentException&) {
+        }
+    };
+
+    checkThrows(geos::geom::GEOS_MULTIPOINT, coords, decreasingBuffers);
+    checkThrows(geos::geom::GEOS_MULTIPOINT, nullptr, decreasingBuffers);
+    checkThrows(geos::geom::GEOS_MULTIPOINT, coords, nullptr);
+    checkThrows(geos::geom::GEOS_POLYGON, coords, nullBuffers);
+
+    ensure_equals(reader.read(geos::geom::GEOS_POLYGON, nullptr, 0, false, nullptr, 0).size(), 0u);
+}
+
+} // namespace tut
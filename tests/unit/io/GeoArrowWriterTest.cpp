@@ -0,0 +1,194 @@
+//
+// Test Suite for geos::io::GeoArrowWriter
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/io/GeoArrowReader.h>
+#include <geos/io/GeoArrowWriter.h>
+#include <geos/io/WKTReader.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Geometry.h>
+#include <geos/util/IllegalArgumentException.h>
+// std
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+using geos::io::GeoArrowWriter;
+
+namespace tut {
+
+//
+// Test Group
+//
+
+struct test_geoarrowwriter_data {
+    geos::geom::GeometryFactory::Ptr gf;
+    geos::io::WKTReader wktreader;
+
+    std::vector<std::unique_ptr<geos::geom::Geometry>> geoms;
+    std::vector<const geos::geom::Geometry*> geomPtrs;
+
+    std::vector<double> coords;
+    std::vector<std::int32_t> offsets[3];
+    std::int32_t* offsetPtrs[3];
+
+    test_geoarrowwriter_data()
+        :
+        gf(geos::geom::GeometryFactory::create()),
+        wktreader(*gf)
+    {}
+
+    void
+    read(const std::vector<std::string>& wkts)
+    {
+        for (const auto& wkt : wkts) {
+            geoms.push_back(wktreader.read(wkt));
+            geomPtrs.push_back(geoms.back().get());
+        }
+    }
+
+    // Measure, allocate and write the buffers
+    GeoArrowWriter::Sizes
+    write(const GeoArrowWriter& writer)
+    {
+        auto sizes = writer.measure(geomPtrs.data(), geomPtrs.size());
+        coords.resize(sizes.numCoords * 3);
+        for (std::size_t k = 0; k < 3; k++) {
+            offsets[k].resize(sizes.numOffsets[k]);
+            offsetPtrs[k] = offsets[k].data();
+        }
+        auto written = writer.write(geomPtrs.data(), geomPtrs.size(), coords.data(), offsetPtrs, sizes);
+        ensure_equals(written.numCoords, sizes.numCoords);
+        for (std::size_t k = 0; k < 3; k++) {
+            ensure_equals(written.numOffsets[k], sizes.numOffsets[k]);
+        }
+        return sizes;
+    }
+};
+
+typedef test_group<test_geoarrowwriter_data> group;
+typedef group::object object;
+
+group t_geoarrowwriter_group("geos::io::GeoArrowWriter");
+
+// Write points, an empty point is NaN
+template<>
+template<>
+void object::test<1>
+()
+{
+    read({ "POINT (1 2)", "POINT EMPTY", "POINT (3 4)" });
+    GeoArrowWriter writer(geos::geom::GEOS_POINT);
+    ensure_equals(writer.getNumOffsetBuffers(), 0u);
+
+    auto sizes = write(writer);
+    ensure_equals(sizes.numCoords, 3u);
+    ensure_equals(sizes.numOffsets[0], 0u);
+    ensure_equals(coords[0], 1);
+    ensure_equals(coords[1], 2);
+    ensure(std::isnan(coords[2]));
+    ensure(std::isnan(coords[3]));
+    ensure_equals(coords[4], 3);
+    ensure_equals(coords[5], 4);
+}
+
+// Write XYZ linestrings, null and empty geometries are empty
+template<>
+template<>
+void object::test<2>
+()
+{
+    read({ "LINESTRING Z (0 0 1, 1 1 2)", "LINESTRING EMPTY", "LINEARRING Z (0 0 0, 1 0 0, 1 1 0, 0 0 0)" });
+    geomPtrs.insert(geomPtrs.begin() + 1, nullptr);
+    GeoArrowWriter writer(geos::geom::GEOS_LINESTRING, true);
+
+    auto sizes = write(writer);
+    ensure_equals(sizes.numCoords, 6u);
+    ensure_equals(sizes.numOffsets[0], 5u);
+    ensure(offsets[0] == std::vector<std::int32_t>({ 0, 2, 2, 2, 6 }));
+    ensure(std::vector<double>(coords.begin(), coords.begin() + 6) == std::vector<double>({ 0, 0, 1, 1, 1, 2 }));
+}
+
+// Write polygons and multipolygons, polygons are single part multipolygons
+template<>
+template<>
+void object::test<3>
+()
+{
+    read({
+        "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (1 1, 2 1, 2 2, 1 1))",
+        "MULTIPOLYGON (((20 20, 30 20, 30 30, 20 20)), EMPTY, ((0 0, 1 0, 1 1, 0 0)))",
+        "POLYGON EMPTY"
+    });
+    GeoArrowWriter writer(geos::geom::GEOS_MULTIPOLYGON);
+    ensure_equals(writer.getNumOffsetBuffers(), 3u);
+
+    auto sizes = write(writer);
+    ensure_equals(sizes.numCoords, 17u);
+    ensure(offsets[0] == std::vector<std::int32_t>({ 0, 1, 4, 4 }));
+    ensure(offsets[1] == std::vector<std::int32_t>({ 0, 2, 3, 3, 4 }));
+    ensure(offsets[2] == std::vector<std::int32_t>({ 0, 5, 9, 13, 17 }));
+    ensure_equals(coords[2 * 9], 20);
+
+    try {
+        GeoArrowWriter(geos::geom::GEOS_POLYGON).measure(geomPtrs.data(), geomPtrs.size());
+        fail("IllegalArgumentException expected");
+    }
+    catch (const geos::util::IllegalArgumentException&) {
+    }
+}
+
+// Written buffers read back as the same geometries
+template<>
+template<>
+void object::test<4>
+()
+{
+    read({
+        "MULTILINESTRING ((0 0, 1 1), (2 2, 3 3, 4 4))",
+        "LINESTRING (5 5, 6 6)",
+        "MULTILINESTRING EMPTY"
+    });
+    GeoArrowWriter writer(geos::geom::GEOS_MULTILINESTRING);
+    auto sizes = write(writer);
+
+    geos::io::GeoArrowReader reader(*gf);
+    const std::int32_t* buffers[] = { offsets[0].data(), offsets[1].data() };
+    auto result = reader.read(geos::geom::GEOS_MULTILINESTRING, coords.data(), sizes.numCoords, false, buffers, 3);
+
+    ensure_equals(result.size(), 3u);
+    ensure_equals(result[0]->toText(), geoms[0]->toText());
+    ensure_equals(result[1]->toText(), wktreader.read("MULTILINESTRING ((5 5, 6 6))")->toText());
+    ensure(result[2]->isEmpty());
+}
+
+// Buffers too small are rejected
+template<>
+template<>
+void object::test<5>
+()
+{
+    read({ "MULTIPOINT ((0 0), (1 1))", "POINT (2 2)" });
+    GeoArrowWriter writer(geos::geom::GEOS_MULTIPOINT);
+    auto sizes = writer.measure(geomPtrs.data(), geomPtrs.size());
+    ensure_equals(sizes.numCoords, 3u);
+    ensure_equals(sizes.numOffsets[0], 3u);
+
+    std::vector<double> smallCoords(4);
+    std::vector<std::int32_t> geomOffsets(3);
+    std::int32_t* buffers[] = { geomOffsets.data() };
+    sizes.numCoords = 2;
+
+    try {
+        writer.write(geomPtrs.data(), geomPtrs.size(), smallCoords.data(), buffers, sizes);
+        fail("IllegalArgumentException expected");
+    }
+    catch (const geos::util::IllegalArgumentException&) {
+    }
+}
+
+} // namespace tut
@@ -0,0 +1,243 @@
+//
+// Test Suite for geos::io::GeoJSONStreamReader
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/io/ParseException.h>
+#include <geos/io/GeoJSONReader.h>
+#include <geos/io/GeoJSONStreamReader.h>
+#include <geos/geom/PrecisionModel.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Geometry.h>
+// std
+#include <sstream>
+#include <string>
+#include <memory>
+#include <vector>
+
+namespace tut {
+
+//
+// Test Group
+//
+
+struct test_geojsonstreamreader_data {
+    geos::geom::PrecisionModel pm;
+    geos::geom::GeometryFactory::Ptr gf;
+    geos::io::GeoJSONReader geojsonreader;
+
+    test_geojsonstreamreader_data()
+        :
+        pm(1000.0),
+        gf(geos::geom::GeometryFactory::create(&pm)),
+        geojsonreader(*(gf.get()))
+    {}
+
+    std::vector<geos::io::GeoJSONFeature> readAll(const std::string& geojson)
+    {
+        std::istringstream is(geojson);
+        geos::io::GeoJSONStreamReader reader(is, *gf);
+        std::vector<geos::io::GeoJSONFeature> features;
+        while (auto feature = reader.next()) {
+            ensure(feature->getGeometry()->getFactory() == gf.get());
+            features.push_back(std::move(*feature));
+        }
+        ensure(reader.next() == nullptr);
+        return features;
+    }
+
+    void checkSameAsGeoJSONReader(const std::string& geojson)
+    {
+        auto expected = geojsonreader.readFeatures(geojson).getFeatures();
+        auto actual = readAll(geojson);
+        ensure_equals(geojson, actual.size(), expected.size());
+        for (std::size_t i = 0; i < actual.size(); i++) {
+            ensure_equals(geojson, actual[i].getGeometry()->toText(), expected[i].getGeometry()->toText());
+            ensure_equals(geojson, actual[i].getGeometry()->getGeometryTypeId(), expected[i].getGeometry()->getGeometryTypeId());
+            ensure(geojson, sameProperties(actual[i].getProperties(), expected[i].getProperties()));
+        }
+    }
+
+    void checkParseException(const std::string& geojson)
+    {
+        try {
+            readAll(geojson);
+            fail(geojson);
+        }
+        catch (const geos::io::ParseException&) {}
+    }
+
+    static bool sameValue(const geos::io::GeoJSONValue& a, const geos::io::GeoJSONValue& b)
+    {
+        if (a.isNumber()) {
+            return b.isNumber() && a.getNumber() == b.getNumber();
+        }
+        if (a.isString()) {
+            return b.isString() && a.getString() == b.getString();
+        }
+        if (a.isBoolean()) {
+            return b.isBoolean() && a.getBoolean() == b.getBoolean();
+        }
+        if (a.isNull()) {
+            return b.isNull();
+        }
+        if (a.isObject()) {
+            return b.isObject() && sameProperties(a.getObject(), b.getObject());
+        }
+        if (!b.isArray() || a.getArray().size() != b.getArray().size()) {
+            return false;
+        }
+        for (std::size_t i = 0; i < a.getArray().size(); i++) {
+            if (!sameValue(a.getArray()[i], b.getArray()[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static bool sameProperties(const std::map<std::string, geos::io::GeoJSONValue>& a,
+                               const std::map<std::string, geos::io::GeoJSONValue>& b)
+    {
+        if (a.size() != b.size()) {
+            return false;
+        }
+        for (const auto& p : a) {
+            auto it = b.find(p.first);
+            if (it == b.end() || !sameValue(p.second, it->second)) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+typedef test_group<test_geojsonstreamreader_data> group;
+typedef group::object object;
+
+group test_geojsonstreamreader_group("geos::io::GeoJSONStreamReader");
+
+// Read the same features as GeoJSONReader
+template<>
+template<>
+void object::test<1>
+()
+{
+    const std::vector<std::string> geojsons = {
+        "{\"type\":\"Point\",\"coordinates\":[-117.0,33.0]}",
+        "{\"type\":\"Point\",\"coordinates\":[]}",
+        "{\"coordinates\":[[102.0,0.0],[103.0,1.0],[104.0,0.0]],\"type\":\"LineString\"}",
+        "{\"type\":\"Polygon\",\"coordinates\":[[[30,10],[40,40],[20,40],[10,20],[30,10]]]}",
+        "{\"type\":\"Polygon\",\"coordinates\":[[[35,10],[45,45],[15,40],[10,20],[35,10]],[[20,30],[35,35],[30,20],[20,30]]]}",
+        "{\"type\":\"Polygon\",\"coordinates\":[]}",
+        "{\"type\":\"MultiPoint\",\"coordinates\":[[10,40],[40,30],[20,20],[30,10]]}",
+        "{\"type\":\"MultiLineString\",\"coordinates\":[[[10,10],[20,20],[10,40]],[[40,40],[30,30],[40,20],[30,10]]]}",
+        "{\"type\":\"MultiLineString\",\"coordinates\":[]}",
+        "{\"type\":\"MultiPolygon\",\"coordinates\":[[[[40,40],[20,45],[45,30],[40,40]]],"
+        "[[[20,35],[10,30],[10,10],[30,5],[45,20],[20,35]],[[30,20],[20,15],[20,25],[30,20]]]]}",
+        "{\"type\":\"GeometryCollection\",\"geometries\":[{\"type\":\"Point\",\"coordinates\":[40,10]},"
+        "{\"type\":\"GeometryCollection\",\"geometries\":[{\"coordinates\":[[10,10],[20,20]],\"type\":\"LineString\"}]}]}",
+        "{\"type\":\"Feature\",\"properties\":{\"id\":1,\"name\":\"one\"},"
+        "\"geometry\":{\"type\":\"Point\",\"coordinates\":[1,2]}}",
+        "{\"type\":\"FeatureCollection\",\"features\":[]}",
+        "{\"type\":\"FeatureCollection\",\"features\":["
+        "{\"type\":\"Feature\",\"geometry\":{\"type\":\"Point\",\"coordinates\":[-117,33]},"
+        "\"properties\":{\"id\":1,\"name\":\"Na\\u00efve \\\"one\\\"\",\"ok\":true,\"none\":null,"
+        "\"list\":[1,\"two\",[3],{\"four\":4}],\"nested\":{\"a\":{\"b\":[false]}},\"n\":-1.5e3,\"big\":18446744073709551615}},"
+        "{\"properties\":{},\"geometry\":{\"type\":\"LineString\",\"coordinates\":[[1,2],[3,4]]},\"type\":\"Feature\"},"
+        "{\"type\":\"Feature\",\"id\":\"x\",\"bbox\":[0,0,1,1],\"geometry\":"
+        "{\"bbox\":[0,0,1,1],\"type\":\"MultiPolygon\",\"coordinates\":[[[[0,0],[1,0],[1,1],[0,0]]]]},"
+        "\"properties\":{\"type\":\"not a geometry\",\"coordinates\":[1]}}"
+        "]}"
+    };
+    for (const auto& geojson : geojsons) {
+        checkSameAsGeoJSONReader(geojson);
+    }
+}
+
+// Members of the FeatureCollection before and after the features are skipped
+template<>
+template<>
+void object::test<2>
+()
+{
+    std::string geojson {
+        "\xEF\xBB\xBF {\n"
+        "  \"name\": \"places\", \"totalFeatures\": 2, \"numberMatched\":-1.5e2,\n"
+        "  \"crs\": {\"type\": \"name\", \"properties\": {\"name\": \"EPSG:4326\"}},\n"
+        "  \"bbox\": [0, 0, 10, 10], \"flag\": true, \"nothing\": null,\n"
+        "  \"f\\u0065atures\": [\n"
+        "    {\"type\": \"Feature\", \"geometry\": {\"type\": \"Point\", \"coordinates\": [1, 2]}, \"properties\": {\"id\": 1}} ,\n"
+        "    {\"type\": \"Feature\", \"geometry\": {\"type\": \"Point\", \"coordinates\": [3, 4]}, \"properties\": null}\n"
+        "  ],\n"
+        "  \"type\": \"FeatureCollection\", \"count\": 2\n"
+        "}\n"
+    };
+    auto features = readAll(geojson);
+    ensure_equals(features.size(), 2u);
+    ensure_equals(features[0].getGeometry()->toText(), "POINT (1.000 2.000)");
+    ensure_equals(features[0].getProperties().at("id").getNumber(), 1.0);
+    ensure_equals(features[1].getGeometry()->toText(), "POINT (3.000 4.000)");
+    ensure(features[1].getProperties().empty());
+}
+
+// Features are returned as they are read
+template<>
+template<>
+void object::test<3>
+()
+{
+    std::stringstream ss;
+    ss << "{\"type\":\"FeatureCollection\",\"features\":[";
+    for (int i = 0; i < 1000; i++) {
+        ss << "{\"type\":\"Feature\",\"properties\":{\"i\":" << i << "},"
+           << "\"geometry\":{\"type\":\"LineString\",\"coordinates\":[[" << i << ",0],[0," << i << "]]}},";
+    }
+    ss << "invalid";
+
+    geos::io::GeoJSONStreamReader reader(ss, *gf);
+    for (int i = 0; i < 1000; i++) {
+        auto feature = reader.next();
+        ensure(feature != nullptr);
+        ensure_equals(feature->getProperties().at("i").getNumber(), static_cast<double>(i));
+        ensure_equals(feature->getGeometry()->getNumPoints(), 2u);
+    }
+    try {
+        reader.next();
+        fail();
+    }
+    catch (const geos::io::ParseException&) {}
+}
+
+// Invalid GeoJSON
+template<>
+template<>
+void object::test<4>
+()
+{
+    checkParseException("");
+    checkParseException("[]");
+    checkParseException("{\"type\":\"Point\",\"coordinates\":[1]}");
+    checkParseException("{\"type\":\"Point\",\"coordinates\":[1,2,3]}");
+    checkParseException("{\"type\":\"Point\",\"coordinates\":[[1,2]]}");
+    checkParseException("{\"type\":\"Point\"}");
+    checkParseException("{\"type\":\"LineString\",\"coordinates\":[1,2]}");
+    checkParseException("{\"type\":\"LineString\",\"coordinates\":[[1,2],[[3,4]]]}");
+    checkParseException("{\"type\":\"LineString\",\"coordinates\":[[1,[2]]]}");
+    checkParseException("{\"type\":\"Polygon\",\"coordinates\":[[1,2],[3,4]]}");
+    checkParseException("{\"type\":\"Curve\",\"coordinates\":[[1,2],[3,4]]}");
+    checkParseException("{\"type\":\"GeometryCollection\"}");
+    checkParseException("{\"type\":\"Feature\",\"geometry\":null,\"properties\":{}}");
+    checkParseException("{\"type\":\"Point\",\"coordinates\":[1,2]} {}");
+    checkParseException("{\"type\":\"Point\",\"coordinates\":[1,2]");
+    checkParseException("{\"type\":\"Point\" \"coordinates\":[1,2]}");
+    checkParseException("{\"type\":\"FeatureCollection\"}");
+    checkParseException("{\"type\":\"FeatureCollection\",\"bbox\":[0,0,1,1]}");
+    checkParseException("{\"type\":\"FeatureCollection\",\"features\":[1]}");
+    checkParseException("{\"type\":\"FeatureCollection\",\"features\":[{\"type\":\"Feature\","
+                        "\"geometry\":{\"type\":\"Point\",\"coordinates\":[1,2]},\"properties\":{}},]}");
+    checkParseException("{\"type\":\"FeatureCollection\",\"features\":[{\"type\":\"Feature\","
+                        "\"geometry\":{\"type\":\"Point\",\"coordinates\":[1,2]},\"properties\":{\"a\":}}]}");
+}
+
+} // namespace tut
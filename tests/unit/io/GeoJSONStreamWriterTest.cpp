@@ -0,0 +1,123 @@
+//
+// Test Suite for geos::io::GeoJSONStreamWriter
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/io/WKTReader.h>
+#include <geos/io/GeoJSONStreamReader.h>
+#include <geos/io/GeoJSONStreamWriter.h>
+#include <geos/io/GeoJSONWriter.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Geometry.h>
+#include <geos/util/GEOSException.h>
+// std
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace tut {
+
+//
+// Test Group
+//
+
+struct test_geojsonstreamwriter_data {
+    geos::io::WKTReader wktreader;
+
+    geos::io::GeoJSONFeature feature(const std::string& wkt, double id)
+    {
+        return geos::io::GeoJSONFeature{ wktreader.read(wkt), std::map<std::string, geos::io::GeoJSONValue> {
+            {"id", geos::io::GeoJSONValue(id)}
+        }};
+    }
+};
+
+typedef test_group<test_geojsonstreamwriter_data> group;
+typedef group::object object;
+
+group test_geojsonstreamwriter_group("geos::io::GeoJSONStreamWriter");
+
+// Same text as GeoJSONWriter for a FeatureCollection
+template<>
+template<>
+void object::test<1>
+()
+{
+    std::vector<geos::io::GeoJSONFeature> features;
+    features.push_back(feature("POINT (-117 33)", 1));
+    features.push_back(feature("LINESTRING (0 0, 1 1)", 2));
+    features.push_back(feature("POLYGON ((0 0, 1 0, 1 1, 0 0))", 3));
+
+    std::ostringstream os;
+    geos::io::GeoJSONStreamWriter writer(os);
+    for (const auto& f : features) {
+        writer.write(f);
+    }
+    writer.finish();
+    writer.finish();
+
+    geos::io::GeoJSONWriter geojsonwriter;
+    ensure_equals(os.str(), geojsonwriter.write(geos::io::GeoJSONFeatureCollection(features)));
+
+    try {
+        writer.write(features[0]);
+        fail();
+    }
+    catch (const geos::util::GEOSException&) {}
+}
+
+// Empty collection, and geometries written as features
+template<>
+template<>
+void object::test<2>
+()
+{
+    std::ostringstream empty;
+    geos::io::GeoJSONStreamWriter(empty).finish();
+    ensure_equals(empty.str(), "{\"type\":\"FeatureCollection\",\"features\":[]}");
+
+    auto geom = wktreader.read("POINT (1.123 2)");
+    geos::io::GeoJSONWriter geojsonwriter;
+    geojsonwriter.setRoundingPrecision(1);
+
+    std::ostringstream os;
+    geos::io::GeoJSONStreamWriter writer(os, geojsonwriter);
+    writer.write(geom.get());
+    writer.write(geom.get());
+    writer.finish();
+    ensure_equals(os.str(), "{\"type\":\"FeatureCollection\",\"features\":["
+                  "{\"type\":\"Feature\",\"geometry\":{\"type\":\"Point\",\"coordinates\":[1.1,2.0]}},"
+                  "{\"type\":\"Feature\",\"geometry\":{\"type\":\"Point\",\"coordinates\":[1.1,2.0]}}]}");
+}
+
+// Large collections are written in blocks and read back by GeoJSONStreamReader
+template<>
+template<>
+void object::test<3>
+()
+{
+    std::stringstream ss;
+    geos::io::GeoJSONStreamWriter writer(ss);
+    for (int i = 0; i < 5000; i++) {
+        writer.write(feature("LINESTRING (0 0, 1 1, 2 2)", i));
+        if (i == 3000) {
+            // some text has already reached the stream
+            ensure(!ss.str().empty());
+        }
+    }
+    writer.finish();
+
+    geos::io::GeoJSONStreamReader reader(ss);
+    int count = 0;
+    while (auto f = reader.next()) {
+        ensure_equals(f->getProperties().at("id").getNumber(), static_cast<double>(count));
+        ensure_equals(f->getGeometry()->getNumPoints(), 3u);
+        count++;
+    }
+    ensure_equals(count, 5000);
+}
+
+} // namespace tut
@@ -6,6 +6,7 @@
 // geos
 #include <geos/io/WKTReader.h>
 #include <geos/io/GeoJSONWriter.h>
+#include <geos/io/Writer.h>
 #include <geos/geom/PrecisionModel.h>
 #include <geos/geom/GeometryFactory.h>
 #include <geos/geom/Point.h>
@@ -16,7 +17,9 @@
 // std
 #include <sstream>
 #include <string>
+#include <map>
 #include <memory>
+#include <vector>
 
 namespace tut {
 
@@ -308,4 +311,62 @@ void object::test<19>
 }
 
 
+// Write coordinates rounded to a number of decimals
+template<>
+template<>
+void object::test<20>
+()
+{
+    GeomPtr geom(wktreader.read("LINESTRING (-117.123 33, 0.5 0.001)"));
+    geojsonwriter.setRoundingPrecision(2);
+    ensure_equals(geojsonwriter.getRoundingPrecision(), 2);
+    ensure_equals(geojsonwriter.write(geom.get()), "{\"type\":\"LineString\",\"coordinates\":[[-117.12,33.0],[0.5,0.0]]}");
+
+    geojsonwriter.setRoundingPrecision(-1);
+    ensure_equals(geojsonwriter.write(geom.get()), "{\"type\":\"LineString\",\"coordinates\":[[-117.123,33.0],[0.5,0.001]]}");
+}
+
+// Write into a Writer
+template<>
+template<>
+void object::test<21>
+()
+{
+    GeomPtr geom(wktreader.read("MULTIPOINT ((1 2), (3 4))"));
+    std::string expected = "{\"type\":\"MultiPoint\",\"coordinates\":[[1.0,2.0],[3.0,4.0]]}";
+
+    geos::io::Writer writer;
+    writer.write("[");
+    geojsonwriter.write(geom.get(), &writer);
+    writer.write("]");
+    ensure_equals(writer.toString(), "[" + expected + "]");
+
+    char buf[16];
+    geos::io::Writer bufferWriter(buf, sizeof(buf));
+    geojsonwriter.write(geom.get(), &bufferWriter);
+    ensure_equals(bufferWriter.getLength(), expected.size());
+    ensure_equals(std::string(buf, sizeof(buf)), expected.substr(0, sizeof(buf)));
+}
+
+// Write properties that need escaping or nesting, and a missing geometry
+template<>
+template<>
+void object::test<22>
+()
+{
+    geos::io::GeoJSONFeature feature { nullptr, std::map<std::string, geos::io::GeoJSONValue> {
+        {"name", geos::io::GeoJSONValue(std::string{"a \"quoted\"\\\n\t\x01 na\xc3\xafve"}) },
+        {"list", geos::io::GeoJSONValue(std::vector<geos::io::GeoJSONValue>{
+            geos::io::GeoJSONValue(1.5), geos::io::GeoJSONValue(), geos::io::GeoJSONValue(true),
+            geos::io::GeoJSONValue(std::vector<geos::io::GeoJSONValue>{})}) },
+        {"object", geos::io::GeoJSONValue(std::map<std::string, geos::io::GeoJSONValue>{
+            {"x", geos::io::GeoJSONValue(false)}}) },
+    }};
+    std::string result = geojsonwriter.write(feature);
+    ensure_equals(result, "{\"type\":\"Feature\",\"geometry\":null,\"properties\":{"
+                  "\"list\":[1.5,null,true,[]],"
+                  "\"name\":\"a \\\"quoted\\\"\\\\\\n\\t\\u0001 na\xc3\xafve\","
+                  "\"object\":{\"x\":false}}}");
+}
+
 }
@@ -0,0 +1,187 @@
+//
+// Test Suite for geos::io::TWKBReader
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/io/ParseException.h>
+#include <geos/io/TWKBReader.h>
+#include <geos/io/WKTReader.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Geometry.h>
+// std
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace tut {
+
+//
+// Test Group
+//
+
+struct test_twkbreader_data {
+    geos::geom::GeometryFactory::Ptr gf;
+    geos::io::TWKBReader reader;
+    geos::io::WKTReader wktreader;
+
+    test_twkbreader_data()
+        :
+        gf(geos::geom::GeometryFactory::create()),
+        reader(*gf),
+        wktreader(*gf)
+    {}
+
+    void
+    checkRead(const std::vector<unsigned char>& twkb, const std::string& wkt)
+    {
+        std::size_t bytesRead = 0;
+        auto geom = reader.read(twkb.data(), twkb.size(), &bytesRead);
+        auto expected = wktreader.read(wkt);
+        ensure_equals(bytesRead, twkb.size());
+        ensure_equals(geom->toText(), expected->toText());
+        ensure_equals(static_cast<int>(geom->getCoordinateDimension()), static_cast<int>(expected->getCoordinateDimension()));
+    }
+};
+
+typedef test_group<test_twkbreader_data> group;
+typedef group::object object;
+
+group t_twkbreader_group("geos::io::TWKBReader");
+
+// Examples of the TWKB specification
+template<>
+template<>
+void object::test<1>
+()
+{
+    // POINT(1 2) with precision 0
+    checkRead({ 0x01, 0x00, 0x02, 0x04 }, "POINT (1 2)");
+    // LINESTRING(3 4, 5 6) with precision 2: deltas 300 400, 200 200
+    checkRead({ 0x42, 0x00, 0x02, 0xd8, 0x04, 0xa0, 0x06, 0x90, 0x03, 0x90, 0x03 }, "LINESTRING (3 4, 5 6)");
+    // LINESTRING(1 2, 3 4) with bounding box and size
+    checkRead({ 0x02, 0x03, 0x09, 0x02, 0x04, 0x04, 0x04, 0x02, 0x02, 0x04, 0x04, 0x04 }, "LINESTRING (1 2, 3 4)");
+    // LINESTRING EMPTY
+    checkRead({ 0x02, 0x10 }, "LINESTRING EMPTY");
+}
+
+// Z values, M values are ignored
+template<>
+template<>
+void object::test<2>
+()
+{
+    // POINT Z (1 2 3) with z precision 1
+    checkRead({ 0x01, 0x08, 0x05, 0x02, 0x04, 0x3c }, "POINT Z (1 2 3)");
+    // POINT ZM (1 2 3 4)
+    checkRead({ 0x01, 0x08, 0x03, 0x02, 0x04, 0x06, 0x08 }, "POINT Z (1 2 3)");
+    // POINT M (1 2 4)
+    checkRead({ 0x01, 0x08, 0x02, 0x02, 0x04, 0x08 }, "POINT (1 2)");
+}
+
+// Multi-geometries with an id list, and collections
+template<>
+template<>
+void object::test<3>
+()
+{
+    // MULTIPOINT ((0 0), (1 -1)) with ids 5, 6
+    checkRead({ 0x04, 0x04, 0x02, 0x0a, 0x0c, 0x00, 0x00, 0x02, 0x01 }, "MULTIPOINT ((0 0), (1 -1))");
+    // GEOMETRYCOLLECTION (POINT (1 1), LINESTRING EMPTY): the point starts over from 0
+    checkRead({ 0x07, 0x00, 0x02, 0x01, 0x00, 0x02, 0x02, 0x02, 0x10 }, "GEOMETRYCOLLECTION (POINT (1 1), LINESTRING EMPTY)");
+}
+
+// Read the geometries of a stream one after the other
+template<>
+template<>
+void object::test<4>
+()
+{
+    std::string bytes = { 0x01, 0x00, 0x02, 0x04, 0x02, 0x10, 0x01, 0x00, 0x06, 0x08 };
+    std::istringstream is(bytes);
+
+    ensure(reader.read(is)->equalsExact(wktreader.read("POINT (1 2)").get()));
+    ensure(reader.read(is)->equalsExact(wktreader.read("LINESTRING EMPTY").get()));
+    ensure(reader.read(is)->equalsExact(wktreader.read("POINT (3 4)").get()));
+    ensure(reader.read(is) == nullptr);
+}
+
+// Truncated and invalid input
+template<>
+template<>
+void object::test<5>
+()
+{
+    std::vector<std::vector<unsigned char>> invalid = {
+        { 0x02, 0x00, 0x02, 0x04 },
+        { 0x02, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f },
+        { 0x09, 0x00, 0x00 },
+        { 0x01, 0x00, 0x80 }
+    };
+    for (const auto& twkb : invalid) {
+        try {
+            reader.read(twkb.data(), twkb.size());
+            fail("ParseException expected");
+        }
+        catch (const geos::io::ParseException&) {
+        }
+    }
+}
+
+// Huge counts, deltas overflowing the ordinates and deep nesting
+template<>
+template<>
+void object::test<6>
+()
+{
+    // counts that cannot be checked against the size of a stream
+    std::vector<std::vector<unsigned char>> streams = {
+        { 0x02, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f },
+        { 0x04, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f },
+        { 0x07, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x01, 0x00, 0x02, 0x04 }
+    };
+    for (const auto& bytes : streams) {
+        std::istringstream is(std::string(bytes.begin(), bytes.end()));
+        try {
+            reader.read(is);
+            fail("ParseException expected");
+        }
+        catch (const geos::io::ParseException&) {
+        }
+    }
+
+    // LINESTRING with a first x of INT64_MAX followed by a delta of 1
+    std::vector<unsigned char> overflow = {
+        0x02, 0x00, 0x02,
+        0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00,
+        0x02, 0x00
+    };
+    try {
+        reader.read(overflow.data(), overflow.size());
+        fail("ParseException expected");
+    }
+    catch (const geos::io::ParseException&) {
+    }
+
+    // a point in nested single-member collections
+    auto nested = [](int depth) {
+        std::vector<unsigned char> twkb;
+        for (int i = 0; i < depth; i++) {
+            twkb.insert(twkb.end(), { 0x07, 0x00, 0x01 });
+        }
+        twkb.insert(twkb.end(), { 0x01, 0x00, 0x02, 0x04 });
+        return twkb;
+    };
+    auto shallow = nested(64);
+    ensure_equals(reader.read(shallow.data(), shallow.size())->getNumPoints(), 1u);
+    auto deep = nested(65);
+    try {
+        reader.read(deep.data(), deep.size());
+        fail("ParseException expected");
+    }
+    catch (const geos::io::ParseException&) {
+    }
+}
+
+} // namespace tut
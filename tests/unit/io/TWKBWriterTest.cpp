@@ -0,0 +1,181 @@
+//
+// Test Suite for geos::io::TWKBWriter
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/io/TWKBReader.h>
+#include <geos/io/TWKBWriter.h>
+#include <geos/io/WKBWriter.h>
+#include <geos/io/WKTReader.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Geometry.h>
+#include <geos/util/IllegalArgumentException.h>
+// std
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace tut {
+
+//
+// Test Group
+//
+
+struct test_twkbwriter_data {
+    geos::geom::GeometryFactory::Ptr gf;
+    geos::io::TWKBReader reader;
+    geos::io::WKTReader wktreader;
+    geos::io::TWKBWriter writer;
+
+    test_twkbwriter_data()
+        :
+        gf(geos::geom::GeometryFactory::create()),
+        reader(*gf),
+        wktreader(*gf)
+    {}
+
+    std::vector<unsigned char>
+    write(const std::string& wkt)
+    {
+        std::vector<unsigned char> twkb;
+        writer.write(*wktreader.read(wkt), twkb);
+        return twkb;
+    }
+
+    // Write and read back, with and without size and bounding box
+    void
+    checkRoundTrip(const std::string& wkt, const std::string& expected)
+    {
+        for (int flags = 0; flags < 4; flags++) {
+            writer.setIncludeSize(flags & 1);
+            writer.setIncludeBBox(flags & 2);
+            auto twkb = write(wkt);
+            std::size_t bytesRead = 0;
+            auto geom = reader.read(twkb.data(), twkb.size(), &bytesRead);
+            ensure_equals(bytesRead, twkb.size());
+            ensure_equals(wkt, geom->toText(), wktreader.read(expected)->toText());
+        }
+        writer.setIncludeSize(false);
+        writer.setIncludeBBox(false);
+    }
+};
+
+typedef test_group<test_twkbwriter_data> group;
+typedef group::object object;
+
+group t_twkbwriter_group("geos::io::TWKBWriter");
+
+// Examples of the TWKB specification
+template<>
+template<>
+void object::test<1>
+()
+{
+    ensure(write("POINT (1 2)") == std::vector<unsigned char>({ 0x01, 0x00, 0x02, 0x04 }));
+    ensure(write("LINESTRING EMPTY") == std::vector<unsigned char>({ 0x02, 0x10 }));
+
+    writer.setXYPrecision(2);
+    ensure(write("LINESTRING (3 4, 5 6)") ==
+           std::vector<unsigned char>({ 0x42, 0x00, 0x02, 0xd8, 0x04, 0xa0, 0x06, 0x90, 0x03, 0x90, 0x03 }));
+
+    writer.setXYPrecision(0);
+    writer.setIncludeSize(true);
+    writer.setIncludeBBox(true);
+    ensure(write("LINESTRING (1 2, 3 4)") ==
+           std::vector<unsigned char>({ 0x02, 0x03, 0x09, 0x02, 0x04, 0x04, 0x04, 0x02, 0x02, 0x04, 0x04, 0x04 }));
+}
+
+// Round trip of all geometry types, ordinates rounded to the precision
+template<>
+template<>
+void object::test<2>
+()
+{
+    writer.setXYPrecision(1);
+    checkRoundTrip("POINT (1.04 -2.06)", "POINT (1 -2.1)");
+    checkRoundTrip("POINT EMPTY", "POINT EMPTY");
+    checkRoundTrip("LINESTRING (0 0, 10 10.5, 20 0)", "LINESTRING (0 0, 10 10.5, 20 0)");
+    checkRoundTrip("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (1 1, 2 1, 2 2, 1 1))",
+                   "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (1 1, 2 1, 2 2, 1 1))");
+    checkRoundTrip("MULTIPOINT ((0 0), (-1 -1))", "MULTIPOINT ((0 0), (-1 -1))");
+    checkRoundTrip("MULTILINESTRING ((0 0, 1 1), EMPTY, (2 2, 3 3))", "MULTILINESTRING ((0 0, 1 1), EMPTY, (2 2, 3 3))");
+    checkRoundTrip("MULTIPOLYGON (((0 0, 1 0, 1 1, 0 0)), ((5 5, 6 5, 6 6, 5 5)))",
+                   "MULTIPOLYGON (((0 0, 1 0, 1 1, 0 0)), ((5 5, 6 5, 6 6, 5 5)))");
+    checkRoundTrip("GEOMETRYCOLLECTION (POINT (1 1), LINESTRING (2 2, 3 3), POLYGON EMPTY)",
+                   "GEOMETRYCOLLECTION (POINT (1 1), LINESTRING (2 2, 3 3), POLYGON EMPTY)");
+
+    writer.setXYPrecision(-2);
+    checkRoundTrip("POINT (1234 -5678)", "POINT (1200 -5700)");
+}
+
+// Z values are written with their own precision when the output dimension is 3
+template<>
+template<>
+void object::test<3>
+()
+{
+    ensure_equals(write("POINT Z (1 2 3)").size(), 4u);
+
+    writer.setOutputDimension(3);
+    writer.setZPrecision(1);
+    ensure(write("POINT Z (1 2 3)") == std::vector<unsigned char>({ 0x01, 0x08, 0x05, 0x02, 0x04, 0x3c }));
+
+    auto twkb = write("LINESTRING Z (0 0 0.12, 1 1 5.55)");
+    auto geom = reader.read(twkb.data(), twkb.size());
+    ensure_equals(geom->getCoordinateDimension(), 3);
+    ensure_equals(geom->getCoordinate()->x, 0);
+
+    geos::io::WKBWriter wkbWriter(3);
+    std::ostringstream os;
+    wkbWriter.write(*geom, os);
+    auto roundTripped = wktreader.read("LINESTRING Z (0 0 0.1, 1 1 5.6)");
+    std::ostringstream expected;
+    wkbWriter.write(*roundTripped, expected);
+    ensure(os.str() == expected.str());
+}
+
+// Geometries that cannot be written, invalid settings
+template<>
+template<>
+void object::test<4>
+()
+{
+    auto throws = [this](const std::string& wkt) {
+        try {
+            write(wkt);
+            return false;
+        }
+        catch (const geos::util::IllegalArgumentException&) {
+            return true;
+        }
+    };
+    ensure(throws("MULTIPOINT ((0 0), EMPTY)"));
+    ensure(throws("POINT (1e300 0)"));
+
+    try {
+        writer.setXYPrecision(8);
+        fail("IllegalArgumentException expected");
+    }
+    catch (const geos::util::IllegalArgumentException&) {
+    }
+}
+
+// TWKB is smaller than WKB
+template<>
+template<>
+void object::test<5>
+()
+{
+    auto geom = wktreader.read("LINESTRING (100.123456 40.123456, 100.123556 40.123356, 100.124556 40.122356, 100.125556 40.121356)");
+    writer.setXYPrecision(6);
+    std::vector<unsigned char> twkb;
+    writer.write(*geom, twkb);
+
+    std::ostringstream wkb;
+    geos::io::WKBWriter().write(*geom, wkb);
+    ensure(twkb.size() * 3 < wkb.str().size());
+}
+
+} // namespace tut
@@ -0,0 +1,236 @@
+//
+// Test Suite for geos::io::WKTBufferReader
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/io/WKTBufferReader.h>
+#include <geos/io/WKTReader.h>
+#include <geos/io/WKTWriter.h>
+#include <geos/geom/PrecisionModel.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/Point.h>
+#include <geos/util/string.h>
+// std
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_wktbufferreader_data {
+    geos::io::WKTBufferReader reader;
+    geos::io::WKTReader wktreader;
+    geos::io::WKTWriter wktwriter;
+
+    typedef std::unique_ptr<geos::geom::Geometry> GeomPtr;
+
+    test_wktbufferreader_data()
+    {
+        wktwriter.setOutputDimension(3);
+        wktwriter.setRoundingPrecision(17);
+        wktwriter.setTrim(true);
+    }
+
+    // Checks that the geometry read is the same as the one read by WKTReader
+    void checkSameAsWKTReader(const std::string& wkt)
+    {
+        GeomPtr expected = wktreader.read(wkt);
+        GeomPtr actual = reader.read(wkt);
+        ensure_equals(wkt, wktwriter.write(actual.get()), wktwriter.write(expected.get()));
+        ensure_equals(wkt, actual->getGeometryTypeId(), expected->getGeometryTypeId());
+        ensure_equals(wkt, actual->getCoordinateDimension(), expected->getCoordinateDimension());
+    }
+
+    void checkParseException(const std::string& wkt)
+    {
+        try {
+            reader.read(wkt);
+            fail(wkt);
+        }
+        catch (const geos::io::ParseException&) {}
+    }
+
+    static double parse(const std::string& s)
+    {
+        double d;
+        ensure(s, geos::util::parseDouble(s.data(), s.data() + s.size(), d));
+        return d;
+    }
+};
+
+typedef test_group<test_wktbufferreader_data> group;
+typedef group::object object;
+
+group test_wktbufferreader_group("geos::io::WKTBufferReader");
+
+// Same geometries as WKTReader
+template<>
+template<>
+void object::test<1>
+()
+{
+    const std::vector<std::string> wkts = {
+        "POINT (1 2)",
+        "point(-1.5e3 .25)",
+        "POINT Z (1 2 3)",
+        "POINTZ (1 2 3)",
+        "POINT M (1 2 3)",
+        "POINT ZM (1 2 3 4)",
+        "POINT (1 2 3)",
+        "POINT (1 2 3 4)",
+        "POINT EMPTY",
+        "POINT Z EMPTY",
+        "LINESTRING (0 0, 10 10, 20 0)",
+        "LINESTRING(0 0,10 10,20 0)",
+        "\tLINESTRING\n(\r\n0 0 ,\t10 10\n)  ",
+        "LINESTRING Z (0 0 1, 10 10 2)",
+        "LINESTRING EMPTY",
+        "LINEARRING (0 0, 0 1, 1 1, 0 0)",
+        "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (1 1, 2 1, 2 2, 1 1))",
+        "POLYGON EMPTY",
+        "POLYGON Z EMPTY",
+        "MULTIPOINT (0 0, 1 1)",
+        "MULTIPOINT ((0 0), (1 1))",
+        "MULTIPOINT ((0 0), EMPTY, (1 1))",
+        "MULTIPOINT Z ((0 0 1), (1 1 2))",
+        "MULTIPOINT EMPTY",
+        "MULTILINESTRING ((0 0, 1 1), (2 2, 3 3))",
+        "MULTILINESTRING ((0 0, 1 1), EMPTY)",
+        "MULTIPOLYGON (((0 0, 1 0, 1 1, 0 0)), ((5 5, 6 5, 6 6, 5 5)))",
+        "MULTIPOLYGON (EMPTY, ((0 0, 1 0, 1 1, 0 0)))",
+        "GEOMETRYCOLLECTION (POINT (1 2), LINESTRING (0 0, 1 1))",
+        "GEOMETRYCOLLECTION (POINT (1 2), GEOMETRYCOLLECTION (POINT EMPTY))",
+        "GEOMETRYCOLLECTION Z (POINT Z (1 2 3), LINESTRING Z (0 0 0, 1 1 1))",
+        "GEOMETRYCOLLECTION EMPTY",
+        "POINT (0.1 0.30000000000000004)",
+        "POINT (123456789012345678901234567890 1e-320)",
+        "POINT (1.7976931348623157e308 -2.2250738585072014e-308)",
+        "POINT (inf -Infinity)",
+        "POINT (1e400 -1e400)"
+    };
+    for (const auto& wkt : wkts) {
+        checkSameAsWKTReader(wkt);
+    }
+}
+
+// Invalid text
+template<>
+template<>
+void object::test<2>
+()
+{
+    checkParseException("");
+    checkParseException("POINT");
+    checkParseException("POINT (1)");
+    checkParseException("POINT (1 2");
+    checkParseException("POINT (1 a)");
+    checkParseException("POINT (1,5 2)");
+    checkParseException("POINT (1 2) POINT (3 4)");
+    checkParseException("POINT (1e 2)");
+    checkParseException("LINESTRING (0 0, 1 1 1)");
+    checkParseException("LINESTRING (0 0; 1 1)");
+    checkParseException("POLYGON ((0 0, 1 0, 1 1, 0 0)");
+    checkParseException("TRIANGLE ((0 0, 1 0, 1 1, 0 0))");
+    checkParseException("MULTIPOINT (,)");
+    checkParseException("GEOMETRYCOLLECTION Z (POINT (1 2))");
+}
+
+// Unclosed rings are closed with setFixStructure
+template<>
+template<>
+void object::test<3>
+()
+{
+    reader.setFixStructure(true);
+    auto geom = reader.read("POLYGON ((0 0, 1 0, 1 1, 0 1))");
+    ensure_equals(wktwriter.write(geom.get()), "POLYGON ((0 0, 1 0, 1 1, 0 1, 0 0))");
+}
+
+// Several geometries in a buffer
+template<>
+template<>
+void object::test<4>
+()
+{
+    std::string text = "POINT (1 2)\nLINESTRING (0 0, 1 1)\r\n\nPOLYGON EMPTY POINT Z (1 2 3)\n\n";
+
+    std::vector<std::string> wkts;
+    std::size_t pos = 0;
+    while (auto geom = reader.readNext(text, pos)) {
+        wkts.push_back(wktwriter.write(geom.get()));
+    }
+    ensure_equals(pos, text.size());
+    ensure_equals(wkts.size(), 4u);
+    ensure_equals(wkts[0], "POINT (1 2)");
+    ensure_equals(wkts[1], "LINESTRING (0 0, 1 1)");
+    ensure_equals(wkts[2], "POLYGON EMPTY");
+    ensure_equals(wkts[3], "POINT Z (1 2 3)");
+
+    // The text does not need to be null-terminated
+    pos = 0;
+    try {
+        reader.readNext(text.data(), 9, pos);
+        fail();
+    }
+    catch (const geos::io::ParseException&) {}
+}
+
+// Precision model of the factory is applied, and the template read
+template<>
+template<>
+void object::test<5>
+()
+{
+    geos::geom::PrecisionModel pm(10.0);
+    auto gf = geos::geom::GeometryFactory::create(&pm);
+    geos::io::WKTBufferReader fixedReader(*gf);
+
+    auto pt = fixedReader.read<geos::geom::Point>("POINT (1.2345 5.4321)");
+    ensure_equals(pt->getX(), 1.2);
+    ensure_equals(pt->getY(), 5.4);
+    ensure(pt->getFactory() == gf.get());
+
+    try {
+        fixedReader.read<geos::geom::LineString>("POINT (1 2)");
+        fail();
+    }
+    catch (const geos::io::ParseException&) {}
+}
+
+// Numbers are correctly rounded
+template<>
+template<>
+void object::test<6>
+()
+{
+    ensure_equals(parse("0"), 0.0);
+    ensure(std::signbit(parse("-0")));
+    ensure_equals(parse("+.5"), 0.5);
+    ensure_equals(parse("5."), 5.0);
+    ensure_equals(parse("-1.5E3"), -1500.0);
+    ensure_equals(parse("0.1"), 0.1);
+    ensure_equals(parse("9007199254740993"), 9007199254740992.0);
+    ensure_equals(parse("1.00000000000000011102230246251565404236316680908203125"), 1.0000000000000002);
+    ensure_equals(parse("1.00000000000000011102230246251565404236316680908203124"), 1.0);
+    ensure_equals(parse("1.7976931348623157e308"), 1.7976931348623157e308);
+    ensure_equals(parse("4.9406564584124654e-324"), 4.9406564584124654e-324);
+    ensure_equals(parse("2e-324"), 0.0);
+    ensure(std::isinf(parse("1e309")));
+    ensure(std::isnan(parse("nan")));
+    ensure_equals(parse("0x10"), 16.0);
+
+    double d;
+    for (const char* s : { "", "-", ".", "e5", "1e", "1e+", "1.2.3", "1,5", "POINT", "EMPTY" }) {
+        ensure(s, !geos::util::parseDouble(s, s + std::strlen(s), d));
+    }
+}
+
+} // namespace tut
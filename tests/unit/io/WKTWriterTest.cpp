@@ -235,8 +235,32 @@ void object::test<8>
     ensure_equals(result, std::string(gctxt));
 }
 
-
-
+// 9 - Write into a caller-provided buffer, trimmed and untrimmed
+template<>
+template<>
+void object::test<9>
+()
+{
+    GeomPtr geom(wktreader.read("MULTIPOINT ((1.25 -2), (1000000 0.001), EMPTY)"));
+
+    for (bool trim : { true, false }) {
+        wktwriter.setTrim(trim);
+        std::string expected = trim
+                               ? "MULTIPOINT (1.25 -2, 1000000 0.001, EMPTY)"
+                               : "MULTIPOINT (1.250 -2.000, 1000000.000 0.001, EMPTY)";
+        ensure_equals(wktwriter.write(geom.get()), expected);
+
+        char buffer[128];
+        std::size_t length = wktwriter.write(geom.get(), buffer, sizeof(buffer));
+        ensure_equals(length, expected.size());
+        ensure_equals(std::string(buffer), expected);
+
+        char small[10];
+        length = wktwriter.write(geom.get(), small, sizeof(small));
+        ensure_equals(length, expected.size());
+        ensure_equals(std::string(small), expected.substr(0, 9));
+    }
+}
 
 } // namespace tut
 
@@ -5,6 +5,7 @@
 #include <tut/tut.hpp>
 // geos
 #include <geos/io/Writer.h>
+#include <geos/util/IllegalArgumentException.h>
 // std
 #include <sstream>
 #include <string>
@@ -83,6 +84,79 @@ void object::test<4>
     ensure_equals(writer.toString(), "Hello World!");
 }
 
-} // namespace tut
+// Writing into a caller-provided buffer
+template<>
+template<>
+void object::test<5>
+()
+{
+    char buffer[8];
+    geos::io::Writer writer(buffer, sizeof(buffer));
+
+    writer.write("Hello");
+    writer.write(' ');
+    ensure_equals(writer.getLength(), 6u);
+    ensure_equals(std::string(buffer, 6), "Hello ");
 
+    writer.write("World!");
+    ensure_equals(writer.getLength(), 12u);
+    ensure_equals(std::string(buffer, 8), "Hello Wo");
+    ensure_equals(writer.toString(), "Hello Wo");
+}
+
+// Formatting in place
+template<>
+template<>
+void object::test<6>
+()
+{
+    auto format = [](geos::io::Writer& writer) {
+        for (int i = 0; i < 3; i++) {
+            char* p = writer.prepare(16);
+            p[0] = 'a';
+            p[1] = 'b';
+            p[2] = 'c';
+            writer.commit(3);
+        }
+    };
 
+    geos::io::Writer writer;
+    format(writer);
+    ensure_equals(writer.getLength(), 9u);
+    ensure_equals(writer.toString(), "abcabcabc");
+
+    char buffer[8];
+    geos::io::Writer bufferWriter(buffer, sizeof(buffer));
+    format(bufferWriter);
+    ensure_equals(bufferWriter.getLength(), 9u);
+    ensure_equals(bufferWriter.toString(), "abcabcab");
+
+    bufferWriter.clear();
+    bufferWriter.write("x");
+    ensure_equals(bufferWriter.getLength(), 1u);
+    ensure_equals(std::string(buffer, 8), "xbcabcab");
+}
+
+// A null buffer of size 0 only measures the text
+template<>
+template<>
+void object::test<7>
+()
+{
+    geos::io::Writer writer(nullptr, 0);
+    writer.write("Hello ");
+    writer.write('W');
+    char* p = writer.prepare(16);
+    p[0] = 'o';
+    writer.commit(1);
+    ensure_equals(writer.getLength(), 8u);
+    ensure_equals(writer.toString(), "");
+
+    try {
+        geos::io::Writer invalid(nullptr, 8);
+        fail();
+    }
+    catch (const geos::util::IllegalArgumentException&) {}
+}
+
+} // namespace tut
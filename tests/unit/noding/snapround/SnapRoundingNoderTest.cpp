@@ -14,7 +14,10 @@
 #include <geos/io/WKTReader.h>
 #include <geos/io/WKTWriter.h>
 #include <geos/geom/Geometry.h>
+#include <geos/geom/CoordinateArraySequence.h>
 #include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/MultiLineString.h>
 #include <geos/geom/PrecisionModel.h>
 #include <geos/geom/util/LinearComponentExtracter.h>
 
@@ -61,6 +64,23 @@ struct test_snaproundingnoder_data {
         ensure_equals_geometry(result.get(), expected.get());
     }
 
+    void
+    checkParallelMatchesSerial(const Geometry* geom, double scale)
+    {
+        PrecisionModel pm(scale);
+
+        SnapRoundingNoder serialNoder(&pm);
+        std::unique_ptr<Geometry> expected = geos::NodingTestUtil::nodeValidated(geom, nullptr, &serialNoder);
+
+        for (std::size_t numThreads : {2u, 4u}) {
+            SnapRoundingNoder parallelNoder(&pm);
+            parallelNoder.setNumThreads(numThreads);
+            std::unique_ptr<Geometry> result = geos::NodingTestUtil::nodeValidated(geom, nullptr, &parallelNoder);
+
+            ensure_equals(w.write(result.get()), w.write(expected.get()));
+        }
+    }
+
 
     // test_snaproundingnoder_data() {}
 };
@@ -284,4 +304,33 @@ void object::test<17> ()
 }
 
 
+// testParallel
+template<>
+template<>
+void object::test<18> ()
+{
+    std::string wkt = "MULTILINESTRING ((1 3.3, 1.3 1.4, 3.1 1.4, 3.1 0.9, 1.3 0.9, 1 -0.2, 0.8 1.3, 1 3.3), (1 2.9, 2.9 2.9, 2.9 1.3, 1.7 1, 1.3 0.9, 1 0.4, 1 2.9))";
+    checkParallelMatchesSerial(r.read(wkt).get(), 1.0);
+
+    // many crossing lines, with enough chains to be split between threads
+    std::vector<std::unique_ptr<Geometry>> lines;
+    unsigned int seed = 12345;
+    auto next = [&seed]() {
+        seed = seed * 1103515245 + 12345;
+        return static_cast<double>((seed >> 8) % 100000) / 1000.0;
+    };
+    auto factory = GeometryFactory::create();
+    for (int i = 0; i < 300; i++) {
+        CoordinateArraySequence pts;
+        for (int j = 0; j < 5; j++) {
+            pts.add(Coordinate(next(), next()));
+        }
+        lines.emplace_back(factory->createLineString(pts));
+    }
+    auto geom = factory->createMultiLineString(std::move(lines));
+
+    checkParallelMatchesSerial(geom.get(), 1.0);
+    checkParallelMatchesSerial(geom.get(), 10.0);
+}
+
 } // namespace tut
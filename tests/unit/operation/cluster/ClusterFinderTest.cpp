@@ -8,8 +8,12 @@
 #include <geos/operation/cluster/GeometryIntersectsClusterFinder.h>
 #include <geos/operation/cluster/EnvelopeIntersectsClusterFinder.h>
 #include <geos/operation/cluster/GeometryDistanceClusterFinder.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Point.h>
 #include <geos/io/WKTReader.h>
 
+#include <random>
+
 using geos::geom::Geometry;
 
 template<typename T, typename U>
@@ -27,6 +31,84 @@ namespace tut {
 // Common data used by tests
 struct test_cluster_data {
     geos::io::WKTReader reader;
+
+    // Number clusters in order of their lowest-numbered element, so that
+    // results can be compared independently of cluster order.
+    static std::vector<std::size_t> canonicalIds(const geos::operation::cluster::Clusters& clusters) {
+        const std::size_t none = std::numeric_limits<std::size_t>::max();
+        auto ids = clusters.getClusterIds(none);
+
+        std::vector<std::size_t> relabel(clusters.getNumClusters(), none);
+        std::size_t next = 0;
+        for (auto& id : ids) {
+            if (id != none) {
+                if (relabel[id] == none) {
+                    relabel[id] = next++;
+                }
+                id = relabel[id];
+            }
+        }
+        return ids;
+    }
+
+    static std::vector<std::unique_ptr<Geometry>> randomPoints(std::size_t n, double size) {
+        auto gf = geos::geom::GeometryFactory::create();
+        std::default_random_engine e(1234);
+        std::uniform_real_distribution<> dis(0, size);
+
+        std::vector<std::unique_ptr<Geometry>> pts;
+        for (std::size_t i = 0; i < n; i++) {
+            pts.emplace_back(gf->createPoint(geos::geom::CoordinateXY(dis(e), dis(e))));
+        }
+        return pts;
+    }
+
+    // Wrap each point in a MultiPoint, so that clustering cannot use the
+    // point grid and must go through the spatial index.
+    static std::vector<std::unique_ptr<Geometry>> asMultiPoints(const std::vector<std::unique_ptr<Geometry>>& pts) {
+        std::vector<std::unique_ptr<Geometry>> ret;
+        for (const auto& pt : pts) {
+            std::vector<std::unique_ptr<Geometry>> parts;
+            parts.push_back(pt->clone());
+            ret.push_back(pt->getFactory()->createMultiPoint(std::move(parts)));
+        }
+        return ret;
+    }
+
+    template<typename Finder>
+    void checkGridMatchesIndex(Finder& finder, const std::vector<std::unique_ptr<Geometry>>& pts) {
+        auto multiPts = asMultiPoints(pts);
+
+        std::vector<const Geometry*> ptInput;
+        std::vector<const Geometry*> multiPtInput;
+        for (std::size_t i = 0; i < pts.size(); i++) {
+            ptInput.push_back(pts[i].get());
+            multiPtInput.push_back(multiPts[i].get());
+        }
+
+        auto fromGrid = finder.cluster(ptInput);
+        auto fromIndex = finder.cluster(multiPtInput);
+
+        ensure_equals(fromGrid.getNumClusters(), fromIndex.getNumClusters());
+        ensure(canonicalIds(fromGrid) == canonicalIds(fromIndex));
+    }
+
+    template<typename Finder>
+    void checkParallelMatchesSerial(Finder& finder, const std::vector<std::unique_ptr<Geometry>>& geoms) {
+        std::vector<const Geometry*> input;
+        for (const auto& g : geoms) {
+            input.push_back(g.get());
+        }
+
+        finder.setNumThreads(1);
+        auto serial = finder.cluster(input);
+
+        finder.setNumThreads(4);
+        auto parallel = finder.cluster(input);
+
+        ensure_equals(parallel.getNumClusters(), serial.getNumClusters());
+        ensure(canonicalIds(parallel) == canonicalIds(serial));
+    }
 };
 
 typedef test_group<test_cluster_data> group;
@@ -210,6 +292,81 @@ void object::test<5>() {
     ensure_equals(cluster_id_vec[0], 0u);
 }
 
+
+// Parallel DBSCAN produces the same clusters as serial DBSCAN
+template<>
+template<>
+void object::test<6>() {
+    using geos::operation::cluster::DBSCANClusterFinder;
+
+    auto pts = randomPoints(2000, 100);
+
+    DBSCANClusterFinder finder(1.5, 4);
+    checkParallelMatchesSerial(finder, pts);
+}
+
+// Parallel distance and intersection clustering produce the same clusters as serial
+template<>
+template<>
+void object::test<7>() {
+    using geos::operation::cluster::GeometryDistanceClusterFinder;
+    using geos::operation::cluster::GeometryIntersectsClusterFinder;
+
+    auto pts = randomPoints(2000, 100);
+
+    GeometryDistanceClusterFinder distFinder(1.2);
+    checkParallelMatchesSerial(distFinder, pts);
+
+    std::vector<std::unique_ptr<Geometry>> buffers;
+    for (const auto& pt : pts) {
+        buffers.push_back(pt->buffer(0.8, 2));
+    }
+
+    GeometryIntersectsClusterFinder intFinder;
+    checkParallelMatchesSerial(intFinder, buffers);
+}
+
+// Point-only inputs clustered with the point grid match the spatial index results
+template<>
+template<>
+void object::test<8>() {
+    using geos::operation::cluster::DBSCANClusterFinder;
+    using geos::operation::cluster::GeometryDistanceClusterFinder;
+
+    auto pts = randomPoints(1500, 60);
+
+    DBSCANClusterFinder dbscan(1.3, 3);
+    checkGridMatchesIndex(dbscan, pts);
+
+    GeometryDistanceClusterFinder dist(0.9);
+    checkGridMatchesIndex(dist, pts);
+
+    dist.setNumThreads(3);
+    checkGridMatchesIndex(dist, pts);
+}
+
+// Points exactly at the clustering distance are clustered with the point grid
+template<>
+template<>
+void object::test<9>() {
+    using geos::operation::cluster::DBSCANClusterFinder;
+    using geos::operation::cluster::GeometryDistanceClusterFinder;
+
+    auto gf = geos::geom::GeometryFactory::create();
+    std::vector<std::unique_ptr<Geometry>> pts;
+    for (int i = 0; i < 20; i++) {
+        for (int j = 0; j < 20; j += (i % 3 == 0 ? 1 : 3)) {
+            pts.emplace_back(gf->createPoint(geos::geom::CoordinateXY(0.1 * i - 7.3, 0.1 * j + 1e6)));
+        }
+    }
+
+    GeometryDistanceClusterFinder dist(0.1);
+    checkGridMatchesIndex(dist, pts);
+
+    DBSCANClusterFinder dbscan(0.1, 4);
+    checkGridMatchesIndex(dbscan, pts);
+}
+
 } // namespace tut
 
 
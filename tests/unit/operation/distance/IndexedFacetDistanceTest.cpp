@@ -381,6 +381,32 @@ void object::test<11>
         fail("IndexedFacedDistance::nearestPoints did not throw on empty input");
     }
     catch (const GEOSException&) { }
+
+    try {
+        ifd0.distance(geos::geom::CoordinateXY(150, 150));
+        fail("IndexedFacedDistance::distance did not throw on empty input");
+    }
+    catch (const GEOSException&) { }
+}
+
+// Distance to a point is the same as distance to a Point geometry
+template<>
+template<>
+void object::test<12>
+()
+{
+    using geos::operation::distance::IndexedFacetDistance;
+
+    GeomPtr g(_wktreader.read("POLYGON ((0 0, 0 100, 40 100, 40 20, 60 20, 60 100, 100 100, 100 0, 0 0), (10 10, 10 90, 30 90, 10 10))"));
+    IndexedFacetDistance ifd(g.get());
+
+    for (int x = -20; x <= 120; x += 7) {
+        for (int y = -20; y <= 120; y += 7) {
+            geos::geom::Coordinate c(x, y);
+            GeomPtr pt(_factory->createPoint(c));
+            ensure_equals(ifd.distance(geos::geom::CoordinateXY(c)), ifd.distance(pt.get()));
+        }
+    }
 }
 
 
@@ -12,6 +12,7 @@
 #include <geos/geom/Point.h>
 #include <geos/io/WKTReader.h>
 #include <geos/io/WKTWriter.h>
+#include <geos/util/IllegalArgumentException.h>
 #include <geos/util/TopologyException.h>
 // std
 #include <memory>
@@ -218,6 +219,50 @@ namespace tut {
         checkCoverageUnionFails(geoms);
     }
 
+    template<>
+    template<>
+    void object::test<11>()
+    {
+        // Grouped union only dissolves edges shared within a group
+        using geos::io::WKTReader;
+        using geos::geom::Geometry;
+        using geos::geom::GeometryFactory;
+        using geos::operation::geounion::CoverageUnion;
+
+        auto gfact = GeometryFactory::create();
+        WKTReader reader(gfact.get());
+
+        std::vector<std::unique_ptr<Geometry>> geoms;
+        geoms.push_back(reader.read("POLYGON ((0 0, 0 1, 1 1, 1 0, 0 0))"));
+        geoms.push_back(reader.read("POLYGON ((1 0, 1 1, 2 1, 2 0, 1 0))"));
+        geoms.push_back(reader.read("POLYGON ((0 1, 0 2, 1 2, 1 1, 0 1))"));
+        geoms.push_back(reader.read("POLYGON ((1 1, 1 2, 2 2, 2 1, 1 1))"));
+        geoms.push_back(reader.read("POLYGON ((5 5, 5 6, 6 6, 6 5, 5 5))"));
+        std::vector<const Geometry*> coverage;
+        for (const auto& geom : geoms) {
+            coverage.push_back(geom.get());
+        }
+        std::vector<std::int64_t> keys{ 7, 3, 7, 3, 7 };
+
+        auto result = CoverageUnion::Union(coverage, keys);
+
+        ensure_equals(result.size(), 2u);
+        auto expected3 = reader.read("POLYGON ((1 0, 1 2, 2 2, 2 0, 1 0))");
+        auto expected7 = reader.read("MULTIPOLYGON (((0 0, 0 2, 1 2, 1 0, 0 0)), ((5 5, 5 6, 6 6, 6 5, 5 5)))");
+        ensure(result[3]->equals(expected3.get()));
+        ensure(result[7]->equals(expected7.get()));
+
+        auto parallel = CoverageUnion::Union(coverage, keys, 4);
+        ensure(parallel[3]->equalsExact(result[3].get()));
+        ensure(parallel[7]->equalsExact(result[7].get()));
+
+        keys.pop_back();
+        try {
+            CoverageUnion::Union(coverage, keys);
+            fail("IllegalArgumentException expected");
+        } catch (const geos::util::IllegalArgumentException&) {}
+    }
+
 } // namespace tut
 
 
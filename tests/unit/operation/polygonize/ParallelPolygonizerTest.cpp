@@ -0,0 +1,253 @@
+//
+// Test Suite for geos::operation::polygonize::ParallelPolygonizer class.
+//
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/operation/polygonize/ParallelPolygonizer.h>
+#include <geos/operation/polygonize/Polygonizer.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/LineString.h>
+#include <geos/geom/Polygon.h>
+#include <geos/io/WKTReader.h>
+#include <geos/io/WKTWriter.h>
+// std
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used by tests
+struct test_parallelpolygonizer_data {
+    geos::io::WKTReader wktreader;
+    geos::io::WKTWriter wktwriter;
+
+    typedef geos::geom::Geometry Geom;
+    typedef geos::operation::polygonize::ParallelPolygonizer ParallelPolygonizer;
+    typedef geos::operation::polygonize::Polygonizer Polygonizer;
+
+    std::vector<std::unique_ptr<Geom>> inputGeoms;
+
+    test_parallelpolygonizer_data()
+    {
+        wktwriter.setTrim(true);
+    }
+
+    std::vector<const Geom*>
+    readInput(const std::vector<std::string>& inputWKT)
+    {
+        std::vector<const Geom*> geoms;
+        for (const auto& wkt : inputWKT) {
+            inputGeoms.push_back(wktreader.read(wkt));
+            geoms.push_back(inputGeoms.back().get());
+        }
+        return geoms;
+    }
+
+    /**
+     * A noded grid of lines, with a square and a triangle inside
+     * some of the cells.
+     */
+    std::vector<const Geom*>
+    createGrid(int size)
+    {
+        std::vector<std::string> inputWKT;
+        for (int i = 0; i < size; i++) {
+            for (int j = 0; j <= size; j++) {
+                std::ostringstream h, v;
+                h << "LINESTRING (" << i << " " << j << ", " << i + 0.5 << " " << j + 0.1 << ", " << i + 1 << " " << j << ")";
+                v << "LINESTRING (" << j << " " << i << ", " << j << " " << i + 1 << ")";
+                inputWKT.push_back(h.str());
+                inputWKT.push_back(v.str());
+            }
+        }
+        for (int i = 0; i < size; i += 2) {
+            for (int j = 0; j < size; j += 3) {
+                std::ostringstream sq, tri;
+                sq << "LINESTRING (" << i + 0.2 << " " << j + 0.2 << ", " << i + 0.8 << " " << j + 0.2 << ", "
+                   << i + 0.8 << " " << j + 0.8 << ", " << i + 0.2 << " " << j + 0.8 << ", " << i + 0.2 << " " << j + 0.2 << ")";
+                tri << "LINESTRING (" << i + 0.3 << " " << j + 0.3 << ", " << i + 0.5 << " " << j + 0.3 << ", "
+                    << i + 0.5 << " " << j + 0.5 << ", " << i + 0.3 << " " << j + 0.3 << ")";
+                inputWKT.push_back(sq.str());
+                inputWKT.push_back(tri.str());
+            }
+        }
+        return readInput(inputWKT);
+    }
+
+    template <class T>
+    std::string
+    toString(const std::vector<T>& geoms)
+    {
+        std::string s;
+        for (const auto& g : geoms) {
+            s += wktwriter.write(g.get()) + "\n";
+        }
+        return s;
+    }
+
+    // Checks that the polygons are the same and in the same order as
+    // those computed by Polygonizer
+    void
+    checkSameAsPolygonizer(std::vector<const Geom*>& geoms, bool onlyPolygonal, std::size_t numThreads = 1)
+    {
+        Polygonizer polygonizer(onlyPolygonal);
+        polygonizer.add(&geoms);
+        auto expected = polygonizer.getPolygons();
+
+        ParallelPolygonizer parPolygonizer(onlyPolygonal);
+        parPolygonizer.setNumThreads(numThreads);
+        parPolygonizer.add(geoms);
+        auto polys = parPolygonizer.getPolygons();
+
+        ensure_equals(toString(polys), toString(expected));
+        ensure_equals(toString(parPolygonizer.getInvalidRingLines()),
+                      toString(polygonizer.getInvalidRingLines()));
+        ensure(parPolygonizer.getCutEdges() == polygonizer.getCutEdges());
+        ensure_equals(parPolygonizer.getDangles().size(), polygonizer.getDangles().size());
+    }
+};
+
+typedef test_group<test_parallelpolygonizer_data> group;
+typedef group::object object;
+
+group test_parallelpolygonizer_group("geos::operation::polygonize::ParallelPolygonizer");
+
+// Empty input
+template<>
+template<>
+void object::test<1>
+()
+{
+    auto geoms = readInput({ "LINESTRING EMPTY", "LINESTRING (1 1, 1 1)" });
+
+    ParallelPolygonizer polygonizer;
+    polygonizer.add(geoms);
+    ensure(polygonizer.getPolygons().empty());
+    ensure(polygonizer.getDangles().empty());
+    ensure(polygonizer.getCutEdges().empty());
+    ensure(polygonizer.getInvalidRingLines().empty());
+}
+
+// Shell with a hole and a nested shell (JTS test3)
+template<>
+template<>
+void object::test<2>
+()
+{
+    auto geoms = readInput({
+        "LINESTRING (0 0, 4 0)",
+        "LINESTRING (4 0, 5 3)",
+        "LINESTRING (5 3, 4 6, 6 6, 5 3)",
+        "LINESTRING (5 3, 6 0)",
+        "LINESTRING (6 0, 10 0, 5 10, 0 0)",
+        "LINESTRING (4 0, 6 0)"
+    });
+    checkSameAsPolygonizer(geoms, false);
+}
+
+// Only polygonal output (JTS testPolygonal_OuterOnly_Checkerboard)
+template<>
+template<>
+void object::test<3>
+()
+{
+    auto geoms = readInput({
+        "LINESTRING (10 20, 20 20)",
+        "LINESTRING (10 20, 10 30)",
+        "LINESTRING (20 10, 10 10, 10 20)",
+        "LINESTRING (10 30, 20 30)",
+        "LINESTRING (10 30, 10 40, 20 40)",
+        "LINESTRING (30 10, 20 10)",
+        "LINESTRING (20 20, 20 10)",
+        "LINESTRING (20 20, 30 20)",
+        "LINESTRING (20 30, 20 20)",
+        "LINESTRING (20 30, 30 30)",
+        "LINESTRING (20 40, 20 30)",
+        "LINESTRING (20 40, 30 40)",
+        "LINESTRING (40 20, 40 10, 30 10)",
+        "LINESTRING (30 20, 30 10)",
+        "LINESTRING (30 20, 40 20)",
+        "LINESTRING (30 30, 30 20)",
+        "LINESTRING (30 30, 40 30)",
+        "LINESTRING (30 40, 30 30)",
+        "LINESTRING (30 40, 40 40, 40 30)",
+        "LINESTRING (40 30, 40 20)"
+    });
+    checkSameAsPolygonizer(geoms, true);
+}
+
+// Dangles, cut edges and invalid rings are reported
+template<>
+template<>
+void object::test<4>
+()
+{
+    auto geoms = readInput({
+        "LINESTRING (10 0, 10 10, 0 10, 0 0, 10 0)",
+        "LINESTRING (10 10, 15 15)",
+        "LINESTRING (15 15, 16 20)",
+        "LINESTRING (20 0, 30 0, 30 10, 20 10, 20 0)",
+        "LINESTRING (10 0, 20 0)",
+        "LINESTRING (40 0, 50 10, 50 0, 40 10, 40 0)"
+    });
+
+    ParallelPolygonizer polygonizer;
+    polygonizer.add(geoms);
+    auto polys = polygonizer.getPolygons();
+
+    ensure_equals(polys.size(), 2u);
+    ensure_equals(polygonizer.getDangles().size(), 2u);
+    ensure(polygonizer.getDangles()[0] == geoms[1]);
+    ensure(polygonizer.getDangles()[1] == geoms[2]);
+    ensure_equals(polygonizer.getCutEdges().size(), 1u);
+    ensure(polygonizer.getCutEdges()[0] == geoms[4]);
+    // both sides of the self-intersecting ring
+    ensure_equals(polygonizer.getInvalidRingLines().size(), 2u);
+
+    checkSameAsPolygonizer(geoms, false);
+}
+
+// Many components with nested rings
+template<>
+template<>
+void object::test<5>
+()
+{
+    auto geoms = createGrid(12);
+    checkSameAsPolygonizer(geoms, false);
+    checkSameAsPolygonizer(geoms, true);
+}
+
+// Result does not depend on the number of threads
+template<>
+template<>
+void object::test<6>
+()
+{
+    auto geoms = createGrid(20);
+    checkSameAsPolygonizer(geoms, false, 4);
+    checkSameAsPolygonizer(geoms, true, 4);
+}
+
+// Input collections and polygons
+template<>
+template<>
+void object::test<7>
+()
+{
+    auto geoms = readInput({
+        "MULTILINESTRING ((100 100, 100 300, 300 300, 300 100, 100 100), (150 150, 150 250, 250 250, 250 150, 150 150))",
+        "POLYGON ((0 0, 0 50, 50 50, 50 0, 0 0))"
+    });
+    checkSameAsPolygonizer(geoms, false);
+    checkSameAsPolygonizer(geoms, true);
+}
+
+} // namespace tut
@@ -433,4 +433,25 @@ void object::test<15>
 }
 
 
+// Simplifying with several tolerances matches simplifying with each
+template<>
+template<>
+void object::test<16>
+()
+{
+    std::string wkt_in("GEOMETRYCOLLECTION ("
+        "POLYGON ((21.32686 47.78723, 21.32386 47.79023, 21.32186 47.80223, 21.31486 47.81023, 21.32786 47.81123, 21.33986 47.80223, 21.33886 47.81123, 21.32686 47.82023, 21.32586 47.82723, 21.32786 47.82323, 21.33886 47.82623, 21.34186 47.82123, 21.36386 47.82223, 21.40686 47.81723, 21.32686 47.78723)),"
+        "LINESTRING (0 0, 1 1, 2 0.5, 3 3, 4 2.9, 5 0, 6 0.2, 7 4, 8 3.5, 9 0))");
+    GeomPtr g(wktreader.read(wkt_in));
+    std::vector<double> tolerances{ 0.0, 0.0036, 0.01, 0.5, 1.0, 3.0, 100.0 };
+
+    std::vector<GeomPtr> levels = DouglasPeuckerSimplifier::simplify(g.get(), tolerances);
+
+    ensure_equals(levels.size(), tolerances.size());
+    for (std::size_t i = 0; i < tolerances.size(); i++) {
+        GeomPtr expected = DouglasPeuckerSimplifier::simplify(g.get(), tolerances[i]);
+        ensure_equals(wktwriter.write(levels[i].get()), wktwriter.write(expected.get()));
+    }
+}
+
 } // namespace tut
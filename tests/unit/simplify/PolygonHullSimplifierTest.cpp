@@ -14,6 +14,7 @@
 // std
 #include <string>
 #include <memory>
+#include <vector>
 
 using geos::simplify::PolygonHullSimplifier;
 using geos::io::WKTReader;
@@ -205,4 +206,52 @@ void object::test<10>()
         0.01, "POLYGON ((30 120, 80 320, 320 280, 230 160, 250 60, 30 120))");
 }
 
+//
+// Hulls for several targets match hulls computed for each target
+//
+template<>
+template<>
+void object::test<11>()
+{
+    std::unique_ptr<Geometry> geom = reader_.read(
+        "POLYGON ((10 90, 40 60, 20 40, 40 20, 70 50, 40 30, 30 40, 60 70, 50 90, 90 90, 90 10, 10 10, 10 90))");
+
+    std::vector<double> fractions{ 0, 0.3, 0.5, 0.6, 0.7, 0.9, 1 };
+    for (bool isOuter : { true, false }) {
+        auto levels = PolygonHullSimplifier::hull(geom.get(), isOuter, fractions);
+        ensure_equals(levels.size(), fractions.size());
+        for (std::size_t i = 0; i < fractions.size(); i++) {
+            auto expected = PolygonHullSimplifier::hull(geom.get(), isOuter, fractions[i]);
+            ensure_equals_geometry(expected.get(), levels[i].get());
+        }
+    }
+
+    std::vector<double> ratios{ 0, 0.01, 0.1, 0.3, 1, 10 };
+    auto levels = PolygonHullSimplifier::hullByAreaDelta(geom.get(), true, ratios);
+    ensure_equals(levels.size(), ratios.size());
+    for (std::size_t i = 0; i < ratios.size(); i++) {
+        auto expected = PolygonHullSimplifier::hullByAreaDelta(geom.get(), true, ratios[i]);
+        ensure_equals_geometry(expected.get(), levels[i].get());
+    }
+}
+
+//
+// Hulls of rings constrained by other rings are valid for all targets
+//
+template<>
+template<>
+void object::test<12>()
+{
+    std::unique_ptr<Geometry> geom = reader_.read(
+        "MULTIPOLYGON (((10 10, 10 80, 20 20, 30 80, 40 20, 50 80, 50 10, 10 10)), ((60 10, 60 80, 70 30, 80 80, 90 30, 100 80, 100 10, 60 10)), ((15 90, 45 90, 45 85, 15 85, 15 90)))");
+
+    std::vector<double> fractions{ 0, 0.2, 0.5, 0.8 };
+    auto levels = PolygonHullSimplifier::hull(geom.get(), true, fractions);
+    for (const auto& level : levels) {
+        ensure("output is valid", level->isValid());
+        ensure(level->contains(geom.get()));
+    }
+    ensure(levels[0]->getNumPoints() < geom->getNumPoints());
+}
+
 } // namespace tut
@@ -8,6 +8,7 @@
 #include <geos/simplify/TopologyPreservingSimplifier.h>
 // std
 #include <string>
+#include <sstream>
 #include <memory>
 
 namespace tut {
@@ -357,4 +358,49 @@ void object::test<16>
                   "GEOMETRYCOLLECTION (LINESTRING (0 0, 10 0))");
 }
 
+// Multi-threaded simplification matches serial simplification
+template<>
+template<>
+void object::test<17>
+()
+{
+    //-- crossing and touching zig-zag lines, so that lines interact
+    std::ostringstream wkt;
+    wkt << "MULTILINESTRING (";
+    unsigned int seed = 7;
+    for (int i = 0; i < 60; i++) {
+        if (i > 0) wkt << ", ";
+        wkt << "(";
+        int x0 = (i % 10) * 30;
+        int y0 = (i / 10) * 30;
+        for (int j = 0; j < 40; j++) {
+            seed = seed * 1103515245 + 12345;
+            int dy = static_cast<int>((seed >> 16) % 9);
+            if (j > 0) wkt << ", ";
+            if (i % 2 == 0) {
+                wkt << x0 + 2 * j << " " << y0 + dy;
+            }
+            else {
+                wkt << x0 + dy << " " << y0 + 2 * j - 20;
+            }
+        }
+        wkt << ")";
+    }
+    wkt << ")";
+
+    GeomPtr g(wktreader.read(wkt.str()));
+
+    TopologyPreservingSimplifier serial(g.get());
+    serial.setDistanceTolerance(5.0);
+    GeomPtr expected = serial.getResultGeometry();
+
+    TopologyPreservingSimplifier parallel(g.get());
+    parallel.setDistanceTolerance(5.0);
+    parallel.setNumThreads(4);
+    GeomPtr simplified = parallel.getResultGeometry();
+
+    ensure(simplified->getNumPoints() < g->getNumPoints());
+    ensure_equals(wktwriter.write(simplified.get()), wktwriter.write(expected.get()));
+}
+
 } // namespace tut
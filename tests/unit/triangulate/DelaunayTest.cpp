@@ -14,6 +14,7 @@
 #include <geos/geom/GeometryCollection.h>
 #include <geos/geom/GeometryFactory.h>
 #include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/Triangle.h>
 //#include <stdio.h>
 
 using namespace geos::triangulate;
@@ -274,4 +275,70 @@ void object::test<13>
     runDelaunay(wkt, true, expected);
 }
 
+// Spatially sorted insertion gives the same triangulation for sites in general position
+template<>
+template<>
+void object::test<14>
+()
+{
+    const GeometryFactory& geomFact(*GeometryFactory::getDefaultInstance());
+    CoordinateArraySequence sites;
+    unsigned int seed = 12345;
+    for (int i = 0; i < 2000; i++) {
+        seed = seed * 1103515245 + 12345;
+        double x = (seed >> 8) % 100000 / 100.0;
+        seed = seed * 1103515245 + 12345;
+        double y = (seed >> 8) % 100000 / 100.0;
+        sites.add(Coordinate(x, y));
+    }
+
+    DelaunayTriangulationBuilder builder;
+    builder.setSites(sites);
+    auto expected = builder.getTriangles(geomFact);
+
+    DelaunayTriangulationBuilder sortedBuilder;
+    sortedBuilder.setSpatialSort(true);
+    sortedBuilder.setSites(sites);
+    auto results = sortedBuilder.getTriangles(geomFact);
+
+    ensure_equals(results->getNumGeometries(), expected->getNumGeometries());
+    results->normalize();
+    expected->normalize();
+    ensure(results->equalsExact(expected.get()));
+}
+
+// Cocircular sites: both insertion orders give a Delaunay triangulation,
+// but not necessarily the same one
+template<>
+template<>
+void object::test<15>
+()
+{
+    const GeometryFactory& geomFact(*GeometryFactory::getDefaultInstance());
+    CoordinateArraySequence sites;
+    for (int i = 0; i < 10; i++) {
+        for (int j = 0; j < 10; j++) {
+            sites.add(Coordinate(i, j));
+        }
+    }
+
+    for (bool isSpatialSort : { false, true }) {
+        DelaunayTriangulationBuilder builder;
+        builder.setSpatialSort(isSpatialSort);
+        builder.setSites(sites);
+        auto triangles = builder.getTriangles(geomFact);
+
+        ensure_equals(triangles->getNumGeometries(), 162u);
+        ensure_equals(triangles->getArea(), 81.0);
+        for (std::size_t i = 0; i < triangles->getNumGeometries(); i++) {
+            auto pts = triangles->getGeometryN(i)->getCoordinates();
+            CoordinateXY centre = Triangle::circumcentre(pts->getAt(0), pts->getAt(1), pts->getAt(2));
+            double radius = centre.distance(pts->getAt(0));
+            for (std::size_t k = 0; k < sites.size(); k++) {
+                ensure(centre.distance(sites.getAt(k)) >= radius - 1e-9);
+            }
+        }
+    }
+}
+
 } // namespace tut
@@ -0,0 +1,162 @@
+//
+// Test Suite for geos::triangulate::PartitionedVoronoiDiagramBuilder
+//
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/triangulate/PartitionedVoronoiDiagramBuilder.h>
+#include <geos/triangulate/VoronoiDiagramBuilder.h>
+#include <geos/io/WKTWriter.h>
+#include <geos/io/WKTReader.h>
+#include <geos/geom/CoordinateArraySequence.h>
+#include <geos/geom/GeometryCollection.h>
+#include <geos/geom/GeometryFactory.h>
+
+using namespace geos::triangulate;
+using namespace geos::geom;
+using namespace geos::io;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_partitionedvoronoi_data {
+    const GeometryFactory& geomFact;
+
+    test_partitionedvoronoi_data()
+        : geomFact(*GeometryFactory::getDefaultInstance())
+    {}
+
+    static CoordinateArraySequence
+    randomSites(std::size_t n, unsigned int seed)
+    {
+        CoordinateArraySequence sites;
+        for (std::size_t i = 0; i < n; i++) {
+            seed = seed * 1103515245 + 12345;
+            double x = (seed >> 8) % 100000 / 100.0;
+            seed = seed * 1103515245 + 12345;
+            double y = (seed >> 8) % 100000 / 50.0;
+            sites.add(Coordinate(x, y));
+        }
+        return sites;
+    }
+
+    void
+    checkSameAsVoronoi(const CoordinateArraySequence& sites, std::size_t maxTileSize, const Envelope* clipEnv)
+    {
+        VoronoiDiagramBuilder builder;
+        builder.setSites(sites);
+        builder.setClipEnvelope(clipEnv);
+        auto expected = builder.getDiagram(geomFact);
+
+        PartitionedVoronoiDiagramBuilder partBuilder;
+        partBuilder.setSites(sites);
+        partBuilder.setClipEnvelope(clipEnv);
+        partBuilder.setMaxTileSize(maxTileSize);
+        auto results = partBuilder.getDiagram(geomFact);
+
+        ensure_equals(results->getNumGeometries(), expected->getNumGeometries());
+        results->normalize();
+        expected->normalize();
+        ensure(results->equalsExact(expected.get(), 1e-9));
+    }
+};
+
+typedef test_group<test_partitionedvoronoi_data> group;
+typedef group::object object;
+
+group test_partitionedvoronoi_group("geos::triangulate::PartitionedVoronoiDiagramBuilder");
+
+// Cells are the same as those of VoronoiDiagramBuilder
+template<>
+template<>
+void object::test<1>
+()
+{
+    checkSameAsVoronoi(randomSites(3000, 12345), 200, nullptr);
+}
+
+// Cells are the same with a clip envelope
+template<>
+template<>
+void object::test<2>
+()
+{
+    Envelope clipEnv(-500, 1500, -500, 2500);
+    checkSameAsVoronoi(randomSites(1000, 777), 100, &clipEnv);
+}
+
+// Result does not depend on the number of threads
+template<>
+template<>
+void object::test<3>
+()
+{
+    auto sites = randomSites(2000, 4242);
+    WKTWriter writer;
+
+    PartitionedVoronoiDiagramBuilder builder;
+    builder.setSites(sites);
+    builder.setMaxTileSize(150);
+    auto expected = builder.getDiagram(geomFact);
+
+    PartitionedVoronoiDiagramBuilder parBuilder;
+    parBuilder.setSites(sites);
+    parBuilder.setMaxTileSize(150);
+    parBuilder.setNumThreads(4);
+    auto results = parBuilder.getDiagram(geomFact);
+
+    ensure_equals(writer.write(results.get()), writer.write(expected.get()));
+}
+
+// Streaming output gives the cells of the diagram in order
+template<>
+template<>
+void object::test<4>
+()
+{
+    auto sites = randomSites(500, 99);
+
+    PartitionedVoronoiDiagramBuilder builder;
+    builder.setSites(sites);
+    builder.setMaxTileSize(64);
+    auto expected = builder.getDiagram(geomFact);
+
+    std::size_t count = 0;
+    builder.getDiagram(geomFact, [&](std::unique_ptr<Geometry> cell) {
+        ensure(cell->equalsExact(expected->getGeometryN(count)));
+        count++;
+    });
+    ensure_equals(count, expected->getNumGeometries());
+}
+
+// Collinear sites
+template<>
+template<>
+void object::test<5>
+()
+{
+    CoordinateArraySequence sites;
+    for (int i = 0; i < 100; i++) {
+        sites.add(Coordinate(i, 2 * i));
+    }
+    checkSameAsVoronoi(sites, 10, nullptr);
+}
+
+// Empty input
+template<>
+template<>
+void object::test<6>
+()
+{
+    WKTReader reader;
+    auto geom = reader.read("MULTIPOINT EMPTY");
+
+    PartitionedVoronoiDiagramBuilder builder;
+    builder.setSites(*geom);
+    auto results = builder.getDiagram(geomFact);
+    ensure(results->isEmpty());
+}
+
+} // namespace tut
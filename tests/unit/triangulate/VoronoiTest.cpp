@@ -233,4 +233,67 @@ void object::test<10>
     runVoronoi(wkt, expected, 0);
 }
 
+// Spatially sorted insertion gives the same diagram for sites in general position
+template<>
+template<>
+void object::test<11>
+()
+{
+    const GeometryFactory& geomFact(*GeometryFactory::getDefaultInstance());
+    CoordinateArraySequence sites;
+    unsigned int seed = 54321;
+    for (int i = 0; i < 1000; i++) {
+        seed = seed * 1103515245 + 12345;
+        double x = (seed >> 8) % 100000 / 100.0;
+        seed = seed * 1103515245 + 12345;
+        double y = (seed >> 8) % 100000 / 100.0;
+        sites.add(Coordinate(x, y));
+    }
+
+    VoronoiDiagramBuilder builder;
+    builder.setSites(sites);
+    auto expected = builder.getDiagram(geomFact);
+
+    VoronoiDiagramBuilder sortedBuilder;
+    sortedBuilder.setSpatialSort(true);
+    sortedBuilder.setSites(sites);
+    auto results = sortedBuilder.getDiagram(geomFact);
+
+    ensure_equals(results->getNumGeometries(), expected->getNumGeometries());
+    results->normalize();
+    expected->normalize();
+    ensure(results->equalsExact(expected.get()));
+}
+
+// Cocircular sites on a grid: the triangulations differ with the
+// insertion order, but their circumcentres give the same cells
+template<>
+template<>
+void object::test<12>
+()
+{
+    const GeometryFactory& geomFact(*GeometryFactory::getDefaultInstance());
+    CoordinateArraySequence sites;
+    for (int i = 0; i < 10; i++) {
+        for (int j = 0; j < 10; j++) {
+            sites.add(Coordinate(i, j));
+        }
+    }
+
+    VoronoiDiagramBuilder builder;
+    builder.setSites(sites);
+    auto expected = builder.getDiagram(geomFact);
+
+    VoronoiDiagramBuilder sortedBuilder;
+    sortedBuilder.setSpatialSort(true);
+    sortedBuilder.setSites(sites);
+    auto results = sortedBuilder.getDiagram(geomFact);
+
+    ensure_equals(results->getNumGeometries(), 100u);
+    ensure_equals(expected->getNumGeometries(), 100u);
+    results->normalize();
+    expected->normalize();
+    ensure(results->equalsExact(expected.get()));
+}
+
 } // namespace tut
@@ -12,6 +12,7 @@
 #include <geos/triangulate/polygon/PolygonTriangulator.h>
 
 // std
+#include <sstream>
 #include <stdio.h>
 
 using geos::triangulate::polygon::PolygonTriangulator;
@@ -232,4 +233,76 @@ void object::test<13>()
         );
 }
 
+/**
+ * A polygon with a grid of holes requiring many joins through narrow gaps.
+ */
+template<>
+template<>
+void object::test<14>()
+{
+    std::ostringstream wkt;
+    wkt << "POLYGON ((0 0, 0 20, 20 20, 20 0, 0 0)";
+    for (int i = 0; i < 10; i++) {
+        for (int j = 0; j < 10; j++) {
+            double x = 2 * i + 0.5 + 0.1 * ((i * 3 + j) % 4);
+            double y = 2 * j + 0.5 + 0.1 * ((i + j * 7) % 4);
+            wkt << ", (" << x << " " << y << ", " << x + 1 << " " << y
+                << ", " << x + 1 << " " << y + 1 << ", " << x << " " << y + 1
+                << ", " << x << " " << y << ")";
+        }
+    }
+    wkt << ")";
+    checkTri(wkt.str());
+}
+
+/**
+ * A polygon with rows of diamond holes, chained by touching each other
+ * at vertices, with the first or last hole of some rows touching a
+ * vertex of the shell.
+ */
+template<>
+template<>
+void object::test<15>()
+{
+    // a hole touches its right neighbour unless (i + j) % 3 == 0, and the
+    // shell on the left in even rows, on the right in odd rows
+    auto touchesRight = [](int i, int j) {
+        return i < 9 ? (i + j) % 3 != 0 : j % 2 == 1;
+    };
+    auto touchesLeft = [&touchesRight](int i, int j) {
+        return i > 0 ? touchesRight(i - 1, j) : j % 2 == 0;
+    };
+
+    std::ostringstream wkt;
+    wkt << "POLYGON ((0 0";
+    for (int j = 0; j < 10; j++) {
+        if (j % 2 == 0) {
+            wkt << ", 0 " << 2 * j + 1;
+        }
+    }
+    wkt << ", 0 20, 20 20";
+    for (int j = 9; j >= 0; j--) {
+        if (j % 2 == 1) {
+            wkt << ", 20 " << 2 * j + 1;
+        }
+    }
+    wkt << ", 20 0, 0 0)";
+    for (int j = 0; j < 10; j++) {
+        for (int i = 0; i < 10; i++) {
+            int x = 2 * i + 1;
+            int y = 2 * j + 1;
+            double left = touchesLeft(i, j) ? x - 1 : x - 0.8;
+            double right = touchesRight(i, j) ? x + 1 : x + 0.8;
+            wkt << ", (" << left << " " << y << ", " << x << " " << y - 0.8
+                << ", " << right << " " << y << ", " << x << " " << y + 0.8
+                << ", " << left << " " << y << ")";
+        }
+    }
+    wkt << ")";
+
+    std::unique_ptr<Geometry> geom = r.read(wkt.str());
+    ensure(geom->isValid());
+    checkTri(wkt.str());
+}
+
 } // namespace tut